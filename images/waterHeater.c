@@ -25,7 +25,7 @@
 static const struct {
   unsigned int 	 width;
   unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
+  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
   unsigned char	 rle_pixel_data[1135 + 1];
 } waterHeater = {
   30, 26, 2,
@@ -72,4 +72,3 @@ static const struct {
   "\326\236\367y\316q\214\276\367\236\367\227}\357\202\236\367\004]\357Q\214\206"
   "\061U\255\232\272\326\002q\214\206\061",
 };
-
@@ -0,0 +1,77 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#ifndef DISPLAY_STREAM_H_
+#define DISPLAY_STREAM_H_
+
+#include "debug.h"
+#include <Arduino.h>
+
+#include <Adafruit_ILI9341.h>
+
+const uint16_t DISPLAY_STREAM_CHUNK_PIXELS = 4096; // 8 KB, about 2 msec on the wire at 32 MHz.
+
+typedef void (*DisplayStreamService)(void* context);
+
+/**
+   Sends large fills and bitmaps to the display in chunks of rows and runs a service callback in between, so LIN
+   and WiFi are not starved while a whole screen goes out. The Adafruit driver has no DMA path on the ESP32 and its
+   SPIClass owns the bus registers, so the transfer itself stays synchronous.
+*/
+class DisplayStream {
+
+  private:
+    DisplayStreamService service;
+    void* serviceContext;
+    bool servicing;
+
+    DisplayStream(void) {
+      service = 0;
+      serviceContext = 0;
+      servicing = false;
+    }
+
+  public:
+    static DisplayStream& getInstance() {
+      static DisplayStream instance;
+      return instance;
+    }
+
+    /**
+       @param service Must not draw, it is called in the middle of a transfer.
+    */
+    void setService(DisplayStreamService service, void* context);
+
+    /**
+       Runs the service callback, call between chunks of any other long transfer.
+    */
+    void serviceTransfer(void);
+
+    /**
+       Rows per chunk for an area "w" pixels wide.
+    */
+    inline uint16_t getChunkRows(uint16_t w) const {
+      return max(1, DISPLAY_STREAM_CHUNK_PIXELS / max(w, (uint16_t) 1));
+    }
+
+    void fillRect(Adafruit_ILI9341* display, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void drawRGBBitmap(Adafruit_ILI9341* display, int16_t x, int16_t y, const uint16_t* pixels, int16_t w, int16_t h);
+};
+
+
+#endif // DISPLAY_STREAM_H_
@@ -0,0 +1,99 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#ifndef ENERGY_MENU_H_
+#define ENERGY_MENU_H_
+
+#include "debug.h"
+#include "MenuItem.h"
+#include "IbsBank.h"
+
+
+/**
+   Battery current and charged and discharged Ah and Wh per day, trip and in total, of one battery or all of them
+   combined. The trip is reset from here.
+*/
+class EnergyMenu : public MenuItem {
+
+private:
+IbsBank* ibsBank;
+uint8_t battery; // Instance shown, IbsBank::getCount() for all combined.
+uint8_t resetTrip;
+uint32_t lastUpdate; // millis()
+
+MenuLabel batteryLabel;
+MenuLabel current;
+MenuNumber chargeIn[kIbsPeriodCount];
+MenuNumber chargeOut[kIbsPeriodCount];
+MenuNumber energyIn[kIbsPeriodCount];
+MenuNumber energyOut[kIbsPeriodCount];
+MenuLabel resetTripLabel;
+
+void addWidgets(void);
+
+void printScreenImplementation(void);
+void updateScreenImplementation(void);
+void onEnterButtonImplementation(void);
+void onLeaveButtonImplementation(void);
+
+void updateTotals(void);
+void updateBattery(boolean highlighted, boolean selected);
+void updateResetTrip(boolean highlighted, boolean selected);
+
+public:
+
+EnergyMenu(Adafruit_ILI9341* adaIli9431, IbsBank* ibsBank)
+        : MenuItem(adaIli9431) {
+        this->ibsBank = ibsBank;
+        addWidgets();
+}
+
+EnergyMenu(Adafruit_ILI9341* adaIli9431, String headline, IbsBank* ibsBank)
+        : MenuItem(adaIli9431, headline) {
+        this->ibsBank = ibsBank;
+        addWidgets();
+}
+
+inline bool isVisible(void) {
+        return true;
+}
+
+void printScreen(void) {
+        printScreenImplementation();
+}
+
+void updateScreen(void) {
+        updateScreenImplementation();
+}
+
+void onEnterMenu(void) {
+        onEnterButtonImplementation();
+}
+
+void onLeaveMenu(void) {
+        onLeaveButtonImplementation();
+}
+void inputLeft(void);
+void inputRight(void);
+void inputPush(void);
+
+void updateSelectionFocus(void);
+};
+
+
+#endif // ENERGY_MENU_H_
@@ -25,7 +25,8 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_ILI9341.h>
 
-#include "LinDriver.h"
+#include "LinBusArbiter.h"
+#include "IbsBank.h"
 #include "MenuItem.h"
 
 typedef enum {
@@ -66,13 +67,15 @@ public:
 GfxMenu(uint8_t pinCs, uint8_t pinDc, uint8_t pinRst, uint8_t pinBacklight = 0, uint8_t pinPwr = 0);
 ~GfxMenu(void);
 
-void setup(LinDriver* linDriver = 0);
+void setup(LinBusArbiter* linArbiter = 0);
 
 /**
    Call this method as fast as possible got guarantee fluent operation.
  */
 void loop(void);
 
+IbsBank& getIbsBank(void);
+
 uint16_t lastLoopStateChange;
 GfxMenuLoopState loopState;
 
@@ -21,23 +21,122 @@
 
 #include "debug.h"
 #include <Arduino.h>
-#include "LinDriver.h"
+#include "LinBusArbiter.h"
+#include "LinTransport.h"
+#include "IbsEnergyCounter.h"
+#include "IbsRuntimeEstimator.h"
 #include <string.h>
 
 
+/**
+   Frame 2: battery current, voltage, temperature and error flag.
+*/
+template<uint8_t ID>
+struct IbsFrame2 : public LinFrame<ID, 7> {
+  inline int32_t getCurrent(void) const { // mA
+    return int32_t(this->template get<0, 3>()) - 2000000L;
+  }
+  inline uint16_t getVoltage(void) const { // mV
+    return this->template get<3, 2>();
+  }
+  inline uint8_t getTemperature(void) const { // 0.5 K, 0 = -40 °C
+    return this->template get<5, 1>();
+  }
+  inline bool isError(void) const {
+    return bitRead(this->data[6], 7);
+  }
+};
+
+/**
+   Frame 5: state of charge, state of health, optimum charging voltage and internal resistance.
+*/
+template<uint8_t ID>
+struct IbsFrame5 : public LinFrame<ID, 6> {
+  inline uint8_t getSoc(void) const { // 0.5 %
+    return this->template get<0, 1>();
+  }
+  inline uint8_t getSoh(void) const { // 0.5 %
+    return this->template get<1, 1>();
+  }
+  inline uint8_t getOptChargeVoltage(void) const { // 50 mV, 160 = 13.0 V
+    return this->template get<3, 1>();
+  }
+  inline uint16_t getAvgRi(void) const { // 0.01 mOhm
+    return this->template get<4, 2>();
+  }
+};
+
+/**
+   Frame 6: available, dischargeable and nominal capacity and calibration state.
+*/
+template<uint8_t ID>
+struct IbsFrame6 : public LinFrame<ID, 6> {
+  inline uint16_t getAvailableCapacity(void) const { // 0.1 Ah
+    return this->template get<0, 2>();
+  }
+  inline uint16_t getDischargeableCapacity(void) const { // 0.1 Ah
+    return this->template get<2, 2>();
+  }
+  inline uint8_t getNominalCapacity(void) const { // Ah
+    return this->template get<4, 1>();
+  }
+  inline bool isCalibrated(void) const {
+    return bitRead(this->data[5], 0);
+  }
+};
+
+// Sensors on slot S1 and S2 use the same layouts on different frame IDs.
+typedef IbsFrame2<0x22> IbsS1Frame2;
+typedef IbsFrame5<0x25> IbsS1Frame5;
+typedef IbsFrame6<0x26> IbsS1Frame6;
+typedef IbsFrame2<0x28> IbsS2Frame2;
+typedef IbsFrame5<0x2B> IbsS2Frame5;
+typedef IbsFrame6<0x2C> IbsS2Frame6;
+
+typedef enum {
+  kIbsSlotS1,
+  kIbsSlotS2,
+} IbsSlot;
+
+/**
+   The stats frames of one slot, each read into and decoded from its own descriptor.
+*/
+template<class FRAME2, class FRAME5, class FRAME6>
+struct IbsFrameSet {
+  FRAME2 frame2;
+  FRAME5 frame5;
+  FRAME6 frame6;
+};
+
+typedef IbsFrameSet<IbsS1Frame2, IbsS1Frame5, IbsS1Frame6> IbsS1Frames;
+typedef IbsFrameSet<IbsS2Frame2, IbsS2Frame5, IbsS2Frame6> IbsS2Frames;
+
+
+typedef enum {
+  kIbsFrame2, // Current, voltage, temperature.
+  kIbsFrame5, // SOC, SOH, Ri.
+  kIbsFrame6, // Capacities.
+  kIbsFrameCount,
+} IbsFrameIndex;
+
+const uint8_t IBS_DIAG_REQUEST_LENGTH = 6;
+
 typedef struct {
   uint8_t nad; // Node ADress
-  uint8_t* diagRequestFrame;
+  const uint8_t* diagRequestPdu; // Identification request, IBS_DIAG_REQUEST_LENGTH bytes.
   bool doubleCapacity;
   String name;
-  uint8_t frm2;
-  uint8_t frm2length;
-  uint8_t frm5;
-  uint8_t frm5length;
-  uint8_t frm6;
-  uint8_t frm6length;
+  IbsSlot slot; // Selects the frame IDs, see IbsS1Frames and IbsS2Frames.
 } IbsType;
 
+// All known IBS variants, probed in this order if an IBS does not answer the wildcard identification.
+const uint8_t IBS_MAX_COUNT = 4;
+extern const IbsType ibs[IBS_MAX_COUNT];
+
+// Sensors that can be monitored at the same time, one per NAD.
+const uint8_t IBS_INSTANCE_COUNT = 2;
+extern const uint8_t IBS_INSTANCE_NAD[IBS_INSTANCE_COUNT];
+
 
 typedef enum {
   kBatteryTypeStd = 0x0A,
@@ -46,8 +145,90 @@ typedef enum {
 } IbsBatteryType;
 
 
+/**
+   Measurement fields, as bits of IbsMeasurement::changed and of a subscriber's mask.
+*/
+typedef enum {
+  kIbsFieldAvailable = 0x0001,
+  kIbsFieldVoltage = 0x0002,
+  kIbsFieldCurrent = 0x0004,
+  kIbsFieldTemperature = 0x0008,
+  kIbsFieldError = 0x0010,
+  kIbsFieldSoc = 0x0020,
+  kIbsFieldSoh = 0x0040,
+  kIbsFieldOptChargeVoltage = 0x0080,
+  kIbsFieldAvgRi = 0x0100,
+  kIbsFieldAvailableCapacity = 0x0200,
+  kIbsFieldDischargeableCapacity = 0x0400,
+  kIbsFieldNominalCapacity = 0x0800,
+  kIbsFieldCalibrated = 0x1000,
+  kIbsFieldBatteryType = 0x2000,
+  kIbsFieldRuntime = 0x4000, // Trend or minutes of the runtime prediction.
+  kIbsFieldConfig = 0x8000, // IbsConfigStatus.
+  kIbsFieldAll = 0xffff,
+} IbsField;
+
+/**
+   Decoded readings in the IBS's own integer units, converted to display units by the HellaIbs getters.
+   Fields are ordered by size, so the struct has no gaps and stays aligned.
+*/
+typedef struct {
+  int32_t current; // mA, positive while charging
+  uint16_t voltage; // mV
+  uint16_t optChargeVoltage; // optimum charging voltage, mV
+  uint16_t avgRi; // average internal resistance of battery, 0.01 mOhm
+  uint16_t availableCapacity; // 0.1 Ah
+  uint16_t dischargeableCapacity; // 0.1 Ah
+  int16_t temperature; // 0.5 °C
+  int16_t nominalCapacity; // Ah
+  uint8_t soc; // state of charge, %
+  uint8_t soh; // state of health, %
+  uint8_t batteryType; // IbsBatteryType
+  uint8_t flags; // IbsSampleFlag bits
+} IbsSample;
+
+static_assert(sizeof(IbsSample) == 24, "IbsSample must not have gaps.");
+
+typedef enum {
+  kIbsSampleAvailable = 0x01,
+  kIbsSampleError = 0x02,
+  kIbsSampleCalibrated = 0x04,
+} IbsSampleFlag;
+
+/**
+   Snapshot of the last decoded readings. 'version' counts the updates that changed at least one field,
+   'changed' holds the IbsField bits of the latest one.
+*/
+typedef struct {
+  uint32_t version;
+  uint16_t changed;
+  IbsSample sample;
+} IbsMeasurement;
+
+typedef enum {
+  kIbsConfigIdle,   // Not configured since start.
+  kIbsConfigBusy,   // Writing, reading back or waiting for a retry.
+  kIbsConfigOk,     // Nominal capacity and battery type read back as written.
+  kIbsConfigFailed, // Still not verified after IBS_CONFIG_ATTEMPTS.
+} IbsConfigStatus;
+
+const uint8_t IBS_CONFIG_ATTEMPTS = 3;
+const uint16_t IBS_CONFIG_RETRY_DELAY = 500; // msec
+
+class HellaIbs;
+struct IbsCache;
+
+/**
+   Called from HellaIbs::loop() with the IbsField bits that changed, masked by the subscription.
+*/
+typedef void (*IbsUpdateCallback)(void* context, const HellaIbs* ibs, uint16_t changed);
+
+const uint8_t IBS_MAX_SUBSCRIBERS = 4;
+
+
 typedef enum {
   kHilsNoIbsConnected,
+  kHilsVerifyCachedIbs, // A single frame read confirms the IBS remembered from before the deep sleep.
 
   kHilsRequestIbs, // Send diagnostic request frame.
   kHilsResponseIbs, // Recieve diagnostic response frame.
@@ -55,57 +236,113 @@ typedef enum {
   kHilsResponseBatteryType,
 
   kHilsPrepareReadStats,
-  kHilsReadFrame2,
-  kHilsReadFrame5,
-  kHilsReadFrame6,
-  kHilsPauseAfterRead,
+  kHilsReadStats, // Battery stats are read by the LIN driver's schedule table.
 
   kHilsPrepareConfig,
-  kHilsWriteConfigCapacityStep1,
-  kHilsWriteConfigCapacityStep2,
-  kHilsWriteConfigBattTypeStep1,
-  kHilsWriteConfigBattTypeStep2,
+  kHilsWriteConfig, // Configuration requests and their read-back run back to back on the LIN transport layer.
+  kHilsRetryConfig, // Write the values that did not read back as written again.
 
 } HellaIbsLoopState;
 
 /**
    This class is an abstraction of the Hella IBS's (Intelligent Battery Sensor).
-   It is built on top of the LIN driver created by 'gandrewstone'. The source of the LIN driver can be found here:
+   It talks to the bus through the LIN bus arbiter, on top of the LIN driver created by 'gandrewstone'. The source of the LIN driver can be found here:
    https://github.com/gandrewstone/LIN
 */
 class HellaIbs {
 
   private:
+    uint8_t instance;
+    uint8_t nad;
     uint8_t connectedIbsIndex;
     uint8_t variant;
+    uint8_t probeIndex;
+    bool probeFound;
+    bool probeAny; // Identify with wildcard supplier and function ID, before walking the ibs[] table.
+    bool wildcardUnsupported; // The IBS on this NAD was found by the table walk after the wildcard request failed.
+    bool verifyFailed; // The cached IBS did not answer, identify from scratch.
+    uint16_t detectDelay; // msec before the next detection attempt, backs off while nobody answers.
 
     bool startConfigure;
     int16_t configNominalCapacity;
     IbsBatteryType configBattType;
+    IbsConfigStatus configStatus;
+    uint8_t configPending; // Values not verified yet.
+    uint8_t configAttempt;
+
+    LinBusArbiter* linArbiter;
+    LinTransport* transport; // Diagnostic requests on 0x3C/0x3D, shared by all IBS on the bus.
+    IbsEnergyCounter energyCounter; // Fed with every frame 2.
+    IbsRuntimeEstimator runtimeEstimator; // Fed with every frame 2.
+
+    IbsMeasurement measurement;
+    uint16_t pendingChanges; // IbsField bits not yet published.
+
+    struct {
+      IbsUpdateCallback callback;
+      void* context;
+      uint16_t mask;
+    } subscribers[IBS_MAX_SUBSCRIBERS];
+
+    void setAvailable(bool available);
+    void detectionFailed(void);
+    void setBatteryType(IbsBatteryType batteryType);
+    void publish(void);
 
-    LinDriver* linDriver;
-
-    uint8_t soc; // state of charge
-    uint8_t soh; // state of health
-    float avgRi; // average internal resistance of battery
-    float optChargeVoltage; // optimum charging voltage
-    float batteryVoltage;
-    float batteryCurrent;
-    float temperature;
-    float availableCapacity;
-    float dischargeableCapacity;
-    int16_t nominalCapacity;
-    bool calibrated = false;
-    bool ibsError = false;
     bool highSpeedCommunication = false;
-    bool available = false;
 
-    IbsBatteryType batteryType;
+    bool batteryTypeRead;
 
     uint8_t result;
-    uint8_t linInfoFrame[8];
+    uint8_t resultAddr;
+    IbsS1Frames s1Frames;
+    IbsS2Frames s2Frames;
+    bool recvPending = false;
+    bool recvDone = false;
 
-    void clearLinInfoFrame(void);
+    /**
+       Starts an asynchronous read of "frame" on first call, then polls for its completion.
+       @return true once the read has completed and 'result' is valid, false while it is still running.
+    */
+    template<class Frame>
+    bool recvFrame(Frame& frame);
+    static void onRecvFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result);
+
+    IbsCache* cache; // This instance's part of the RTC memory.
+    void restoreCache(void);
+    void updateCache(void);
+
+    static void onProbeResponse(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result);
+
+    void setConfigStatus(IbsConfigStatus status);
+    bool startConfigExchange(void); // false if the transport queue was full.
+    static void onConfigStep(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result);
+    static void onNominalCapacityReadBack(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result);
+    static void onBatteryTypeReadBack(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result);
+    static void onBatteryTypeResponse(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result);
+
+    LinScheduleSlot statsSchedule[kIbsFrameCount]; // Frame 2, 5 and 6, merged into the bus schedule by the arbiter.
+    bool statsScheduleHighSpeed;
+    bool statsScheduleChanged;
+    uint16_t pollPeriod[kIbsFrameCount];
+    uint16_t pollPeriodHighSpeed[kIbsFrameCount];
+
+    void setupStatsSchedule(void);
+    template<class Frames>
+    void setupStatsSchedule(Frames& frames, const uint16_t* period);
+    // Returns the IbsFrameIndex of a good frame, kIbsFrameCount otherwise.
+    uint8_t decodeStatsFrame(uint8_t addr, uint8_t result);
+    template<class Frames>
+    uint8_t decodeFrames(const Frames& frames, uint8_t addr);
+    template<class Frames>
+    void restoreFrames(Frames& frames);
+    template<uint8_t ID>
+    void decodeFrame(const IbsFrame2<ID>& frame);
+    template<uint8_t ID>
+    void decodeFrame(const IbsFrame5<ID>& frame);
+    template<uint8_t ID>
+    void decodeFrame(const IbsFrame6<ID>& frame);
+    static void onStatsFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result);
 
     uint64_t lastLoopStateChange;
     HellaIbsLoopState loopState;
@@ -114,78 +351,132 @@ class HellaIbs {
 
   public:
 
-    HellaIbs() {
-      startConfigure = false;
-      changeLoopState(kHilsNoIbsConnected);
-    }
+    HellaIbs();
 
-    void setup(LinDriver* linDriver);
+    /**
+       @param transport Shared by all IBS on "linArbiter"'s bus, its loop() is up to the caller.
+       @param instance Selects the NAD (IBS_INSTANCE_NAD) and the RTC and Persistence state.
+    */
+    void setup(LinBusArbiter* linArbiter, LinTransport* transport, uint8_t instance = 0);
 
     /**
        Call this method as fast as possible got guarantee fluent operation.
     */
     void loop(void);
 
+    // Leave the bus to the others: drop the schedule and pending requests, the IBS counts as gone. loop() starts over
+    // with detection.
+    void stop(void);
+
+    /**
+       Write nominal capacity and battery type as soon as the IBS is polled. Both are read back and written again up to
+       IBS_CONFIG_ATTEMPTS times until they match, see getConfigStatus().
+    */
     void configure(int16_t nominalCapacity /* Ah */, IbsBatteryType battType);
 
+    inline IbsConfigStatus getConfigStatus(void) const {
+      return configStatus;
+    }
+
     inline void setHighSpeedCommunication(boolean enable) {
       highSpeedCommunication = enable;
     }
 
-    inline uint8_t getSoc(void) {
-      return soc;
+    /**
+       Poll "frame" every "period" msec, or every "periodHighSpeed" msec in high speed mode. Frame 2 sets the pace,
+       the other frames are polled on every n-th pass of it, so their periods are rounded to a multiple of frame 2's.
+    */
+    void setPollPeriod(IbsFrameIndex frame, uint16_t period, uint16_t periodHighSpeed);
+
+    /**
+       Calls "callback" whenever a decoded frame changes one of the IbsField bits in "mask".
+       @return false if all subscriber slots are taken.
+    */
+    bool subscribe(IbsUpdateCallback callback, void* context, uint16_t mask = kIbsFieldAll);
+    void unsubscribe(IbsUpdateCallback callback, void* context);
+
+    inline const IbsMeasurement& getMeasurement(void) const {
+      return measurement;
+    }
+
+    inline uint32_t getVersion(void) const {
+      return measurement.version;
+    }
+
+    inline IbsEnergyCounter& getEnergyCounter(void) {
+      return energyCounter;
+    }
+
+    inline const IbsRuntimeEstimator& getRuntimeEstimator(void) const {
+      return runtimeEstimator;
+    }
+
+    inline const IbsSample& getSample(void) const {
+      return measurement.sample;
+    }
+
+    inline uint8_t getSoc(void) const {
+      return measurement.sample.soc;
+    }
+
+    inline uint8_t getSoh(void) const {
+      return measurement.sample.soh;
+    }
+
+    inline float getAvgRi(void) const { // mOhm
+      return measurement.sample.avgRi / 100.0f;
     }
 
-    inline uint8_t getSoh(void) {
-      return soh;
+    inline bool isCalibrated(void) const {
+      return measurement.sample.flags & kIbsSampleCalibrated;
     }
 
-    inline uint8_t getAvgRi(void) {
-      return avgRi;
+    inline bool isError(void) const {
+      return measurement.sample.flags & kIbsSampleError;
     }
 
-    inline bool isCalibrated(void) {
-      return calibrated;
+    inline IbsBatteryType getBatteryType(void) const {
+      return (IbsBatteryType) measurement.sample.batteryType;
     }
 
-    inline bool isError(void) {
-      return ibsError;
+    inline float getBatteryCurrent(void) const { // A
+      return measurement.sample.current / 1000.0f;
     }
 
-    inline IbsBatteryType getBatteryType(void) {
-      return batteryType;
+    inline float getBatteryVoltage(void) const { // V
+      return measurement.sample.voltage / 1000.0f;
     }
 
-    inline float getBatteryCurrent(void) {
-      return batteryCurrent;
+    inline float getOptChargeVoltage(void) const { // V
+      return measurement.sample.optChargeVoltage / 1000.0f;
     }
 
-    inline float getBatteryVoltage(void) {
-      return batteryVoltage;
+    inline float getAvailableCapacity(void) const { // Ah
+      return measurement.sample.availableCapacity / 10.0f;
     }
 
-    inline float getOptChargeVoltage(void) {
-      return optChargeVoltage;
+    inline float getDischargeableCapacity(void) const { // Ah
+      return measurement.sample.dischargeableCapacity / 10.0f;
     }
 
-    inline float getAvailableCapacity(void) {
-      return availableCapacity;
+    inline int16_t getNominalCapacity(void) const { // Ah
+      return measurement.sample.nominalCapacity;
     }
 
-    inline float getDischargeableCapacity(void) {
-      return dischargeableCapacity;
+    inline float getTemperature(void) const { // °C
+      return measurement.sample.temperature / 2.0f;
     }
 
-    inline int16_t getNominalCapacity(void) {
-      return nominalCapacity;
+    inline bool isAvailable(void) const {
+      return measurement.sample.flags & kIbsSampleAvailable;
     }
 
-    inline float getTemperature(void) {
-      return temperature;
+    inline uint8_t getInstance(void) const {
+      return instance;
     }
 
-    inline bool isAvailable(void) {
-      return available;
+    inline uint8_t getNad(void) const {
+      return nad;
     }
 
     String getName(void);
@@ -0,0 +1,89 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef HELLA_IBS_SIMULATOR_H_
+#define HELLA_IBS_SIMULATOR_H_
+
+#include <Arduino.h>
+#include "LinBusSimulator.h"
+#include "HellaIbs.h"
+
+
+/**
+   Virtual Hella IBS for the LIN bus simulator. It behaves like one entry of the ibs[] table: it answers the diagnostic
+   product ID request of its own variant only, publishes frames 2, 5 and 6 on the variant's IDs and accepts the nominal
+   capacity and battery type writes. Measurements are plain fields, a script callback may change them before every frame.
+*/
+class HellaIbsSimulator : public LinSimSlave {
+
+  private:
+    const IbsType* type;
+    uint8_t variant;
+    bool online;
+    bool wildcards;
+    unsigned long responseDelay;
+    void (*script)(HellaIbsSimulator* ibs, uint8_t id);
+
+    uint8_t diagResponse[8];
+    bool diagResponsePending;
+
+    void setDiagResponse(uint8_t pci, uint8_t rsid, const uint8_t* payload, uint8_t length);
+
+  public:
+    int32_t current;             // mA
+    uint16_t voltage;            // mV
+    uint8_t temperature;         // 0.5 K, 0 = -40 °C
+    bool error;
+    uint8_t soc;                 // 0.5 %
+    uint8_t soh;                 // 0.5 %
+    uint8_t optChargeVoltage;    // 50 mV, 160 = 13.0 V
+    uint16_t avgRi;              // 0.01 mOhm
+    uint16_t availableCapacity;  // 0.1 Ah
+    uint16_t dischargeableCapacity; // 0.1 Ah
+    uint8_t nominalCapacity;     // Ah
+    bool calibrated;
+    uint8_t batteryType;
+
+    HellaIbsSimulator(const IbsType* type, uint8_t variant);
+
+    // Called with the frame ID right before the IBS answers it, e.g. to ramp the current or to drop off the bus.
+    inline void setScript(void (*script)(HellaIbsSimulator* ibs, uint8_t id)) {
+      this->script = script;
+    }
+
+    inline void setOnline(bool online) {
+      this->online = online;
+    }
+
+    // Without wildcard support the identification request with wildcard supplier and function ID goes unanswered.
+    inline void setWildcardSupport(bool wildcards) {
+      this->wildcards = wildcards;
+    }
+
+    inline void setResponseDelay(unsigned long responseDelay) {
+      this->responseDelay = responseDelay;
+    }
+
+    uint8_t publish(uint8_t id, uint8_t* data);
+    void subscribe(uint8_t id, const uint8_t* data, uint8_t nBytes);
+
+    unsigned long getResponseDelay(void) {
+      return responseDelay;
+    }
+};
+
+#endif // HELLA_IBS_SIMULATOR_H_
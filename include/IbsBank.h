@@ -0,0 +1,88 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#ifndef IBS_BANK_H_
+#define IBS_BANK_H_
+
+#include "debug.h"
+#include <Arduino.h>
+#include "LinBusArbiter.h"
+#include "LinTransport.h"
+#include "HellaIbs.h"
+
+
+/**
+   All Hella IBS on one or more LIN buses, e.g. starter and leisure battery. Each sensor runs its own detection on its
+   own NAD, the diagnostic requests of the sensors on a bus are serialized by that bus' LIN transport and their cyclic
+   frames are interleaved by the bus arbiter's merged schedule table. The first sensor always runs, the others only once enabled in the Setup menu, so
+   a single IBS installation does not spend bus time probing for a second one.
+*/
+class IbsBank {
+
+  private:
+    LinTransport transports[IBS_INSTANCE_COUNT]; // One per bus, owned by the first instance on it.
+    HellaIbs sensors[IBS_INSTANCE_COUNT];
+    bool enabled[IBS_INSTANCE_COUNT];
+
+  public:
+    IbsBank(void) {
+      for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+        enabled[i] = 0 == i;
+      }
+    }
+
+    // All sensors on one bus.
+    void setup(LinBusArbiter* linArbiter);
+
+    // Sensor i on the bus of linArbiters[i], equal arbiters share a bus.
+    void setup(LinBusArbiter* const linArbiters[IBS_INSTANCE_COUNT]);
+
+    /**
+       Call this method as fast as possible got guarantee fluent operation.
+    */
+    void loop(void);
+
+    inline HellaIbs* getIbs(uint8_t instance) {
+      return IBS_INSTANCE_COUNT > instance ? &sensors[instance] : 0;
+    }
+
+    inline uint8_t getCount(void) const {
+      return IBS_INSTANCE_COUNT;
+    }
+
+    inline bool isEnabled(uint8_t instance) const {
+      return IBS_INSTANCE_COUNT > instance && enabled[instance];
+    }
+
+    // Persisted. Instance 0 can't be disabled, a disabled sensor leaves the bus at once.
+    void setEnabled(uint8_t instance, bool enable);
+
+    // Number of sensors currently detected.
+    uint8_t getAvailableCount(void) const;
+
+    // Sum of the available sensors' battery currents, A.
+    float getBatteryCurrent(void) const;
+
+    // Sum of all sensors' counters, so a sensor that dropped off keeps its share.
+    IbsEnergyTotals getTotals(IbsEnergyPeriod period);
+
+    void resetTotals(IbsEnergyPeriod period);
+};
+
+
+#endif // IBS_BANK_H_
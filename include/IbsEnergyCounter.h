@@ -0,0 +1,122 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef IBS_ENERGY_COUNTER_H_
+#define IBS_ENERGY_COUNTER_H_
+
+#include "debug.h"
+#include <Arduino.h>
+#include "Persistence.h"
+
+const uint32_t IBS_ENERGY_MAX_SAMPLE_GAP = 10000; // msec, longer gaps (sleep, lost IBS) are not integrated.
+const uint32_t IBS_ENERGY_CHECKPOINT_INTERVAL = 3600; // sec between Persistence writes.
+
+typedef enum {
+  kIbsPeriodDay, // Cleared at local midnight, once SNTP has set the clock (see WiFiController). Not before.
+  kIbsPeriodTrip, // Cleared by the user.
+  kIbsPeriodTotal, // Since the last reset.
+  kIbsPeriodCount,
+} IbsEnergyPeriod;
+
+/**
+   Integrated charge and energy, split by direction. Integers, so summing up never loses a sample.
+*/
+typedef struct {
+  uint64_t chargedCharge; // mA * msec
+  uint64_t dischargedCharge; // mA * msec
+  uint64_t chargedEnergy; // uW * msec
+  uint64_t dischargedEnergy; // uW * msec
+} IbsEnergyTotals;
+
+/**
+   State of one counter, meant for RTC memory.
+*/
+typedef struct {
+  uint32_t magic;
+  uint32_t day; // Local date (year * 1000 + day of the year) the day totals belong to, 0 while the clock is unset.
+  uint32_t lastCheckpoint; // time()
+  bool dirty; // Trip or total changed since the last checkpoint.
+  IbsEnergyTotals totals[kIbsPeriodCount];
+} IbsEnergyStore;
+
+/**
+   Coulomb and energy counter, fed with every battery current and voltage sample. The totals live in a store in RTC
+   memory, so they survive deep sleep; trip and total are checkpointed to Persistence about once an hour for power loss.
+*/
+class IbsEnergyCounter {
+
+  private:
+    bool hasLastSample;
+    int32_t lastCurrent; // mA
+    uint16_t lastVoltage; // mV
+    uint32_t lastSampleTime; // millis()
+    uint32_t lastCheck; // millis()
+    IbsEnergyStore* store;
+    PersistenceSlot slot;
+
+    void checkpoint(void);
+    void restore(void);
+
+  public:
+    IbsEnergyCounter(void);
+
+    /**
+       @param store Kept across deep sleep by the caller.
+       @param slot Persistence slot of kPSlotIbsEnergy's length.
+    */
+    void setup(IbsEnergyStore* store, PersistenceSlot slot);
+
+    /**
+       Handles the day rollover and the Persistence checkpoints.
+    */
+    void loop(void);
+
+    /**
+       Adds the time since the previous sample at the previous sample's current and voltage.
+    */
+    void addSample(int32_t current /* mA */, uint16_t voltage /* mV */, uint32_t time /* millis() */);
+
+    /**
+       Forget the previous sample, e.g. after the IBS has been lost.
+    */
+    inline void breakSeries(void) {
+      hasLastSample = false;
+    }
+
+    void reset(IbsEnergyPeriod period);
+
+    const IbsEnergyTotals& getTotals(IbsEnergyPeriod period) const;
+
+    inline float getChargedAh(IbsEnergyPeriod period) const {
+      return getTotals(period).chargedCharge / 3600000000.0;
+    }
+
+    inline float getDischargedAh(IbsEnergyPeriod period) const {
+      return getTotals(period).dischargedCharge / 3600000000.0;
+    }
+
+    inline float getChargedWh(IbsEnergyPeriod period) const {
+      return getTotals(period).chargedEnergy / 3600000000000.0;
+    }
+
+    inline float getDischargedWh(IbsEnergyPeriod period) const {
+      return getTotals(period).dischargedEnergy / 3600000000000.0;
+    }
+};
+
+
+#endif // IBS_ENERGY_COUNTER_H_
@@ -25,6 +25,28 @@ void onLeaveButtonImplementation(void);
 void updateSelectionFocus(void);
 
 HellaIbs* ibs;
+uint16_t pendingFields; // IbsField bits changed since they were last drawn.
+
+MenuLabel runtimeHeading;
+MenuNumber voltage;
+MenuNumber availableCapacity;
+MenuNumber dischargeableCapacity;
+MenuLabel nominalCapacity;
+MenuNumber temperature;
+MenuLabel batteryType;
+MenuNumber soh;
+MenuLabel ampFactor;
+MenuGauge currentGauge;
+MenuLabel current;
+
+MenuWidgets batteryWidgets; // Battery indicator and runtime, drawn by the main menu as well.
+MenuBar socBar;
+MenuLabel soc;
+MenuLabel runtime;
+
+void addWidgets(void);
+
+static void onIbsUpdate(void* context, const HellaIbs* ibs, uint16_t changed);
 
 public:
 IbsMenu(Adafruit_ILI9341* adaIli9431, HellaIbs* ibs);
@@ -55,8 +77,10 @@ void inputPush(void);
 
 void drawBatteryIndicator(uint16_t x, uint16_t y, uint8_t w, uint8_t h, uint8_t poleH, uint8_t poleW);
 void updateBatteryIndicator(uint16_t batteryX, uint16_t batteryY, uint16_t batteryWidth, uint16_t batteryHeight);
+void updateRuntimeIndicator(uint16_t x, uint16_t y);
 void updateNominalCapacityStat(uint16_t x, uint16_t y, int16_t capacity, boolean highlighted, boolean selected);
 void updateBatteryTypeStat(uint16_t x, uint16_t y, IbsBatteryType batteryType, boolean highlighted, boolean selected);
+void updateConfigStatus(uint16_t y);
 };
 
 
@@ -0,0 +1,102 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef IBS_RUNTIME_ESTIMATOR_H_
+#define IBS_RUNTIME_ESTIMATOR_H_
+
+#include "debug.h"
+#include <Arduino.h>
+
+const uint32_t IBS_RUNTIME_EWMA_TAU = 60000; // msec, time constant of the fast average.
+const uint8_t IBS_RUNTIME_WINDOW_BUCKETS = 30;
+const uint32_t IBS_RUNTIME_BUCKET_TIME = 10000; // msec, so the window spans 5 min.
+const uint32_t IBS_RUNTIME_MAX_SAMPLE_GAP = 10000; // msec
+const int32_t IBS_RUNTIME_IDLE_CURRENT = 100; // mA, neither charging nor discharging below.
+const uint8_t IBS_RUNTIME_LOAD_STEP = 25; // %, the fast average takes over when it is off the window by more.
+const uint32_t IBS_RUNTIME_UNKNOWN = 0xffffffff;
+
+typedef enum {
+  kIbsTrendIdle,
+  kIbsTrendDischarging, // Minutes until empty.
+  kIbsTrendCharging, // Minutes until full.
+} IbsTrend;
+
+/**
+   Predicts the time to empty or full from the battery current. A windowed average of the last 5 minutes gives a
+   steady figure, an exponentially weighted average with a 1 minute time constant follows load changes. Both are
+   updated with every sample at constant cost.
+*/
+class IbsRuntimeEstimator {
+
+  private:
+    bool hasLastSample;
+    int32_t lastCurrent; // mA
+    uint32_t lastSampleTime; // millis()
+
+    int64_t ewma; // mA * 256
+    int64_t bucketCharge[IBS_RUNTIME_WINDOW_BUCKETS]; // mA * msec
+    uint32_t bucketTime[IBS_RUNTIME_WINDOW_BUCKETS]; // msec
+    int64_t windowCharge; // Sum of all buckets.
+    uint32_t windowTime;
+    uint8_t bucket;
+
+    int32_t averageCurrent; // mA
+    IbsTrend trend;
+    uint32_t minutes;
+
+  public:
+    IbsRuntimeEstimator(void);
+
+    void reset(void);
+
+    /**
+       @param current Battery current in mA, positive while charging.
+       @param dischargeable Dischargeable capacity in 0.1 Ah.
+       @param available Available capacity in 0.1 Ah.
+       @param nominal Nominal capacity in Ah.
+       @return true if the trend or the predicted minutes changed.
+    */
+    bool addSample(int32_t current, uint16_t dischargeable, uint16_t available, int16_t nominal, uint32_t time /* millis() */);
+
+    /**
+       Forget the previous sample, e.g. after the IBS has been lost. The averages are kept.
+    */
+    inline void breakSeries(void) {
+      hasLastSample = false;
+    }
+
+    inline IbsTrend getTrend(void) const {
+      return trend;
+    }
+
+    /**
+       Minutes until empty (discharging) or full (charging), IBS_RUNTIME_UNKNOWN while idle.
+    */
+    inline uint32_t getMinutes(void) const {
+      return minutes;
+    }
+
+    /**
+       The average current the prediction is based on, in mA.
+    */
+    inline int32_t getAverageCurrent(void) const {
+      return averageCurrent;
+    }
+};
+
+
+#endif // IBS_RUNTIME_ESTIMATOR_H_
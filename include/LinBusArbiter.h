@@ -0,0 +1,150 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef LIN_BUS_ARBITER_H_
+#define LIN_BUS_ARBITER_H_
+
+#include <Arduino.h>
+#include "LinDriver.h"
+
+const uint8_t LIN_ARBITER_QUEUE_SIZE = 8;
+const uint16_t LIN_INTER_FRAME_SPACE = 1000; // uSec of bus idle between two frames.
+const uint8_t LIN_ARBITER_MAX_SCHEDULES = 4;  // Clients with their own part of the schedule table.
+const uint8_t LIN_ARBITER_SCHEDULE_SIZE = 16; // Slots of the merged schedule table, including one idle slot per client.
+
+typedef enum {
+  kLinPriorityInteractive,  // User triggered, e.g. a heater setpoint change.
+  kLinPriorityDiagnostic,   // Diagnostic exchanges, e.g. configuration.
+  kLinPriorityPoll,         // Routine polling and detection.
+} LinRequestPriority;
+
+typedef struct {
+  uint8_t addr;
+  uint8_t nBytes;
+  uint8_t proto;
+  bool write;
+  LinRequestPriority priority;
+  uint32_t sequence;       // Submission order, keeps requests of the same priority FIFO.
+  uint8_t data[8];         // Copy of the frame to write.
+  uint8_t* message;        // Receive buffer of a read.
+  LinRecvCallback callback;
+  void* context;
+} LinBusRequest;
+
+// A client's part of the schedule table, polled once per "period" msec.
+typedef struct {
+  void* owner;
+  const LinScheduleSlot* slots;
+  uint8_t count;
+  uint16_t period;
+  uint16_t passBase;  // Merged table pass the client's phases count from, kept while other clients change.
+} LinScheduleSegment;
+
+
+/**
+   Shares one LinDriver between several device drivers. Requests are queued by priority and started as soon as the
+   bus is free and LIN_INTER_FRAME_SPACE has passed, ahead of the driver's schedule table, whose slots wait for the
+   inter frame space as well. Reads of the same
+   unconditional frame that pile up in the queue are answered by a single frame on the bus.
+   Clients register their cyclic frames with setSchedule(), the arbiter merges them into the driver's schedule table.
+   Call loop() instead of LinDriver::loop().
+*/
+class LinBusArbiter {
+
+  private:
+    LinDriver* linDriver;
+
+    LinBusRequest queue[LIN_ARBITER_QUEUE_SIZE];
+    uint8_t queueCount;
+    uint32_t nextSequence;
+
+    LinBusRequest active;
+    bool activePending;
+    bool busWasBusy;
+    unsigned long busIdleSince;   // micros()
+    unsigned long interFrameSpace;
+
+    bool submit(const LinBusRequest& request);
+    void dispatch(void);
+    void complete(uint8_t result);
+    void removeAt(uint8_t index);
+
+    LinScheduleSegment segments[LIN_ARBITER_MAX_SCHEDULES];
+    LinScheduleSlot schedule[LIN_ARBITER_SCHEDULE_SIZE];
+    uint16_t getCycle(void) const;
+    bool dividersFit(void) const;
+    void buildSchedule(void);
+
+  public:
+    LinBusArbiter(LinDriver* linDriver) {
+      this->linDriver = linDriver;
+      queueCount = 0;
+      nextSequence = 0;
+      activePending = false;
+      busWasBusy = false;
+      busIdleSince = 0;
+      interFrameSpace = LIN_INTER_FRAME_SPACE;
+      memset(segments, 0, sizeof segments);
+    }
+
+    inline void begin(void) {
+      linDriver->begin();
+    }
+
+    inline LinDriver* getDriver(void) {
+      return linDriver;
+    }
+
+    /**
+       Call this method as fast as possible got guarantee fluent operation.
+    */
+    void loop(void);
+
+    // Queue a read, "message" must stay valid until "callback" (same meaning as for LinDriver::recvAsync()) is called.
+    // Returns false if the queue is full.
+    bool read(uint8_t addr, uint8_t* message, uint8_t nBytes, uint8_t proto, LinRequestPriority priority, LinRecvCallback callback, void* context);
+
+    // Queue a write, "message" is copied. "callback" is optional, it is called once the frame is on its way.
+    bool write(uint8_t addr, const uint8_t* message, uint8_t nBytes, uint8_t proto, LinRequestPriority priority, LinRecvCallback callback = 0, void* context = 0);
+
+    template<class Frame>
+    inline bool read(Frame& frame, LinRequestPriority priority, LinRecvCallback callback, void* context) {
+      return read(Frame::id, frame.data, Frame::length, Frame::checksumModel, priority, callback, context);
+    }
+
+    // Drop all queued requests of a client without calling their callbacks. A request already on the bus finishes.
+    void cancel(void* context);
+
+    /**
+       Replace the cyclic frames of "owner" with "count" slots (copied, no idle slots) to be polled every "period" msec,
+       count 0 removes them. The merged table runs at the shortest period of all clients and gives each client an even
+       share of it, slower clients are sub-rated and only take bus time on their own passes. The other clients' phases
+       are not disturbed. Returns false if the merged table would not fit, or if a slot's divider times the sub-rate of its
+       client would not fit the 8 bit divider of the driver's table.
+    */
+    bool setSchedule(void* owner, const LinScheduleSlot* slots, uint8_t count, uint16_t period);
+
+    inline void setInterFrameSpace(unsigned long interFrameSpace) {
+      this->interFrameSpace = interFrameSpace;
+    }
+
+    inline bool isIdle(void) {
+      return 0 == queueCount && !activePending;
+    }
+};
+
+#endif // LIN_BUS_ARBITER_H_
@@ -0,0 +1,157 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef LIN_BUS_SIMULATOR_H_
+#define LIN_BUS_SIMULATOR_H_
+
+#include <Arduino.h>
+#include <Stream.h>
+
+const uint8_t LIN_SIM_MAX_SLAVES = 4;
+const uint8_t LIN_SIM_RX_QUEUE_SIZE = 32;
+const uint8_t LIN_SIM_RX_FIFO_FULL = 112;   // The core's RX FIFO thresholds, restored by begin().
+const uint8_t LIN_SIM_RX_TIMEOUT_BYTES = 2;
+const uint8_t LIN_SIM_HEADER_MAX_BITS = 47; // 1.4 times the nominal 34 bits from the start of the BREAK to the end of the PID.
+const uint8_t LIN_SIM_NO_RESPONSE = 0xff; // publish(): the frame is handled by this node, but nobody answers.
+
+
+/**
+   A slave node on the simulated bus.
+*/
+class LinSimSlave {
+  public:
+    /**
+       Fill "data" with the response to frame "id" and return its length, 0 if this node does not publish "id".
+    */
+    virtual uint8_t publish(uint8_t id, uint8_t* data) = 0;
+
+    /**
+       Checksum byte sent after the response of the last publish(), "checksum" is the correct one.
+       -1 ends the response without a checksum, like a slave that stops in the middle of its frame.
+    */
+    virtual int16_t getChecksum(uint8_t checksum) {
+      return checksum;
+    }
+
+    /**
+       Called for every frame the master published, checksum has been verified already.
+    */
+    virtual void subscribe(uint8_t id, const uint8_t* data, uint8_t nBytes) = 0;
+
+    /**
+       Time in uSec between the end of the header and the first response byte.
+    */
+    virtual unsigned long getResponseDelay(void) {
+      return 0;
+    }
+};
+
+
+/**
+   Stands in for the LIN UART when built with LIN_SIMULATION (see LIN_SERIAL in LinDriver.h).
+   Bytes written by the master occupy the bus for 10 bit times each, slave responses show up in available() and read()
+   only when they would have been shifted in completely and the UART hands them over: once its RX FIFO holds
+   "rxFifoFull" bytes, or after "rxTimeout" byte times without a new byte. The transceiver's echo of master bytes is
+   not modeled.
+*/
+class LinBusSimulator : public Stream {
+
+  private:
+    typedef struct {
+      uint8_t data;
+      unsigned long arrival; // micros()
+    } RxByte;
+
+    LinSimSlave* slaves[LIN_SIM_MAX_SLAVES];
+    uint8_t slaveCount;
+
+    uint32_t baudrate;
+    unsigned long bitTime;     // uSec
+    unsigned long busFreeTime; // micros() when the last queued bit has left the bus.
+    unsigned long breakStart;  // micros() when the last BREAK started.
+    unsigned long breakEnd;
+
+    RxByte rxQueue[LIN_SIM_RX_QUEUE_SIZE];
+    uint8_t rxHead;
+    uint8_t rxTail;
+    uint8_t rxHandedOver; // Bytes from rxTail up to here have left the RX FIFO.
+    uint8_t rxFifoFull;
+    uint8_t rxTimeout;    // Byte times
+
+    // Master frame being assembled: sync, PID, data and checksum.
+    uint8_t frame[11];
+    uint8_t frameLength;
+    bool frameResponded;
+
+    uint32_t headerCount;
+    uint32_t longHeaderCount;
+    uint32_t responseCount;
+    uint32_t masterFrameCount;
+
+    unsigned long occupyBus(uint8_t bits);
+    void queueRx(uint8_t data, unsigned long arrival);
+    void updateRxFifo(void);
+    void onHeader(uint8_t pid);
+    void deliverMasterFrame(void);
+
+  public:
+    LinBusSimulator(void);
+
+    void attach(LinSimSlave* slave);
+
+    static uint8_t checksum(uint8_t pid, const uint8_t* data, uint8_t nBytes);
+
+    // HardwareSerial like interface used by LinDriver.
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1);
+    void end(void);
+    // Like the ESP32's UART_TXD_BRK: the BREAK goes out on its own, isBreakDone() tells when it is over.
+    void sendBreak(void);
+    inline bool isBreakDone(void) {
+      return (long)(micros() - breakEnd) >= 0;
+    }
+    // Like conf1.rxfifo_full_thrhd and conf1.rx_tout_thrhd of the ESP32 UART.
+    inline void setRxFifoThresholds(uint8_t full, uint8_t timeoutBytes) {
+      rxFifoFull = max(full, (uint8_t) 1);
+      rxTimeout = max(timeoutBytes, (uint8_t) 1);
+    }
+
+    int available(void);
+    int read(void);
+    int peek(void);
+    void flush(void);
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* buffer, size_t size);
+
+    inline uint32_t getHeaderCount(void) {
+      return headerCount;
+    }
+
+    // Headers longer than LIN_SIM_HEADER_MAX_BITS, ignored by the slaves.
+    inline uint32_t getLongHeaderCount(void) {
+      return longHeaderCount;
+    }
+
+    inline uint32_t getResponseCount(void) {
+      return responseCount;
+    }
+
+    inline uint32_t getMasterFrameCount(void) {
+      return masterFrameCount;
+    }
+};
+
+#endif // LIN_BUS_SIMULATOR_H_
@@ -0,0 +1,103 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef LIN_CAPTURE_H_
+#define LIN_CAPTURE_H_
+
+#include <Arduino.h>
+
+const uint16_t LIN_CAPTURE_SIZE = 512; // Records, must be a power of two. 6 bytes each.
+const uint8_t LIN_CAPTURE_VERSION = 1;
+
+typedef enum {
+  kLcrHeader = 1,         // data: protected ID
+  kLcrByte = 2,           // data: response (or published) data byte
+  kLcrChecksumOk = 3,     // data: checksum byte
+  kLcrChecksumError = 4,  // data: checksum byte as received
+  kLcrTimeout = 5,        // data: number of bytes received before the timeout
+} LinCaptureRecordType;
+
+typedef struct __attribute__((packed)) {
+  uint32_t timestamp; // micros()
+  uint8_t type;       // LinCaptureRecordType
+  uint8_t data;
+} LinCaptureRecord;
+
+// Start of an exported capture, followed by "count" LinCaptureRecords. All fields little endian.
+typedef struct __attribute__((packed)) {
+  char magic[4];      // "LINC"
+  uint8_t version;
+  uint8_t recordSize;
+  uint16_t count;
+  uint32_t dropped;   // Records lost since the last export because the buffer was full.
+  uint32_t baudrate;
+} LinCaptureHeader;
+
+
+/**
+   Fixed size ring buffer of timestamped LIN bus events. push() is called by LinDriver only, read() by one consumer
+   (e.g. the web server), so head and tail each have a single writer and no lock is needed. Nothing is allocated,
+   when the buffer is full new records are counted as dropped.
+*/
+class LinCapture {
+
+  private:
+    LinCaptureRecord records[LIN_CAPTURE_SIZE];
+    volatile uint16_t head; // Written by the producer only.
+    volatile uint16_t tail; // Written by the consumer only.
+    volatile uint32_t dropped;
+
+  public:
+    LinCapture(void) {
+      head = 0;
+      tail = 0;
+      dropped = 0;
+    }
+
+    inline void push(LinCaptureRecordType type, uint8_t data, uint32_t timestamp = micros()) {
+      uint16_t next = (head + 1) & (LIN_CAPTURE_SIZE - 1);
+      if (next == tail) {
+        ++dropped;
+        return;
+      }
+      records[head].timestamp = timestamp;
+      records[head].type = type;
+      records[head].data = data;
+      head = next;
+    }
+
+    inline uint16_t available(void) {
+      return (head - tail) & (LIN_CAPTURE_SIZE - 1);
+    }
+
+    /**
+       Fill "header" for an export of up to "maxRecords" records and reset the dropped counter.
+       @return Number of records the export will contain.
+    */
+    uint16_t beginExport(LinCaptureHeader* header, uint32_t baudrate, uint16_t maxRecords = LIN_CAPTURE_SIZE);
+
+    /**
+       Move up to "count" records into "buffer", oldest first.
+       @return Number of records copied.
+    */
+    uint16_t read(LinCaptureRecord* buffer, uint16_t count);
+};
+
+static_assert(0 == (LIN_CAPTURE_SIZE & (LIN_CAPTURE_SIZE - 1)), "LIN_CAPTURE_SIZE must be a power of two.");
+static_assert(6 == sizeof(LinCaptureRecord), "LinCaptureRecord must stay packed.");
+
+#endif // LIN_CAPTURE_H_
@@ -0,0 +1,122 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#ifndef LIN_CAPTURE_REPLAY_H_
+#define LIN_CAPTURE_REPLAY_H_
+
+#include <Arduino.h>
+#include "LinCapture.h"
+#include "LinBusSimulator.h"
+
+const uint16_t LIN_REPLAY_SIZE = 4096; // Records, 6 bytes each.
+const uint16_t LIN_REPLAY_NONE = 0xffff;
+
+
+/**
+   Slave node for the LIN bus simulator that answers with the responses of an exported LinCapture (see /lin/capture),
+   byte for byte including bad checksums, cut off frames and missing responses. Each header is answered with the latest
+   recorded frame of its ID at the current position of the recording, or with its first one if the position has not
+   got there yet, so the own schedule does not need to match the recorded one. The position starts with the first
+   header answered and runs "speed" times faster than real time.
+   Only the frames in the frame mask are replayed, the others are left to the other nodes. By default these are the
+   diagnostic frames (0x3C, 0x3D), they depend on the own requests.
+*/
+class LinCaptureReplay : public LinSimSlave {
+
+  private:
+    LinCaptureHeader header;
+    LinCaptureRecord records[LIN_REPLAY_SIZE];
+    uint32_t loaded;    // Bytes taken by load(), header first.
+    uint16_t count;
+    uint16_t origin;    // First header record in the frame mask, position 0.
+
+    uint64_t frameMask; // Bit n: replay frame ID n.
+    uint16_t cursor[64]; // Per frame ID: header record of the frame being replayed, LIN_REPLAY_NONE before the first.
+    bool running;
+    uint8_t speed;
+    unsigned long bitTime;   // uSec
+    bool clockRunning;
+    unsigned long lastUpdate; // micros()
+    uint64_t position;       // uSec since the first record.
+
+    int16_t checksum;        // Of the frame published last, -1 if it was cut off.
+    unsigned long responseDelay;
+
+    uint32_t replayed;
+    uint32_t silent;
+
+    uint16_t findHeader(uint16_t from, uint8_t id);
+
+  public:
+    LinCaptureReplay(void);
+
+    // Drop the recording, following load() calls start a new one.
+    void clear(void);
+
+    /**
+       Append the next "length" bytes of an exported capture, header first. Chunks may split records.
+       @return Bytes taken, less than "length" once LIN_REPLAY_SIZE records are loaded.
+    */
+    size_t load(const uint8_t* data, size_t length);
+
+    /**
+       Replay the loaded recording from its start.
+       @return false if no valid capture with frames in the frame mask has been loaded.
+    */
+    bool start(uint8_t speed = 1);
+
+    // E.g. to leave out frames the own master publishes. clear() restores the default.
+    inline void setFrameMask(uint64_t frameMask) {
+      this->frameMask = frameMask;
+    }
+
+    inline void stop(void) {
+      running = false;
+    }
+
+    inline bool isRunning(void) {
+      return running;
+    }
+
+    inline uint16_t getRecordCount(void) {
+      return count;
+    }
+
+    inline uint64_t getPosition(void) { // uSec since the first replayed frame
+      return position;
+    }
+
+    // Headers answered with a recorded response, and headers left unanswered because the recorded frame had none.
+    inline uint32_t getReplayedCount(void) {
+      return replayed;
+    }
+
+    inline uint32_t getSilentCount(void) {
+      return silent;
+    }
+
+    uint8_t publish(uint8_t id, uint8_t* data);
+    void subscribe(uint8_t id, const uint8_t* data, uint8_t nBytes);
+    int16_t getChecksum(uint8_t checksum);
+
+    unsigned long getResponseDelay(void) {
+      return responseDelay;
+    }
+};
+
+#endif // LIN_CAPTURE_REPLAY_H_
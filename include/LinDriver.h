@@ -27,18 +27,39 @@
 
 #include <Arduino.h>
 #include <HardwareSerial.h>
+#include "LinFrame.h"
+#include "LinCapture.h"
 
+// Build with -D LIN_SIMULATION to run the driver against the simulated bus instead of the UART.
+#ifdef LIN_SIMULATION
+#include "LinBusSimulator.h"
+#define LIN_SERIAL LinBusSimulator
+#else
 #define LIN_SERIAL HardwareSerial
+#ifdef ESP32
+#define LIN_HARDWARE_BREAK
+#include <soc/uart_struct.h>
+#endif
+#endif
 
 const uint8_t LIN_BREAK_DURATION = 15;    // Number of bits in the break.
-const uint8_t LIN_TIMEOUT_IN_FRAMES = 2;     // Wait this many max frame times before declaring a read timeout.
+const uint8_t LIN_HEADER_RETRIES = 2;     // Headers restarted after the break delimiter grew too long.
+const uint8_t LIN_TIMEOUT_IN_FRAMES = 2;     // Upper bound for any request, in max frame times of an 8 byte frame.
+// The core lets the UART hand received bytes over at 112 bytes in its RX FIFO or after 2 byte times of idle line, so a
+// response would only show up once it is complete. begin() lowers both thresholds.
+const uint8_t LIN_RX_FIFO_FULL = 1;          // Bytes in the RX FIFO that are handed over at once.
+const uint8_t LIN_RX_TIMEOUT_BYTES = 1;      // Idle byte times after which fewer bytes are handed over.
+const uint8_t LIN_RX_LATENCY_BYTES = 1;      // The UART hands received bytes over up to this many byte times late.
+
+const uint8_t LIN_MONITOR_FRAME_GAP = 30;  // Bit times of bus idle that end a frame in monitor mode.
+
+const uint8_t LIN_SCHEDULE_TIME_BASE = 5;  // msec. Slot times derived from the frame length are rounded up to a multiple of this.
 
 const uint8_t LIN_HEADER_BREAK = 0x80;
 const uint8_t LIN_HEADER_SYNC = 0x55;
 
-// This code allows you to derive from the LINFrame class to define messages of different lengths and therefore save a few bytes of RAM.  But it relies on the compiler laying out the class memory in RAM so that the derived class data directly follows the base class.
-// If this is not the case in your system, the easiest way to get something working is to only allow full frames, as shown in the #else clause.
-// Also, you can over-malloc the LINFrame class to create an extended data buffer.  Of course this method has its own memory management overhead.
+// Frames of different lengths are described by the LinFrame template (see LinFrame.h), which only takes RAM for its data bytes.
+// Its ID, protected ID, length and checksum model are compile time constants picked up by linReadSlot() and LinBusArbiter::read().
 
 enum
 {
@@ -46,17 +67,135 @@ enum
   Lin2Frame = 1,
   LinWriteFrame  = 0,
   LinReadFrame   = 2,
+  LinIdleSlot    = 4,   // Schedule slot without a frame, it just lets the slot time pass.
 };
 
+typedef enum {
+  kLdlsIdle,       // No request running, the bus is free.
+  kLdlsBreak,      // UART hardware is shifting out the BREAK.
+  kLdlsHeader,     // Header (break, sync, ID), and for writes the data, is still being shifted out.
+  kLdlsResponse,   // Collecting the slave's response bytes.
+  kLdlsMonitor,    // Passive, only listening to another master's traffic.
+} LinDriverLoopState;
+
+const uint8_t LIN_LATENCY_BUCKETS = 8;        // Response latency histogram, bucket i counts latencies below LIN_LATENCY_BUCKET_BASE << i,
+const uint16_t LIN_LATENCY_BUCKET_BASE = 250; // uSec, the last bucket takes everything above.
+
+// Health of one frame ID, counters saturate instead of wrapping.
+typedef struct {
+  uint16_t requests;         // Reads and writes started.
+  uint16_t responses;        // Reads answered with a good checksum.
+  uint16_t timeouts;         // Reads without any response byte.
+  uint16_t incomplete;       // Reads that timed out after some bytes.
+  uint16_t checksumErrors;
+  uint16_t echoBytes;        // Stray break/sync bytes in front of a response.
+  uint16_t headerAborts;     // Headers dropped because sync and ID would have ended them later than allowed.
+  uint32_t bytesExpected;    // Data and checksum bytes of all reads.
+  uint32_t bytesReceived;
+  uint16_t latency[LIN_LATENCY_BUCKETS]; // Time from the end of the header to the first response byte.
+} LinFrameStats;
+
+// Completion callback for asynchronous requests. "result" has the same meaning as the return value of recv().
+typedef void (*LinRecvCallback)(void* context, uint8_t addr, uint8_t* message, uint8_t result);
+
+// One entry of a schedule table. "flags" combines Lin1Frame/Lin2Frame with LinReadFrame/LinWriteFrame or is LinIdleSlot.
+// For read frames "message" receives the response and "callback" is called on completion, for write frames "message" is sent.
+typedef struct {
+  uint8_t addr;
+  uint8_t flags;
+  uint8_t nBytes;
+  uint16_t delay;      // msec until the next slot starts, 0 derives the slot time from nBytes (see getFrameSlotTime()).
+  uint8_t* message;
+  LinRecvCallback callback;
+  void* context;
+  uint8_t divider;     // Run the slot only on every "divider"th pass through the table, 0 or 1 runs it on every pass.
+  uint8_t phase;       // Pass (modulo "divider") the slot runs on. Skipped slots take no time.
+} LinScheduleSlot;
+
+// Read slot for a LinFrame descriptor, the response is received into "frame".
+template<class Frame>
+inline LinScheduleSlot linReadSlot(Frame& frame, LinRecvCallback callback, void* context, uint8_t divider = 1, uint8_t phase = 0) {
+  return {Frame::id, uint8_t((kLinChecksumEnhanced == Frame::checksumModel ? Lin2Frame : Lin1Frame) | LinReadFrame), Frame::length, 0,
+          frame.data, callback, context, divider, phase};
+}
+
 
 class LinDriver
 {
   protected:
-    void headerBreak(void);
+    // Start the BREAK. Returns true if the BREAK is complete already, otherwise isBreakDone() tells when it is.
+    bool headerBreak(void);
+    bool isBreakDone(void);
+    void endBreak(void);
+    void startHeader(void);
+    void sendHeaderTail(void);
     // For Lin 1.X "start" should = 0, for Lin 2.X "start" should be the addr byte.
     uint8_t dataChecksum(const uint8_t* message, char nBytes, uint16_t start = 0);
     uint8_t addrParity(uint8_t addr);
 
+    LinDriverLoopState loopState;
+    unsigned long requestStart;  //  micros() when the current request's header was started.
+    unsigned long lastResponsePoll; //  micros() of the previous look for response bytes.
+    unsigned long headerTime;    //  Time in uSec to shift out sync and ID byte after the break.
+    unsigned long headerMaxTime; //  uSec from the start of the break until the end of the ID byte, 1.4 times the nominal 34 bits.
+    uint8_t headerRetries;
+    uint8_t requestAddr;
+    uint8_t requestIdByte;
+    uint8_t* requestMessage;
+    uint8_t requestNBytes;
+    uint8_t requestProto;
+    bool requestWrite;
+    uint8_t txMessage[9];        //  Copy of a frame to send, data bytes plus checksum.
+    uint8_t bytesRcvd;
+    unsigned long requestTimeout;    //  uSec after the header until the response must be complete. Writes: until the frame is out.
+    unsigned long firstByteTimeout;  //  uSec after the header until the first response byte must be there.
+    bool adaptiveTimeouts;
+    uint16_t responseLatency[64];    //  Learned uSec until a slave's first response byte, per frame ID. 0 = unknown.
+    LinFrameStats frameStats[64];
+    uint8_t result;
+    LinRecvCallback requestCallback;
+    void* requestContext;
+#ifdef LIN_HARDWARE_BREAK
+    uart_dev_t* uartDev;         //  UART registers behind "serial", used for the hardware BREAK.
+#endif
+
+    const LinScheduleSlot* scheduleTable;
+    uint8_t scheduleCount;
+    uint8_t scheduleIndex;
+    uint16_t schedulePass;
+    unsigned long nextSlotTime;  //  millis() when the next schedule slot is due.
+
+    LinCapture* capture;
+    unsigned long monitorFrameGap;  //  uSec of bus idle that end a frame in monitor mode.
+    unsigned long monitorLastByte;  //  micros() of the last byte seen in monitor mode.
+    bool monitorSync;               //  Sync byte seen, the next byte is the protected ID.
+    bool monitorHeader;             //  Header complete, bytes belong to the response.
+    uint8_t monitorPid;
+    uint8_t monitorFrame[9];        //  Response bytes including the checksum.
+    uint8_t monitorLength;
+
+    inline void record(LinCaptureRecordType type, uint8_t data, unsigned long timestamp = micros()) {
+      if (capture) {
+        capture->push(type, data, timestamp);
+      }
+    }
+
+    // "exact": the first byte was seen within a byte time of its arrival, so "latency" is the slave's and not the main loop's.
+    void learnResponseLatency(unsigned long latency, bool exact);
+
+    static inline void countUp(uint16_t& counter) {
+      if (0xffff != counter) {
+        ++counter;
+      }
+    }
+
+    void changeLoopState(LinDriverLoopState newState);
+    void finishRequest(uint8_t result);
+    void runSchedule(void);
+    void nextScheduleSlot(void);
+    void monitorLoop(void);
+    void endMonitorFrame(void);
+
   public:
     LinDriver(LIN_SERIAL* serial, uint8_t txePin, uint8_t rxPin, uint8_t txPin, uint32_t baudrate = 19200);
     LIN_SERIAL* serial;
@@ -65,16 +204,92 @@ class LinDriver
     uint8_t txePin;              //  Pin for "transmit enable" (Need to be pulled down for receive data. )
     uint32_t baudrate;           //  in bits/sec. Also called baud rate
     uint8_t serialOn;            //  whether the serial port is "begin"ed or "end"ed.  Optimization so we don't begin twice.
-    unsigned long int timeout;   //  How long to wait for a slave to fully transmit when doing a "read".  You can modify this after calling "begin"
+    unsigned long int timeout;   //  Upper bound in uSec for a single request, responses usually time out much earlier (see getResponseTimeout()).  You can modify this after calling "begin"
 
     void begin(void);
 
-    // Send a message right now, ignoring the schedule table.
+    // Run "table" cyclically from within loop(), one slot after the other. The table must stay valid while it is active.
+    // Pass 0 to stop the schedule, e.g. to do diagnostic requests in between. Replacing a table keeps the pass count and
+    // slot timing, so slot phases carry on; a pass that is under way ends early.
+    void setScheduleTable(const LinScheduleSlot* table, uint8_t count);
+
+    inline bool isScheduleActive(void) {
+      return 0 != scheduleCount;
+    }
+
+    // The pass the schedule table starts next, phases are relative to it.
+    inline uint16_t getNextSchedulePass(void) {
+      return (0 == scheduleIndex) ? schedulePass : schedulePass + 1;
+    }
+
+    // Record headers, data bytes, checksum results and timeouts into "capture", 0 stops recording.
+    inline void setCapture(LinCapture* capture) {
+      this->capture = capture;
+    }
+
+    // In monitor mode the driver never drives the bus. It decodes the frames of another master and only records them,
+    // send() and recv() are ignored and the schedule table pauses until monitor mode is left again.
+    void setMonitorMode(bool enable);
+
+    inline bool isMonitorMode(void) {
+      return kLdlsMonitor == loopState;
+    }
+
+    // Maximum frame time (LIN 2.x: 1.4 * nominal) for a response of "nBytes" data bytes, rounded up to LIN_SCHEDULE_TIME_BASE. In msec.
+    uint16_t getFrameSlotTime(uint8_t nBytes);
+
+    // Time in uSec a slave may take for a response of "nBytes" data bytes after the header (LIN 2.x: 1.4 * nominal), plus UART latency.
+    unsigned long getResponseTimeout(uint8_t nBytes);
+
+    // Time in uSec until the first response byte must have arrived. Without it the request is aborted early, which
+    // makes probing for slaves that are not there cheap. In adaptive mode the latency learned for "addr" tightens it,
+    // an "addr" above 0x3f always gives the spec value.
+    unsigned long getFirstByteTimeout(uint8_t addr, uint8_t nBytes);
+
+    // Learn every slave's real response latency and abort requests once a response is clearly overdue.
+    // A request aborted on a learned latency forgets it, so a slow slave costs only a single retry.
+    inline void setAdaptiveTimeouts(bool enable) {
+      adaptiveTimeouts = enable;
+    }
+
+    inline uint16_t getResponseLatency(uint8_t addr) {
+      return responseLatency[addr & 0x3f];
+    }
+
+    inline const LinFrameStats& getFrameStats(uint8_t addr) {
+      return frameStats[addr & 0x3f];
+    }
+
+    inline void resetFrameStats(void) {
+      memset(frameStats, 0, sizeof frameStats);
+    }
+
+    // Send a message right now, ignoring the schedule table. The frame is queued and shifted out by loop(),
+    // this only waits if another request is still running.
     void send(uint8_t addr, const uint8_t* message, uint8_t nBytes, uint8_t proto = 2);
 
     // Receive a message right now, returns 0xff if good checksum, # bytes received (including checksum) if checksum is bad.
+    // This blocks until the response is complete or timed out, prefer recvAsync() from within loop() functions.
     uint8_t recv(uint8_t addr, uint8_t* message, uint8_t nBytes, uint8_t proto = 2);
 
+    // Start receiving a message and return at once. The response is collected by loop(), "message" must stay valid until then.
+    // Completion is reported to "callback" (if given) and by isBusy() turning false, getResult() then follows recv()'s return value.
+    // Returns false if another request is still running.
+    bool recvAsync(uint8_t addr, uint8_t* message, uint8_t nBytes, uint8_t proto = 2, LinRecvCallback callback = 0, void* context = 0);
+
+    /**
+       Call this method as fast as possible got guarantee fluent operation.
+    */
+    void loop(void);
+
+    inline bool isBusy(void) {
+      return kLdlsIdle != loopState;
+    }
+
+    inline uint8_t getResult(void) {
+      return result;
+    }
+
     void busSleep(void);
 
     inline uint8_t bitExtract(uint8_t data, uint8_t shift) {
@@ -0,0 +1,86 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef LIN_FRAME_H_
+#define LIN_FRAME_H_
+
+#include <Arduino.h>
+
+
+// Values match the "proto" argument of LinDriver.
+typedef enum {
+  kLinChecksumClassic = 1,   // LIN 1.x, data bytes only. Always used for diagnostic frames 0x3C/0x3D.
+  kLinChecksumEnhanced = 2,  // LIN 2.x, data bytes and protected ID.
+} LinChecksumModel;
+
+
+constexpr uint8_t linIdBit(uint8_t id, uint8_t bit) {
+  return (id >> bit) & 0x01;
+}
+
+/**
+   Protected identifier: 6 bit frame ID plus parity bits P0 (bit 6) and P1 (bit 7).
+   Usable in constant expressions, so frame descriptors and tables get their PID at compile time.
+*/
+constexpr uint8_t linProtectedId(uint8_t id) {
+  return (id & 0x3f)
+         | ((linIdBit(id, 0) ^ linIdBit(id, 1) ^ linIdBit(id, 2) ^ linIdBit(id, 4)) << 6)
+         | ((1 ^ linIdBit(id, 1) ^ linIdBit(id, 3) ^ linIdBit(id, 4) ^ linIdBit(id, 5)) << 7);
+}
+
+static_assert(0x3C == linProtectedId(0x3C), "PID of the master request frame must be 0x3C.");
+static_assert(0x7D == linProtectedId(0x3D), "PID of the slave response frame must be 0x7D.");
+
+// All 64 protected IDs, indexed by frame ID. Lives in flash, see LinDriver.cpp.
+extern const uint8_t LIN_PID_TABLE[64];
+
+
+/**
+   Compile time descriptor of a LIN frame. ID, PID, length and checksum model are constants, only the data bytes take RAM.
+   Derive from it to give the fields of a frame names, get<>() checks field positions against the frame length.
+*/
+template<uint8_t ID, uint8_t LENGTH, LinChecksumModel CHECKSUM = kLinChecksumEnhanced>
+struct LinFrame {
+  static_assert(ID < 0x40, "LIN frame IDs have 6 bits.");
+  static_assert(0 < LENGTH && LENGTH <= 8, "LIN frames carry 1 to 8 data bytes.");
+
+  static constexpr uint8_t id = ID;
+  static constexpr uint8_t pid = linProtectedId(ID);
+  static constexpr uint8_t length = LENGTH;
+  static constexpr LinChecksumModel checksumModel = CHECKSUM;
+
+  uint8_t data[LENGTH];
+
+  // Little endian unsigned field of N bytes starting at data byte OFFSET.
+  template<uint8_t OFFSET, uint8_t N>
+  inline uint32_t get(void) const {
+    static_assert(0 < N && N <= 4, "Fields are 1 to 4 bytes wide.");
+    static_assert(OFFSET + N <= LENGTH, "Field exceeds the frame length.");
+    uint32_t value = 0;
+    for (uint8_t i = N; i > 0; --i) {
+      value = (value << 8) | data[OFFSET + i - 1];
+    }
+    return value;
+  }
+};
+
+template<uint8_t ID, uint8_t LENGTH, LinChecksumModel CHECKSUM> constexpr uint8_t LinFrame<ID, LENGTH, CHECKSUM>::id;
+template<uint8_t ID, uint8_t LENGTH, LinChecksumModel CHECKSUM> constexpr uint8_t LinFrame<ID, LENGTH, CHECKSUM>::pid;
+template<uint8_t ID, uint8_t LENGTH, LinChecksumModel CHECKSUM> constexpr uint8_t LinFrame<ID, LENGTH, CHECKSUM>::length;
+template<uint8_t ID, uint8_t LENGTH, LinChecksumModel CHECKSUM> constexpr LinChecksumModel LinFrame<ID, LENGTH, CHECKSUM>::checksumModel;
+
+#endif // LIN_FRAME_H_
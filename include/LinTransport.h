@@ -0,0 +1,155 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef LIN_TRANSPORT_H_
+#define LIN_TRANSPORT_H_
+
+#include <Arduino.h>
+#include "LinBusArbiter.h"
+
+const uint8_t LIN_TP_MAX_LENGTH = 32;       // Longest request or response PDU (SID/RSID plus data) handled here.
+const uint8_t LIN_TP_QUEUE_SIZE = 8;        // Requests that can be queued: one pipelined exchange plus another client's.
+const uint16_t LIN_TP_P2_MIN = 50;          // msec between the last master request frame and the first response header.
+const uint16_t LIN_TP_POLL_INTERVAL = 10;   // msec between slave response headers while the slave has nothing to say.
+const uint16_t LIN_TP_RESPONSE_TIMEOUT = 1000; // msec the slave may take to start its response, by default.
+const uint8_t LIN_TP_PENDING_MAX = 20;      // "Response pending" answers after which a request gives up.
+
+const uint8_t LIN_NAD_BROADCAST = 0x7F;
+const uint8_t LIN_SID_NEGATIVE_RESPONSE = 0x7F;
+const uint8_t LIN_NRC_RESPONSE_PENDING = 0x78;
+
+typedef enum {
+  kLtrOk,
+  kLtrNoResponse,
+  kLtrNegativeResponse,  // The slave answered with RSID 0x7F, the response holds SID and error code.
+  kLtrProtocolError,     // Unexpected PCI, NAD, RSID or sequence number, or a frame with a bad checksum.
+} LinTransportResult;
+
+typedef enum {
+  kLtlsIdle,
+  kLtlsSendFrame,       // Next master request frame (SF, FF or CF) is due once stMin has passed.
+  kLtlsFrameSent,       // Master request frame is queued at the bus arbiter.
+  kLtlsPollResponse,    // Waiting before the next slave response header.
+  kLtlsRecvFrame,       // Slave response frame is being received.
+} LinTransportLoopState;
+
+// Completion of a request. "response" is the response PDU starting with the RSID, it is only valid during the call.
+typedef void (*LinTransportCallback)(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result);
+
+typedef struct {
+  uint8_t nad;
+  uint8_t pdu[LIN_TP_MAX_LENGTH];
+  uint16_t length;
+  bool expectResponse;
+  uint16_t responseTimeout;  // msec
+  LinTransportCallback callback;
+  void* context;
+} LinTransportRequest;
+
+
+/**
+   LIN 2.x transport layer for diagnostic services on top of the LIN bus arbiter. Request PDUs are split into single frame (SF)
+   or first and consecutive frames (FF, CF) on 0x3C, the slave's response is polled on 0x3D and reassembled the same way.
+   Requests queue up and run back to back, each one starting as soon as the previous response is complete.
+*/
+class LinTransport {
+
+  private:
+    LinBusArbiter* linArbiter;
+    LinRequestPriority priority;
+
+    LinTransportRequest queue[LIN_TP_QUEUE_SIZE];
+    uint8_t queueHead;
+    uint8_t queueCount;
+
+    uint16_t p2Min;
+    uint16_t stMin;
+
+    uint16_t txOffset;
+    uint8_t txSequence;
+    uint8_t txFrame[8];
+    bool txDone;
+
+    uint8_t rxFrame[8];
+    uint8_t rxBuffer[LIN_TP_MAX_LENGTH];
+    uint16_t rxLength;
+    uint16_t rxExpected;        // Response length announced by the first frame, 0 before it.
+    uint8_t rxSequence;
+    bool rxDone;
+    uint8_t rxResult;
+    uint16_t pollDelay;
+    unsigned long responseStart;
+    uint8_t pendingCount;
+
+    unsigned long lastLoopStateChange;
+    LinTransportLoopState loopState;
+
+    void changeLoopState(LinTransportLoopState newState);
+    bool sendNextFrame(void);
+    void receiveFrame(void);
+    void finish(LinTransportResult result);
+    static void onRequestFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result);
+    static void onResponseFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result);
+
+  public:
+    LinTransport(void) {
+      linArbiter = 0;
+      priority = kLinPriorityDiagnostic;
+      queueHead = 0;
+      queueCount = 0;
+      p2Min = LIN_TP_P2_MIN;
+      stMin = 0;
+      changeLoopState(kLtlsIdle);
+    }
+
+    void setup(LinBusArbiter* linArbiter, LinRequestPriority priority = kLinPriorityDiagnostic);
+
+    /**
+       Call this method as fast as possible got guarantee fluent operation.
+    */
+    void loop(void);
+
+    /**
+       Queue the diagnostic request "pdu" (SID and data) for slave "nad". "callback" gets the response once it is complete,
+       or kLtrNoResponse if the slave has not started it within "responseTimeout" msec. Each "response pending" negative
+       response restarts the timeout.
+       @return false if the queue is full or the PDU is too long.
+    */
+    bool request(uint8_t nad, const uint8_t* pdu, uint16_t length, LinTransportCallback callback = 0, void* context = 0, bool expectResponse = true,
+                 uint16_t responseTimeout = LIN_TP_RESPONSE_TIMEOUT);
+
+    // Drop all queued requests without calling their callbacks. A frame already on the bus is finished by the driver.
+    void cancel(void);
+
+    // Drop the requests of one client without calling their callbacks. A request in progress runs to its end silently.
+    void cancel(void* context);
+
+    // True while requests of "context" are queued or in progress.
+    bool isPending(void* context);
+
+    // "p2Min": msec before the first response header, "stMin": msec between two master request frames.
+    inline void setTiming(uint16_t p2Min, uint16_t stMin) {
+      this->p2Min = p2Min;
+      this->stMin = stMin;
+    }
+
+    inline bool isBusy(void) {
+      return 0 != queueCount;
+    }
+};
+
+#endif // LIN_TRANSPORT_H_
@@ -36,6 +36,10 @@ MenuBatteryStatus() {
 
 virtual void updateBatteryIndicator(uint16_t batteryX, uint16_t batteryY, uint16_t batteryWidth, uint16_t batteryHeight);
 virtual void drawBatteryIndicator(uint16_t x, uint16_t y, uint8_t w, uint8_t h, uint8_t poleH, uint8_t poleW);
+/**
+   Time to empty or full as "hh:mm", "x" and "y" as for updateDisplayText().
+ */
+virtual void updateRuntimeIndicator(uint16_t x, uint16_t y);
 
 };
 
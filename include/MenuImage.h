@@ -0,0 +1,48 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#ifndef MENU_IMAGE_H_
+#define MENU_IMAGE_H_
+
+#include <Arduino.h>
+
+typedef enum {
+  kMenuImageRgb565, // Pixels are RGB565, little endian.
+  kMenuImagePalette, // Pixels are one byte indices into the palette.
+} MenuImageFormat;
+
+/**
+   Run length encoded image, generated from images/ by scripts/menu_images.py.
+
+   Every row starts at rowOffsets[row] in data, so any band of rows can be drawn on its own. A row is a sequence of
+   packets: a header byte with the repeat flag in bit 7 and the length - 1 in bits 0-5, plus the next byte shifted
+   by 6 if bit 6 is set. A repeat packet is followed by one pixel, a literal packet by "length" pixels.
+*/
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+  uint8_t format; // MenuImageFormat
+  bool transparent; // Pixels equal to transparentKey take the background color.
+  uint16_t transparentKey; // Palette index or RGB565 value.
+  const uint16_t* palette; // kMenuImagePalette only.
+  const uint16_t* rowOffsets; // Images are limited to 64 KB of data.
+  const uint8_t* data;
+} MenuImage;
+
+
+#endif // MENU_IMAGE_H_
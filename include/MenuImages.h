@@ -0,0 +1,33 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+// Generated by scripts/menu_images.py from images/, do not edit.
+
+#ifndef MENU_IMAGES_H_
+#define MENU_IMAGES_H_
+
+#include "MenuImage.h"
+
+extern const MenuImage roadcruiser_xl; // 310x135
+extern const MenuImage airHeater; // 30x28
+extern const MenuImage waterHeater; // 30x26
+extern const MenuImage tcombi; // 48x39
+extern const MenuImage temperature; // 17x36
+extern const MenuImage wifiIndicator; // 24x17
+
+#endif // MENU_IMAGES_H_
@@ -20,34 +20,15 @@
 
 #include "debug.h"
 #include "defaults.h"
+#include "DisplayStream.h"
+#include "MenuImage.h"
+#include "MenuWidget.h"
 #include <Arduino.h>
 
 #include <Adafruit_ILI9341.h>
 
 
-#define RUN_LENGTH_DECODE(image_buf, rle_data, size, bpp) do \
-        { uint8_t __bpp; uint8_t *__ip; const uint8_t *__il, *__rd; \
-          __bpp = (bpp); __ip = (image_buf); __il = __ip + (size) * __bpp; \
-          __rd = (rle_data); if (__bpp > 3) { /* RGBA */ \
-                  while (__ip < __il) { uint8_t __l = *(__rd++); \
-                                        if (__l & 128) { __l = __l - 128; \
-                                                         do { memcpy (__ip, __rd, 4); __ip += 4; } while (--__l); __rd += 4; \
-                                        } else { __l *= 4; memcpy (__ip, __rd, __l); \
-                                                 __ip += __l; __rd += __l; } } \
-          } else if (__bpp == 3) { /* RGB */ \
-                  while (__ip < __il) { uint8_t __l = *(__rd++); \
-                                        if (__l & 128) { __l = __l - 128; \
-                                                         do { memcpy (__ip, __rd, 3); __ip += 3; } while (--__l); __rd += 3; \
-                                        } else { __l *= 3; memcpy (__ip, __rd, __l); \
-                                                 __ip += __l; __rd += __l; } } \
-          } else { /* RGB16 */ \
-                  while (__ip < __il) { uint8_t __l = *(__rd++); \
-                                        if (__l & 128) { __l = __l - 128; \
-                                                         do { memcpy (__ip, __rd, 2); __ip += 2; } while (--__l); __rd += 2; \
-                                        } else { __l *= 2; memcpy (__ip, __rd, __l); \
-                                                 __ip += __l; __rd += __l; } } \
-          } } while (0)
-
+const uint16_t MENU_IMAGE_LINE_PIXELS = 480; // Decode buffer, RGB565, less than 1 KB.
 
 class MenuItem {
 
@@ -65,21 +46,13 @@ Adafruit_ILI9341* adaIli9431;
 String headline;
 boolean menuEntered = false;
 
+MenuWidgets widgets; // Dynamic fields, drawn again by commonPrintScreen().
+
 // Helper variables for font size measurements and formatted text display.
 int16_t x1, y1;
 uint16_t w, h;
 char string[64];
 
-/**
-   This type definition mirrors the anonymous struct type which is created using GIMP's export as c-file function.
- */
-typedef struct {
-        uint32_t width;
-        uint32_t height;
-        uint32_t bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-        uint8_t rle_pixel_data[];
-} RleImage;
-
 public:
 MenuItem(Adafruit_ILI9341* adaIli9431) {
         this->adaIli9431 = adaIli9431;
@@ -106,10 +79,11 @@ void setNextMenuItem(MenuItem* item) {
 
 void commonPrintScreen(void) {
         menuEntered = false;
-        adaIli9431->fillRect(0, 0, DISPLAY_W, SCROLLBAR_Y, Defaults.getBgColor());
+        DisplayStream::getInstance().fillRect(adaIli9431, 0, 0, DISPLAY_W, SCROLLBAR_Y, Defaults.getBgColor());
         adaIli9431->setTextColor(Defaults.getFgColor(), Defaults.getBgColor());
         adaIli9431->setCursor(10, Defaults.getFontH());
         adaIli9431->print(headline);
+        widgets.invalidate();
 }
 
 virtual bool isVisible(void) = 0;
@@ -148,16 +122,7 @@ inline boolean isMenuEntered(void) {
 
 
 void updateDisplayText(const char* s, uint16_t x, uint16_t y, uint16_t fgColor, uint16_t bgColor) {
-        int16_t _x1, _y1;
-        uint16_t _w, _h;
-        adaIli9431->getTextBounds(s, 0, 0, &_x1, &_y1, &_w, &_h);
-        uint16_t width = _x1 + _w + 1;
-        // Serial.printf("%s, _x1: %d, _y1: %d, _w: %d, _h: %d\r\n", s, _x1, _y1, _w, _h);
-        GFXcanvas1 canvas(width, Defaults.getFontH());
-        canvas.setFont(Defaults.getFont());
-        canvas.setCursor(0, Defaults.getFontY()+1);
-        canvas.print(s);
-        adaIli9431->drawBitmap(x, y - Defaults.getFontY(), canvas.getBuffer(), width, Defaults.getFontH(), fgColor, bgColor);
+        MenuWidgets::drawText(adaIli9431, s, x, y, fgColor, bgColor);
 }
 
 uint16_t getColorGradient(uint16_t color1, uint16_t color2, uint8_t percent) {
@@ -175,11 +140,54 @@ uint16_t getColorGradient(uint16_t color1, uint16_t color2, uint8_t percent) {
         return (((uint16_t)r & 0x1F) << 11) | (((uint16_t)g & 0x3F) << 5) | ((uint16_t)b & 0x1F);
 }
 
-void drawCompressedImage(uint16_t x, uint16_t y, const RleImage* image) {
-        GFXcanvas16* canvas = new GFXcanvas16(image->width, image->height);
-        RUN_LENGTH_DECODE((uint8_t*)canvas->getBuffer(), image->rle_pixel_data, image->width * image->height, image->bytes_per_pixel);
-        adaIli9431->drawRGBBitmap(x, y, canvas->getBuffer(), image->width, image->height);
-        delete canvas;
+/**
+   Draws rows "firstRow" to "firstRow" + "rows" - 1 of the image, at their place relative to "x" and "y". The rows are
+   decoded into a small line buffer and sent as many at a time as fit.
+ */
+void drawImage(uint16_t x, uint16_t y, const MenuImage* image, uint16_t firstRow = 0, uint16_t rows = 0xffff, uint16_t bgColor = Defaults.getBgColor()) {
+        static uint16_t lines[MENU_IMAGE_LINE_PIXELS];
+        if (0 == image->width || MENU_IMAGE_LINE_PIXELS < image->width || image->height <= firstRow) {
+                return;
+        }
+        uint16_t lastRow = min(uint32_t(image->height), uint32_t(firstRow) + rows);
+        uint16_t chunk = MENU_IMAGE_LINE_PIXELS / image->width;
+        for (uint16_t row = firstRow; row < lastRow; row += chunk) {
+                uint16_t chunkRows = min(chunk, uint16_t(lastRow - row));
+                uint16_t* pixel = lines;
+                for (uint16_t r = row; r < row + chunkRows; ++r) {
+                        const uint8_t* packet = image->data + image->rowOffsets[r];
+                        uint16_t* rowEnd = pixel + image->width;
+                        while (pixel < rowEnd) {
+                                uint8_t header = *(packet++);
+                                uint16_t length = (header & 0x3f) + 1;
+                                if (header & 0x40) {
+                                        length += *(packet++) << 6;
+                                }
+                                length = min(length, uint16_t(rowEnd - pixel));
+                                if (header & 0x80) {
+                                        uint16_t color = readImagePixel(image, packet, bgColor);
+                                        packet += kMenuImagePalette == image->format ? 1 : 2;
+                                        for (uint16_t i = 0; i < length; ++i) {
+                                                *(pixel++) = color;
+                                        }
+                                } else {
+                                        for (uint16_t i = 0; i < length; ++i) {
+                                                *(pixel++) = readImagePixel(image, packet, bgColor);
+                                                packet += kMenuImagePalette == image->format ? 1 : 2;
+                                        }
+                                }
+                        }
+                }
+                DisplayStream::getInstance().drawRGBBitmap(adaIli9431, x, y + row, lines, image->width, chunkRows);
+        }
+}
+
+static inline uint16_t readImagePixel(const MenuImage* image, const uint8_t* pixel, uint16_t bgColor) {
+        uint16_t value = kMenuImagePalette == image->format ? pixel[0] : pixel[0] | (pixel[1] << 8);
+        if (image->transparent && image->transparentKey == value) {
+                return bgColor;
+        }
+        return kMenuImagePalette == image->format ? image->palette[value] : value;
 }
 
 };
@@ -0,0 +1,225 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#ifndef MENU_WIDGET_H_
+#define MENU_WIDGET_H_
+
+#include "debug.h"
+#include "defaults.h"
+#include <Arduino.h>
+
+#include <Adafruit_ILI9341.h>
+
+const uint16_t MENU_WIDGET_SCRATCH_PIXELS = DISPLAY_W * 20; // RGB565, 12.5 KB, one text line of full display width.
+const uint8_t MENU_WIDGET_MAX_COUNT = 16; // Per MenuWidgets.
+const uint8_t MENU_LABEL_LENGTH = 32;
+const char MENU_LABEL_DEGREE = '\xb0'; // Drawn as a small circle, the GFX fonts have no degree sign.
+const uint8_t MENU_GLYPH_MAX_W = 16; // Cell of the glyph atlas, one uint16_t per row.
+const uint8_t MENU_GLYPH_MAX_H = 24;
+
+typedef struct {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+} MenuRect;
+
+/**
+   A retained piece of a menu screen. Setters only mark the widget dirty if its look changes, MenuWidgets::render()
+   draws it later. draw() must cover all pixels of the bounds and draws in display coordinates.
+*/
+class MenuWidget {
+
+  protected:
+    MenuRect bounds;
+    bool dirty;
+
+    /**
+       @return True if the bounds changed.
+    */
+    bool setBounds(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  public:
+    MenuWidget(void);
+
+    inline const MenuRect& getBounds(void) const {
+      return bounds;
+    }
+
+    inline bool isDirty(void) const {
+      return dirty;
+    }
+
+    /**
+       The part of the bounds that has to be sent, only valid while dirty.
+    */
+    virtual MenuRect getDirtyBounds(void) const {
+      return bounds;
+    }
+
+    virtual void invalidate(void) {
+      dirty = true;
+    }
+
+    virtual void clean(void) {
+      dirty = false;
+    }
+
+    virtual void draw(Adafruit_GFX* canvas) = 0;
+};
+
+/**
+   Text in the default font, laid out in fixed character cells. The cells are copied from a glyph atlas and only
+   those whose character changed since the last render are sent.
+*/
+class MenuLabel : public MenuWidget {
+
+  private:
+    char text[MENU_LABEL_LENGTH];
+    char shown[MENU_LABEL_LENGTH]; // As on screen, if shownValid.
+    bool shownValid;
+    uint8_t length;
+    uint16_t fgColor;
+    uint16_t bgColor;
+
+  public:
+    MenuLabel(void);
+
+    /**
+       "x" and "y" as for MenuItem::updateDisplayText(), with room for "length" characters.
+    */
+    void setPosition(uint16_t x, uint16_t y, uint8_t length);
+    void setText(const char* s);
+    void setColors(uint16_t fgColor, uint16_t bgColor);
+
+    MenuRect getDirtyBounds(void) const;
+    void invalidate(void);
+    void clean(void);
+    void draw(Adafruit_GFX* canvas);
+};
+
+/**
+   Fixed point number, composed only when the value changes.
+*/
+class MenuNumber : public MenuLabel {
+
+  private:
+    int32_t value;
+    bool hasValue;
+    uint8_t digits;
+    uint8_t decimals;
+    bool sign;
+    const char* unit;
+
+  public:
+    MenuNumber(void);
+
+    /**
+       @param digits Integer digits, right aligned.
+       @param decimals Digits after the point, setValue() takes the value in units of the last one.
+       @param unit Appended, e.g. "V" or "\xb0" "C".
+       @param sign Always print the sign.
+    */
+    void setFormat(uint8_t digits, uint8_t decimals, const char* unit, bool sign = false);
+    void setValue(int32_t value);
+};
+
+/**
+   Vertical bar filled from the bottom, e.g. a state of charge.
+*/
+class MenuBar : public MenuWidget {
+
+  private:
+    uint8_t percent;
+    uint16_t color;
+    uint16_t bgColor;
+
+  public:
+    MenuBar(void);
+
+    void setPosition(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void setLevel(uint8_t percent, uint16_t color);
+    void setBgColor(uint16_t bgColor);
+
+    void draw(Adafruit_GFX* canvas);
+};
+
+/**
+   Needle moving up and down a vertical scale, e.g. a current.
+*/
+class MenuGauge : public MenuWidget {
+
+  private:
+    int16_t center; // Display Y of the needle at position 0.
+    uint8_t needleH;
+    int16_t position;
+    uint16_t needleColor;
+    uint16_t scaleColor;
+
+  public:
+    MenuGauge(void);
+
+    /**
+       The needle overhangs the scale from "y" to "y" + "h" by half its height.
+    */
+    void setPosition(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t needleH);
+
+    /**
+       @param position Pixels above the centre of the scale.
+    */
+    void setNeedle(int16_t position, uint16_t color);
+    void setScaleColor(uint16_t scaleColor);
+
+    void draw(Adafruit_GFX* canvas);
+};
+
+/**
+   The widgets of one screen. Dirty widgets are rendered into a preallocated scratch buffer and sent with a single
+   address window each; dirty rectangles that together form a rectangle are merged and sent in one go.
+*/
+class MenuWidgets {
+
+  private:
+    MenuWidget* widgets[MENU_WIDGET_MAX_COUNT];
+    uint8_t count;
+
+    void renderRect(Adafruit_ILI9341* display, const MenuRect& rect);
+
+  public:
+    MenuWidgets(void);
+
+    /**
+       Widgets are drawn in the order they are added, later ones on top.
+    */
+    void add(MenuWidget* widget);
+
+    /**
+       Everything is drawn again, e.g. after the screen has been cleared.
+    */
+    void invalidate(void);
+
+    void render(Adafruit_ILI9341* display);
+
+    /**
+       Draws text in the default font through the scratch buffer, see MenuItem::updateDisplayText().
+    */
+    static void drawText(Adafruit_ILI9341* display, const char* s, uint16_t x, uint16_t y, uint16_t fgColor, uint16_t bgColor);
+};
+
+
+#endif // MENU_WIDGET_H_
@@ -41,6 +41,11 @@ typedef enum {
         kPSlotBluetoothPair2,
         kPSlotBluetoothPair3,
         kPSlotBluetoothPair4,
+        kPSlotIbs, // Detected IBS: ibs[] index, variant and battery type.
+        kPSlotIbsEnergy, // Trip and total charge/energy counters.
+        kPSlotIbs2, // As kPSlotIbs and kPSlotIbsEnergy, for the second IBS.
+        kPSlotIbsEnergy2,
+        kPSlotIbs2OnOff, // Second IBS enabled, see Setup menu.
 } PersistenceSlot;
 
 typedef struct {
@@ -81,6 +86,7 @@ class Persistence
     uint8_t writeSlotBoolean(PersistenceSlot slot, const bool active);
     uint8_t writeSlot(PersistenceSlot slot, const String* string);
     uint8_t writeSlot(PersistenceSlot slot, char* data, uint8_t length);
+    bool isSlotValid(PersistenceSlot slot);
     bool readSlotBoolean(PersistenceSlot slot);
     String readSlot(PersistenceSlot slot);
     uint8_t readSlot(PersistenceSlot slot, char* data, uint8_t length);
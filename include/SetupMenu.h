@@ -20,12 +20,31 @@
 
 #include "debug.h"
 #include "MenuItem.h"
+#include "IbsBank.h"
 
 
 class SetupMenu : public MenuItem {
 
 private:
 uint8_t wifiOnOff;
+uint8_t ibs2OnOff;
+IbsBank* ibsBank;
+
+MenuLabel wifiOnOffLabel;
+MenuLabel startWifiConfigLabel;
+MenuLabel wifiSsid;
+MenuLabel wifiIp;
+MenuLabel ibs2OnOffLabel;
+MenuLabel factoryResetLabel;
+
+void addWidgets(void) {
+        widgets.add(&wifiOnOffLabel);
+        widgets.add(&startWifiConfigLabel);
+        widgets.add(&wifiSsid);
+        widgets.add(&wifiIp);
+        widgets.add(&ibs2OnOffLabel);
+        widgets.add(&factoryResetLabel);
+}
 
 void printScreenImplementation(void);
 void updateScreenImplementation(void);
@@ -35,18 +54,25 @@ void onLeaveButtonImplementation(void);
 
 void updateWifiOnOff(uint16_t x, uint16_t y, uint8_t onoff, boolean highlighted, boolean selected);
 void updateWifiSmartConfig(uint16_t x, uint16_t y, uint8_t start, boolean highlighted, boolean selected);
+void updateIbs2OnOff(uint16_t x, uint16_t y, uint8_t onOff, boolean highlighted, boolean selected);
 void updateFactoryReset(uint16_t x, uint16_t y, uint8_t reset, boolean highlighted, boolean selected);
 
 public:
 
-SetupMenu(Adafruit_ILI9341* adaIli9431)
+SetupMenu(Adafruit_ILI9341* adaIli9431, IbsBank* ibsBank)
         : MenuItem(adaIli9431) {
         wifiOnOff = 0xff;
+        ibs2OnOff = 0xff;
+        this->ibsBank = ibsBank;
+        addWidgets();
 }
 
-SetupMenu(Adafruit_ILI9341* adaIli9431, String headline)
+SetupMenu(Adafruit_ILI9341* adaIli9431, String headline, IbsBank* ibsBank)
         : MenuItem(adaIli9431, headline) {
         wifiOnOff = 0xff;
+        ibs2OnOff = 0xff;
+        this->ibsBank = ibsBank;
+        addWidgets();
 }
 
 inline bool isVisible(void) {
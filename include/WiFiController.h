@@ -21,6 +21,9 @@
 #include "debug.h"
 #include <Arduino.h>
 
+const char* const NTP_SERVER = "pool.ntp.org";
+const char* const LOCAL_TIME_ZONE = "CET-1CEST,M3.5.0,M10.5.0/3"; // POSIX TZ, where midnight ends the IBS day totals.
+
 typedef enum {
         kWclsIdle,
         kWclsStartup,
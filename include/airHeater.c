@@ -1,72 +0,0 @@
-/* GIMP RGB C-Source image dump 1-byte-run-length-encoded (airHeater.c) */
-
-#define AIRHEATER_RUN_LENGTH_DECODE(image_buf, rle_data, size, bpp) do \
-{ unsigned int __bpp; unsigned char *__ip; const unsigned char *__il, *__rd; \
-  __bpp = (bpp); __ip = (image_buf); __il = __ip + (size) * __bpp; \
-  __rd = (rle_data); if (__bpp > 3) { /* RGBA */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 4); __ip += 4; } while (--__l); __rd += 4; \
-      } else { __l *= 4; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else if (__bpp == 3) { /* RGB */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 3); __ip += 3; } while (--__l); __rd += 3; \
-      } else { __l *= 3; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else { /* RGB16 */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 2); __ip += 2; } while (--__l); __rd += 2; \
-      } else { __l *= 2; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } } while (0)
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 rle_pixel_data[921 + 1];
-} airHeater = {
-  30, 28, 2,
-  "\241\000\000\003iJ\363\234\212R\207\000\000\003\242\020\363\234\256s\210\000\000\002q\214Q\214"
-  "\207\000\000\004<\347\377\377}\357\347\071\206\000\000\004\367\275\377\377\337\377\216"
-  "s\206\000\000\001\222\224\202\377\377\001\024\245\206\000\000\001y\316\202\377\377\001Y\316"
-  "\206\000\000\001\024\245\202\377\377\002<\347E)\205\000\000\001mk\202\377\377\002\337\377"
-  "\353Z\205\000\000\002\347\071\236\367\202\377\377\001\020\204\206\000\000\001\272\326\202"
-  "\377\377\001\266\265\206\000\000\001\266\265\202\377\377\001\333\336\206\000\000\001q\214"
-  "\202\377\377\001\373\336\206\000\000\005iJ\337\377\377\377\337\377\206\061\205\000\000"
-  "\002\242\020<\347\202\377\377\001\256s\206\000\000\001<\347\202\377\377\001(B\206\000\000"
-  "\001\030\306\202\377\377\001\262\224\206\000\000\001\323\234\202\377\377\001\030\306\206"
-  "\000\000\001\030\306\202\377\377\001\256s\206\000\000\001\222\224\202\377\377\001\226\265"
-  "\206\000\000\001iJ\202\377\377\001\373\336\206\000\000\001\030\306\202\377\377\001\256s\206"
-  "\000\000\001\262\224\202\377\377\001u\255\206\000\000\001iJ\202\377\377\001\373\336\206\000"
-  "\000\001\034\347\202\377\377\001\246\061\206\000\000\001\030\306\202\377\377\001q\214\206"
-  "\000\000\001\323\234\202\377\377\001\367\275\205\000\000\001\256s\202\377\377\001\373\336"
-  "\206\000\000\004\307\071\276\367\377\377\276\367\207\000\000\001\333\336\202\377\377\001"
-  "\317{\204\000\000\002\202\020\034\347\202\377\377\001q\214\206\000\000\001\327\275\202\377"
-  "\377\001\367\275\206\000\000\001Q\214\202\377\377\001<\347\205\000\000\001U\255\202\377\377"
-  "\002\373\336\040\000\205\000\000\005\216s\337\377\377\377\337\377\347\071\205\000\000\002\347"
-  "\071}\357\202\377\377\001\357{\204\000\000\001mk\202\377\377\002\337\377mk\205\000\000\002"
-  "\307\071}\357\202\377\377\001\363\234\206\000\000\001\232\326\202\377\377\001Y\316\205"
-  "\000\000\001<\347\202\377\377\001\064\245\206\000\000\001\030\306\202\377\377\002\232\326\040"
-  "\000\205\000\000\001\262\224\202\377\377\002}\357\307\071\204\000\000\001\363\234\202\377"
-  "\377\001\333\336\206\000\000\001\014c\202\377\377\002\236\367\010B\206\000\000\001]\357\202"
-  "\377\377\001\357{\205\000\000\001\373\336\202\377\377\001mk\206\000\000\001\266\265\202\377"
-  "\377\001u\255\206\000\000\001\357{\202\377\377\001\232\326\206\000\000\003\337\377\377\377"
-  "]\357\207\000\000\001\333\336\202\377\377\001IJ\206\000\000\001\327\275\202\377\377\001\222"
-  "\224\206\000\000\202\377\377\001\232\326\207\000\000\001}\357\202\377\377\207\000\000\001Y"
-  "\316\202\377\377\001\313Z\206\000\000\202\377\377\001\272\326\207\000\000\001]\357\202"
-  "\377\377\207\000\000\001Y\316\202\377\377\001Mk\206\000\000\004\276\367\377\377\236\367"
-  "\343\030\206\000\000\001\272\326\202\377\377\001\216s\206\000\000\001\064\245\202\377\377"
-  "\001U\255\206\000\000\001y\316\202\377\377\001\323\234\206\000\000\001\363\234\202\377\377"
-  "\001\030\306\206\000\000\001,c\202\377\377\002]\357\202\020\205\000\000\001\357{\202\377\377"
-  "\002\236\367(B\205\000\000\002\206\061\276\367\202\377\377\001\317{\206\000\000\001\333\336"
-  "\202\377\377\001u\255\206\000\000\001Y\316\202\377\377\002\034\347\307\071\205\000\000\001"
-  "\363\234\202\377\377\002\276\367\216s\205\000\000\002mk\337\377\202\377\377\001\323"
-  "\234\205\000\000\002E)<\347\202\377\377\001\367\275\205\000\000\002\040\000\070\306\202\377"
-  "\377\001\034\347\206\000\000\001\024\245\203\377\377\001\303\030\205\000\000\004\010B\333\336"
-  "\236\367Q\214\207\000\000\003\030\306\276\367u\255\207\000\000\003\024\245\236\367y\316"
-  "\277\000\000",
-};
-
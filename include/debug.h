@@ -36,9 +36,10 @@ extern RemoteDebug Debug;
 // Uncomment the line below, to do it:
 //#define USE_LIB_WEBSOCKET true
 #endif
+// The debug web server (port 80, no authentication) is only built with -D WEB_SERVER_ENABLED, see platformio.ini.
 #ifdef WEB_SERVER_ENABLED
-#info "WEB_SERVER_ENABLED"
-extern WebServer HTTPServer(80);
+#include <WebServer.h>
+extern WebServer HTTPServer;
 
 void handleRoot(void);
 void handleNotFound(void);
@@ -1,439 +0,0 @@
-/* GIMP RGBA C-Source image dump 1-byte-run-length-encoded (roadcruiser_xl.c) */
-
-#define ROADCRUISER_XL_RUN_LENGTH_DECODE(image_buf, rle_data, size, bpp) do \
-{ unsigned int __bpp; unsigned char *__ip; const unsigned char *__il, *__rd; \
-  __bpp = (bpp); __ip = (image_buf); __il = __ip + (size) * __bpp; \
-  __rd = (rle_data); if (__bpp > 3) { /* RGBA */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 4); __ip += 4; } while (--__l); __rd += 4; \
-      } else { __l *= 4; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else if (__bpp == 3) { /* RGB */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 3); __ip += 3; } while (--__l); __rd += 3; \
-      } else { __l *= 3; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else { /* RGB16 */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 2); __ip += 2; } while (--__l); __rd += 2; \
-      } else { __l *= 2; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } } while (0)
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 rle_pixel_data[9582 + 1];
-} roadcruiser_xl = {
-  310, 135, 2,
-  "\360\000\000\202\206\061\001\212R\377\222\224\263\222\224\002\000\000\206\061\372\000\000\003"
-  "\206\061\222\224u\255\202\232\326\377\276\367\270\276\367\003\232\326u\255\206"
-  "\061\363\000\000\002\206\061\222\224\202\232\326\377\276\367\300\276\367\001mk\360"
-  "\000\000\002\212Ru\255\212\276\367\002u\255\222\224\203mk\001\222\224\217mk\001\222\224"
-  "\323mk\276u\255\001\232\326\222\276\367\001mk\355\000\000\002\212R\232\326\210\276"
-  "\367\003\232\326u\255\212R\377\000\000\257\000\000\001\206\061\203mk\203u\255\206\276"
-  "\367\001\232\326\354\000\000\001u\255\210\276\367\002\232\326\222\224\377\000\000\272\000"
-  "\000\003\212Rmku\255\203\276\367\001\222\224\351\000\000\002\206\061\232\326\210\276\367"
-  "\001\222\224\377\000\000\277\000\000\001u\255\203\276\367\350\000\000\001mk\210\276\367\002\232"
-  "\326\212R\377\000\000\300\000\000\001\212R\203\276\367\001mk\346\000\000\001mk\210\276\367"
-  "\001\222\224\377\000\000\303\000\000\203\276\367\001u\255\345\000\000\001u\255\210\276\367"
-  "\001\222\224\377\000\000\304\000\000\001\232\326\203\276\367\344\000\000\001u\255\210\276\367"
-  "\001\222\224\377\000\000\305\000\000\001\222\224\203\276\367\001mk\342\000\000\001u\255\210\276"
-  "\367\001\222\224\377\000\000\306\000\000\001\212R\203\276\367\001\222\224\341\000\000\001u\255"
-  "\210\276\367\001\222\224\377\000\000\310\000\000\203\276\367\001\232\326\340\000\000\001\232"
-  "\326\210\276\367\001\222\224\377\000\000\311\000\000\001\232\326\203\276\367\337\000\000"
-  "\001\232\326\210\276\367\001\222\224\377\000\000\312\000\000\001u\255\203\276\367\001\212"
-  "R\335\000\000\001u\255\210\276\367\001\222\224\377\000\000\313\000\000\001\222\224\203\276"
-  "\367\001mk\333\000\000\002\206\061u\255\210\276\367\001\222\224\377\000\000\314\000\000\001\222"
-  "\224\203\276\367\001u\255\333\000\000\001u\255\210\276\367\001\222\224\377\000\000\316"
-  "\000\000\203\276\367\001u\255\332\000\000\001u\255\210\276\367\001\222\224\377\000\000\317"
-  "\000\000\204\276\367\331\000\000\001\222\224\210\276\367\001\222\224\377\000\000\320\000\000"
-  "\001\232\326\203\276\367\001\206\061\327\000\000\001\222\224\210\276\367\001\222\224\377"
-  "\000\000\321\000\000\001\232\326\203\276\367\001mk\326\000\000\001\222\224\210\276\367\001u\255"
-  "\377\000\000\322\000\000\001u\255\203\276\367\001mk\325\000\000\001\222\224\210\276\367\001u"
-  "\255\377\000\000\323\000\000\001\222\224\203\276\367\001u\255\324\000\000\001\212R\210\276"
-  "\367\001\232\326\377\000\000\324\000\000\001\222\224\203\276\367\001u\255\323\000\000\001\212"
-  "R\210\276\367\001\232\326\377\000\000\325\000\000\001\206\061\203\276\367\001\232\326\322"
-  "\000\000\001\212R\210\276\367\001\232\326\377\000\000\326\000\000\001\206\061\204\276\367\321"
-  "\000\000\001\212R\210\276\367\001\232\326\377\000\000\327\000\000\001\206\061\204\276\367\001"
-  "\206\061\320\000\000\001\232\326\207\276\367\002\232\326\206\061\377\000\000\330\000\000\001"
-  "\232\326\203\276\367\001mk\317\000\000\001\232\326\207\276\367\002\232\326\206\061\377"
-  "\000\000\331\000\000\001\232\326\203\276\367\001mk\316\000\000\001\232\326\210\276\367\377"
-  "\000\000\333\000\000\001\232\326\203\276\367\001u\255\314\000\000\002\206\061u\255\210\276\367"
-  "\001\212R\377\000\000\333\000\000\001u\255\203\276\367\001u\255\314\000\000\001\222\224\210\276"
-  "\367\001mk\377\000\000\334\000\000\001u\255\203\276\367\001u\255\313\000\000\001\222\224\210"
-  "\276\367\001mk\377\000\000\335\000\000\001u\255\203\276\367\001\232\326\312\000\000\001\222\224"
-  "\210\276\367\001mk\377\000\000\336\000\000\001u\255\203\276\367\001\232\326\311\000\000\001m"
-  "k\210\276\367\001\222\224\224\000\000\206\206\061\377\000\000\305\000\000\001u\255\204\276"
-  "\367\310\000\000\002mk\232\326\207\276\367\001\222\224\207\000\000\202\206\061\001\222\224"
-  "\206u\255\205\232\326\206\276\367\001u\255\377\000\000\304\000\000\001\206\061\204\276"
-  "\367\001\212R\306\000\000\002u\255\276\367\202\232\326\205\276\367\003u\255\000\000\206"
-  "\061\202\212R\001mk\203\232\326\203\276\367\206\232\326\001u\255\205\222\224\204"
-  "\000\000\202u\255\377\000\000\304\000\000\001\206\061\204\276\367\001\212R\305\000\000\001u\255"
-  "\202\276\367\003\222\224\206\061u\255\203\276\367\003u\255\000\000u\255\205\276\367"
-  "\002u\255\222\224\202\232\326\202u\255\001\232\326\212\276\367\002\232\326mk\202"
-  "\000\000\202u\255\377\000\000\304\000\000\001\206\061\204\276\367\001\212R\304\000\000\002u\255"
-  "\276\367\202\232\326\205\276\367\202u\255\203\276\367\002u\255\232\326\205"
-  "\276\367\001\232\326\203u\255\001mk\205\212R\002u\255\222\224\202u\255\004\232\326"
-  "\276\367mk\000\000\202u\255\377\000\000\304\000\000\001\206\061\204\276\367\001\222\224\302"
-  "\000\000\004\212R\232\326\276\367\222\224\202\000\000\001\232\326\203\276\367\001\232\326"
-  "\205\276\367\002\232\326u\255\202\222\224\001mk\204u\255\210\276\367\001\232\326"
-  "\203\276\367\203\232\326\001\000\000\202u\255\377\000\000\304\000\000\001\206\061\204\276"
-  "\367\001u\255\301\000\000\001\212R\202\276\367\004\222\224\000\000\206\061\232\326\210\276"
-  "\367\005\232\326\222\224\212R\000\000\232\326\202\276\367\202\232\326\203u\255"
-  "\002mk\212R\210\000\000\005mk\276\367u\255\276\367\000\000\202u\255\377\000\000\304\000\000\001"
-  "\206\061\204\276\367\001u\255\300\000\000\001\212R\202\276\367\004\206\061\000\000\206\061"
-  "\232\326\214\276\367\003mk\276\367\206\061\221\000\000\004\276\367u\255\276\367\000"
-  "\000\202u\255\377\000\000\305\000\000\001\232\326\203\276\367\001u\255\277\000\000\007\222\224"
-  "\276\367\232\326\212R\000\000\212R\232\326\211\276\367\001u\255\202\212R\003\276"
-  "\367\222\224\232\326\222\000\000\004\276\367u\255\276\367\000\000\202u\255\377\000\000"
-  "\305\000\000\001\232\326\203\276\367\001u\255\276\000\000\006\222\224\276\367\232\326\206"
-  "\061\000\000mk\204\276\367\202\232\326\204\276\367\001\222\224\203\000\000\003\276\367"
-  "u\255\232\326\222\000\000\004\276\367u\255\232\326\000\000\202u\255\377\000\000\305\000\000"
-  "\001\232\326\203\276\367\001\232\326\275\000\000\003\222\224\276\367\232\326\202\000"
-  "\000\001mk\204\276\367\001\232\326\202\276\367\001\232\326\202\276\367\001mk\203\000"
-  "\000\004\222\224\276\367\232\326u\255\222\000\000\004\276\367\222\224\232\326\000\000\202"
-  "u\255\377\000\000\305\000\000\001\232\326\203\276\367\001\232\326\274\000\000\003\232\326\276"
-  "\367u\255\202\000\000\001mk\204\276\367\202\232\326\002\276\367u\255\202\276\367"
-  "\001\206\061\204\000\000\001u\255\202\232\326\001\222\224\221\000\000\005mk\276\367\222\224"
-  "\232\326\000\000\202u\255\377\000\000\305\000\000\001\232\326\203\276\367\001\232\326\272"
-  "\000\000\001\212R\202\276\367\001\222\224\202\000\000\001\222\224\204\276\367\202\232\326"
-  "\002\276\367u\255\202\276\367\001\212R\205\000\000\004\232\326u\255\276\367\222\224"
-  "\221\000\000\005\222\224\232\326u\255\232\326\000\000\202u\255\377\000\000\305\000\000\001\232"
-  "\326\203\276\367\001\232\326\271\000\000\004\212R\276\367\232\326\212R\202\000\000\001"
-  "u\255\204\276\367\001u\255\202\276\367\004\222\224\276\367\232\326\212R\206\000"
-  "\000\004\276\367\222\224\276\367\222\224\221\000\000\001\222\224\202\232\326\002u\255"
-  "\000\000\202u\255\377\000\000\305\000\000\001\232\326\203\276\367\001\232\326\270\000\000\001\222"
-  "\224\202\276\367\203\000\000\001u\255\204\276\367\002\232\326\276\367\202\232\326"
-  "\002\276\367\232\326\207\000\000\004mk\276\367\222\224\276\367\222\000\000\001\222\224"
-  "\202\232\326\002\222\224\000\000\202u\255\377\000\000\305\000\000\001u\255\203\276\367\001"
-  "\232\326\267\000\000\004\222\224\276\367\232\326\212R\202\000\000\001u\255\204\276\367"
-  "\002\232\326\276\367\202\232\326\003\276\367\222\224\212R\207\000\000\004\222\224\232"
-  "\326u\255\276\367\222\000\000\001u\255\202\232\326\002\222\224\000\000\202u\255\377\000"
-  "\000\305\000\000\001u\255\204\276\367\001\212R\265\000\000\007\222\224\276\367\232\326\206"
-  "\061\000\000\206\061\232\326\204\276\367\002\232\326\276\367\202\232\326\002\276\367"
-  "\222\224\211\000\000\001\222\224\202\232\326\001u\255\222\000\000\005\232\326u\255\276"
-  "\367mk\000\000\202u\255\377\000\000\305\000\000\001u\255\204\276\367\001\212R\264\000\000\007\222"
-  "\224\276\367\232\326\206\061\000\000\206\061\232\326\204\276\367\005\232\326\276"
-  "\367u\255\232\326\276\367\202\212R\211\000\000\202\232\326\002\276\367\222\224"
-  "\222\000\000\202\232\326\001\276\367\202\000\000\202u\255\377\000\000\305\000\000\001u\255\204"
-  "\276\367\001\212R\263\000\000\007\222\224\276\367\232\326\206\061\000\000\206\061\232\326"
-  "\204\276\367\003\232\326\276\367\232\326\202\276\367\001mk\213\000\000\004\276\367"
-  "\222\224\276\367\206\061\222\000\000\001\276\367\202\232\326\202\000\000\202u\255\377"
-  "\000\000\305\000\000\001u\255\204\276\367\001\212R\262\000\000\007u\255\276\367\232\326\206"
-  "\061\000\000mk\232\326\204\276\367\006u\255\276\367u\255\232\326\276\367\212R\214"
-  "\000\000\003\276\367\222\224\276\367\223\000\000\003\276\367u\255\232\326\202\000\000\202"
-  "u\255\377\000\000\305\000\000\001u\255\204\276\367\001mk\261\000\000\006u\255\276\367u\255"
-  "\206\061\000\000mk\205\276\367\006u\255\276\367u\255\232\326\276\367mk\214\000\000\004"
-  "\206\061\276\367u\255\232\326\223\000\000\003\276\367\232\326u\255\202\000\000\202u"
-  "\255\377\000\000\305\000\000\001u\255\204\276\367\001u\255\260\000\000\003\232\326\276\367"
-  "u\255\202\000\000\001mk\205\276\367\006u\255\276\367\232\326mk\276\367\222\224\215"
-  "\000\000\004mk\276\367\232\326u\255\222\000\000\004\222\224\232\326\276\367\222\224\202"
-  "\000\000\202u\255\377\000\000\305\000\000\001u\255\204\276\367\001u\255\256\000\000\004\206\061"
-  "\232\326\276\367\222\224\202\000\000\001\222\224\205\276\367\001\232\326\202\276"
-  "\367\003\206\061\222\224\276\367\216\000\000\004mk\232\326\276\367\222\224\222\000\000"
-  "\004\222\224\232\326\276\367\212R\202\000\000\202u\255\377\000\000\305\000\000\001u\255\204"
-  "\276\367\001u\255\255\000\000\004mk\232\326\276\367mk\202\000\000\001\222\224\205\276\367"
-  "\007mk\000\000\222\224\276\367\232\326\222\224\232\326\216\000\000\004u\255\232\326\276"
-  "\367\222\224\222\000\000\003u\255\232\326\276\367\203\000\000\202u\255\377\000\000\305"
-  "\000\000\001u\255\204\276\367\001u\255\254\000\000\004\212R\276\367\232\326mk\202\000\000\001"
-  "\222\224\205\276\367\001\212R\203\000\000\004\222\224\276\367\222\224\232\326\216"
-  "\000\000\004\276\367\232\326\276\367\212R\222\000\000\003\276\367u\255\276\367\203\000"
-  "\000\002\232\326u\255\377\000\000\305\000\000\001u\255\204\276\367\001u\255\253\000\000\004\212"
-  "R\232\326\276\367\206\061\202\000\000\001\222\224\204\276\367\004\232\326\276\367"
-  "\222\224\206\061\203\000\000\001\276\367\202\232\326\216\000\000\004\276\367\222\224\276"
-  "\367\206\061\222\000\000\003\276\367\222\224\276\367\203\000\000\002\276\367\222\224\377"
-  "\000\000\305\000\000\001u\255\204\276\367\001\232\326\252\000\000\004\222\224\276\367\232\326"
-  "\212R\202\000\000\001\232\326\204\276\367\202u\255\202\276\367\001\232\326\203\000"
-  "\000\203\232\326\215\000\000\002mk\276\367\202\232\326\222\000\000\002\222\224\276\367"
-  "\202\232\326\203\000\000\002\276\367mk\377\000\000\305\000\000\001u\255\204\276\367\001\232"
-  "\326\251\000\000\004u\255\276\367\232\326\206\061\202\000\000\001\232\326\204\276\367"
-  "\006u\255\222\224\276\367\232\326u\255\276\367\203u\255\001\276\367\202\232\326"
-  "\215\000\000\001u\255\202\232\326\001u\255\222\000\000\004\232\326u\255\232\326u\255\203"
-  "\000\000\002\276\367mk\377\000\000\305\000\000\001u\255\204\276\367\001\232\326\246\000\000\005m"
-  "ku\255\232\326\276\367u\255\202\000\000\002\212R\232\326\204\276\367\003u\255\222"
-  "\224\276\367\203\232\326\202\276\367\202\232\326\003\276\367\222\224\232\326"
-  "\215\000\000\202\232\326\002\276\367mk\221\000\000\005mk\276\367\222\224\276\367mk\203"
-  "\000\000\002\276\367mk\377\000\000\305\000\000\001u\255\204\276\367\001\232\326\245\000\000\001m"
-  "k\203\276\367\001\222\224\202\000\000\001\212R\205\276\367\002u\255\212R\202\276\367"
-  "\005\232\326u\255\232\326\276\367mk\202\000\000\003\276\367u\255\232\326\215\000\000"
-  "\004\276\367\222\224\276\367\206\061\221\000\000\204\232\326\203\000\000\003\212R\276"
-  "\367\212R\377\000\000\305\000\000\001u\255\204\276\367\001\232\326\244\000\000\005\222\224"
-  "\276\367\232\326\222\224\276\367\202\000\000\001\212R\205\276\367\002u\255\212R\203"
-  "\276\367\005\232\326u\255\232\326\276\367\212R\202\000\000\003\276\367u\255\232\326"
-  "\214\000\000\004\212R\276\367\222\224\232\326\221\000\000\005\206\061\276\367\222\224"
-  "\276\367u\255\203\000\000\002\212R\276\367\377\000\000\306\000\000\001\212R\204\276\367\001"
-  "\232\326\242\000\000\002\206\061u\255\202\276\367\001\206\061\202\232\326\002\000\000\212"
-  "R\205\276\367\006u\255\000\000\232\326\276\367\232\326\276\367\202u\255\003\232\326"
-  "\276\367\212R\202\000\000\003\276\367u\255\232\326\214\000\000\002mk\276\367\202\232"
-  "\326\221\000\000\005\232\326\276\367u\255\276\367\206\061\203\000\000\002\212R\276\367"
-  "\377\000\000\306\000\000\001\212R\205\276\367\001\222\224\240\000\000\007\206\061\232\326\276"
-  "\367\232\326\276\367u\255\276\367\202\232\326\205\276\367\005u\255\000\000u\255"
-  "\276\367u\255\202\276\367\005\232\326u\255\232\326\276\367\212R\202\000\000\003\276"
-  "\367u\255\232\326\214\000\000\004\222\224\276\367\232\326u\255\220\000\000\003u\255\276"
-  "\367\222\224\202\232\326\204\000\000\002\212R\276\367\377\000\000\306\000\000\001\212R\202"
-  "\276\367\002\232\326\206\061\202\232\326\240\000\000\005u\255\276\367mku\255\232\326"
-  "\210\276\367\005u\255\000\000\222\224\276\367\232\326\203\276\367\202u\255\003\232"
-  "\326\276\367\212R\202\000\000\001\276\367\202\232\326\214\000\000\001u\255\202\276\367"
-  "\001\222\224\217\000\000\006\222\224\276\367u\255\222\224\276\367\222\224\204\000\000"
-  "\002\212R\276\367\377\000\000\306\000\000\007\212R\276\367\232\326\206\061\000\000\222\224"
-  "\232\326\236\000\000\002\206\061\222\224\202\276\367\001\232\326\211\276\367\005\232"
-  "\326mk\222\224\276\367\232\326\203\276\367\004\222\224\232\326\276\367\232"
-  "\326\202\276\367\202\232\326\202\276\367\001\232\326\214\000\000\003\276\367u\255"
-  "\232\326\217\000\000\006u\255\276\367u\255\206\061\276\367\232\326\205\000\000\002\212"
-  "R\276\367\377\000\000\306\000\000\003\212R\276\367\206\061\202\000\000\002\222\224\232\326"
-  "\232\000\000\004\206\061\222\224u\255\232\326\215\276\367\004u\255\000\000mk\276\367\202"
-  "\232\326\202\276\367\005\222\224\000\000\232\326\276\367mk\206\276\367\001\232\326"
-  "\213\000\000\004\212R\276\367\222\224\232\326\215\000\000\007mk\232\326\276\367u\255"
-  "\000\000\232\326\276\367\206\000\000\002\212R\276\367\377\000\000\306\000\000\202u\255\203"
-  "\000\000\002\222\224\232\326\230\000\000\002mk\232\326\220\276\367\001u\255\202\000\000\003u"
-  "\255\276\367u\255\202\276\367\001u\255\202\000\000\004u\255\232\326u\255\276\367"
-  "\204\222\224\002\276\367\232\326\213\000\000\004\212R\276\367\222\224\232\326\213"
-  "\000\000\011\212Ru\255\276\367\232\326\212R\000\000u\255\276\367\222\224\206\000\000\002"
-  "\212R\276\367\377\000\000\305\000\000\003\222\224\276\367u\255\203\000\000\002\222\224\232"
-  "\326\226\000\000\002\222\224\232\326\221\276\367\001u\255\203\000\000\003\276\367u\255"
-  "mk\202\232\326\001\276\367\202u\255\203\276\367\001\222\224\204\000\000\003\232\326"
-  "\276\367mk\212\000\000\002mk\276\367\202\232\326\207\000\000\202\212R\002\222\224\232"
-  "\326\202\276\367\006u\255\206\061\212R\232\326\276\367mk\204\212R\001\206\061\202"
-  "\000\000\002\222\224\276\367\377\000\000\305\000\000\003\232\326\276\367u\255\203\000\000\002\222"
-  "\224\232\326\223\000\000\002\212Ru\255\223\276\367\001u\255\203\000\000\006mk\276\367\212"
-  "Rmk\276\367mk\203u\255\202\232\326\206\000\000\203\276\367\001mk\211\000\000\004u\255"
-  "\232\326\276\367mk\202\000\000\001mk\203u\255\001\232\326\203\276\367\010\232\326"
-  "mk\000\000\212Ru\255\276\367u\255\212R\205\276\367\005\232\326\206\061\000\000u\255"
-  "\232\326\377\000\000\304\000\000\004mk\276\367\232\326u\255\203\000\000\002\222\224\232\326"
-  "\220\000\000\003\206\061\222\224\232\326\224\276\367\001u\255\204\000\000\004u\255\232\326"
-  "\000\000\212R\207\276\367\001u\255\204\000\000\004\222\224\276\367mk\232\326\213\276"
-  "\367\001u\255\206\276\367\203u\255\016mk\000\000\212Rmku\255\232\326\276\367\232"
-  "\326mk\000\000\232\326\276\367\232\326u\255\202\232\326\003\276\367\232\326\000\000"
-  "\202u\255\377\000\000\304\000\000\005\222\224\232\326u\255\232\326\212R\202\000\000\002\222"
-  "\224\232\326\217\000\000\002\212R\232\326\213\276\367\204\232\326\206\276\367\001"
-  "u\255\205\000\000\005u\255\276\367\206\061\000\000\206\061\204\212R\202\232\326\202\276"
-  "\367\005u\255mk\232\326\276\367u\255\202\000\000\213\212R\001\000\000\205\212R\001\000\000"
-  "\202mk\002\222\224u\255\203\276\367\003\232\326\222\224\212R\202\000\000\007\206\061"
-  "\276\367\232\326\276\367u\255\232\326\276\367\202\232\326\001\000\000\202u\255"
-  "\377\000\000\304\000\000\003\222\224\232\326u\255\202\276\367\004mk\000\000\222\224\232\326"
-  "\216\000\000\001mk\211\276\367\011\232\326u\255mk\206\061\000\000\206\061\212R\000\000u\255"
-  "\204\276\367\001u\255\206\000\000\003\212R\276\367u\255\206\000\000\202u\255\002\212Ru"
-  "\255\203\232\326\001\222\224\203\000\000\001mk\210\222\224\001u\255\204\232\326\001u"
-  "\255\205\276\367\004\232\326u\255\222\224\212R\206\000\000\001\212R\202\276\367\002"
-  "\232\326u\255\203\232\326\004\276\367\000\000\232\326\222\224\377\000\000\304\000\000\002"
-  "\222\224\232\326\204u\255\003\000\000\222\224\232\326\216\000\000\001\232\326\206\276"
-  "\367\007u\255mk\206\061\222\224u\255mk\212R\202\276\367\003\222\224\000\000u\255\203"
-  "\276\367\001u\255\210\000\000\002u\255\276\367\214\232\326\206\276\367\211\232\326"
-  "\206u\255\001\212R\202\206\061\213\000\000\001\212R\202\276\367\002\232\326u\255\203"
-  "\232\326\004\276\367\206\061\276\367mk\377\000\000\304\000\000\002\222\224\232\326\204"
-  "u\255\003\000\000\222\224\232\326\214\000\000\002\206\061\232\326\204\276\367\005\232\326"
-  "mk\000\000\222\224u\255\203\276\367\002\206\061\232\326\202\276\367\002mk\212R\203"
-  "\276\367\001\222\224\212\000\000\002\212Ru\255\205\222\224\202\232\326\203\222\224"
-  "\001mk\206\206\061\235\000\000\001\212R\202\276\367\002\232\326u\255\203\232\326\003\276"
-  "\367\206\061\276\367\377\000\000\305\000\000\002\222\224\232\326\204u\255\003\000\000\222"
-  "\224\232\326\214\000\000\001\222\224\204\276\367\003\222\224\212Ru\255\205\276\367"
-  "\002\222\224mk\202\276\367\003u\255\000\000\232\326\202\276\367\001\212R\222\000\000\202"
-  "u\255\247\000\000\001\212R\202\276\367\002\232\326u\255\203\232\326\003\276\367\206"
-  "\061\276\367\377\000\000\305\000\000\002\222\224\232\326\204u\255\003\000\000\222\224\232"
-  "\326\213\000\000\001mk\203\276\367\003\232\326\206\061\222\224\206\276\367\007u\255"
-  "\206\061\232\326\276\367\232\326\206\061\232\326\202\276\367\001\212R\223\000\000"
-  "\202u\255\247\000\000\001\212R\202\276\367\202\232\326\001\276\367\202\232\326\003"
-  "\276\367\206\061\276\367\377\000\000\305\000\000\002\222\224\232\326\204u\255\003\000\000"
-  "\222\224\232\326\213\000\000\001\232\326\202\276\367\003u\255\000\000\222\224\206\276"
-  "\367\007\232\326\000\000\232\326\276\367\232\326\000\000u\255\202\276\367\001u\255\224"
-  "\000\000\202u\255\247\000\000\013\212R\276\367u\255\276\367u\255\232\326\276\367u"
-  "\255\276\367\206\061\276\367\377\000\000\305\000\000\002\222\224\232\326\204u\255\003"
-  "\000\000\222\224\232\326\212\000\000\001\222\224\202\276\367\003\222\224\206\061u\255"
-  "\207\276\367\002mk\222\224\202\276\367\002\000\000\222\224\202\276\367\001u\255\225"
-  "\000\000\202u\255\250\000\000\012\276\367\222\224\276\367mku\255\232\326u\255\232"
-  "\326mk\276\367\377\000\000\305\000\000\002\222\224\232\326\204u\255\003\000\000\222\224\232"
-  "\326\211\000\000\001\212R\202\276\367\002mk\212R\210\276\367\006\222\224\000\000\222\224"
-  "u\255\000\000\222\224\202\276\367\001\222\224\226\000\000\202u\255\250\000\000\001u\255\206"
-  "\276\367\003\222\224u\255\276\367\377\000\000\305\000\000\002\222\224\232\326\203u\255"
-  "\004\232\326\000\000\222\224\232\326\211\000\000\005\232\326\276\367u\255\212R\232\326"
-  "\204\276\367\202u\255\012\222\224\206\061\212R\222\224\212Ru\255\232\326\276"
-  "\367\232\326\212R\227\000\000\202u\255\250\000\000\001\206\061\206mk\003\000\000u\255\232"
-  "\326\377\000\000\305\000\000\002\222\224\232\326\202u\255\005mk\276\367\212R\222\224"
-  "\232\326\210\000\000\001\212R\202\276\367\010\206\061u\255\232\326u\255\222\224\206"
-  "\061\212Rmk\202u\255\001\232\326\204\276\367\002u\255mk\231\000\000\202u\255\260\000"
-  "\000\002\232\326u\255\377\000\000\305\000\000\002\222\224\232\326\202u\255\001\212R\202\276"
-  "\367\202\232\326\210\000\000\006\222\224\276\367\232\326\000\000\212Rmk\202u\255\001"
-  "\232\326\205\276\367\004\232\326\222\224\212R\206\061\217\000\000\001\212R\210mk\202"
-  "u\255\006\222\224u\255\232\326\222\224mk\212R\254\000\000\003\206\061\276\367\222"
-  "\224\377\000\000\305\000\000\002\222\224\232\326\202u\255\003\000\000\212Ru\255\202\232\326"
-  "\210\000\000\001\222\224\215\276\367\001\232\326\213\000\000\003\212Ru\255\232\326\217"
-  "\276\367\002\232\326u\255\204\276\367\202\232\326\001\222\224\251\000\000\003\206\061"
-  "\276\367\212R\377\000\000\305\000\000\002\222\224\232\326\202u\255\203\000\000\002\222\224"
-  "\232\326\206\000\000\002\222\224\232\326\216\276\367\001\232\326\211\000\000\001u\255\223"
-  "\276\367\002\232\326u\255\210\276\367\002\232\326\222\224\246\000\000\002\222\224\276"
-  "\367\377\000\000\306\000\000\005\222\224\232\326u\255\232\326mk\202\000\000\002u\255\232"
-  "\326\205\000\000\001\232\326\221\276\367\001mk\206\000\000\001\222\224\225\276\367\002\232"
-  "\326u\255\212\276\367\003\232\326\222\224\206\061\243\000\000\002u\255\232\326\377"
-  "\000\000\306\000\000\003\222\224\232\326u\255\202\276\367\202\232\326\002\276\367\232"
-  "\326\205\000\000\001\232\326\221\276\367\001\232\326\204\000\000\002\212R\232\326\226\276"
-  "\367\002\232\326u\255\214\276\367\002\232\326\206\061\242\000\000\202\232\326\377"
-  "\000\000\206\000\000\003mk\222\224u\255\212\232\326\002u\255\222\224\261\000\000\004\222\224"
-  "\232\326u\255\232\326\203\222\224\002\276\367mk\205\000\000\001\222\224\222\276\367"
-  "\001mk\202\000\000\001mk\230\276\367\001\232\326\203\000\000\003mku\255\232\326\210\276\367"
-  "\002\232\326\206\061\240\000\000\003\206\061\276\367\222\224\377\000\000\202\000\000\002mku\255"
-  "\223\276\367\003\232\326u\255mk\254\000\000\004\222\224\232\326u\255\232\326\203"
-  "\000\000\002\276\367\206\061\204\000\000\001\232\326\223\276\367\003\232\326\000\000\222\224"
-  "\232\276\367\204\232\326\005u\255mk\212Ru\255\232\326\206\276\367\002\232\326"
-  "\206\061\237\000\000\003\206\061\276\367\212R\376\000\000\002\206\061\222\224\231\276\367"
-  "\002\232\326mk\252\000\000\004\222\224\232\326mk\276\367\203\000\000\002\276\367\206\061"
-  "\203\000\000\001\206\061\225\276\367\001\212R\241\276\367\004\232\326\222\224\206\061"
-  "u\255\206\276\367\001\232\326\237\000\000\002mk\276\367\376\000\000\002mk\232\326\234\276"
-  "\367\002u\255\206\061\250\000\000\004\222\224\232\326\212R\276\367\203\000\000\002\276\367"
-  "\212R\203\000\000\001\212R\224\276\367\002mk\222\224\243\276\367\004\232\326\206\061"
-  "\212R\232\326\205\276\367\001u\255\236\000\000\002u\255\232\326\375\000\000\001u\255\237"
-  "\276\367\002\232\326mk\247\000\000\004\222\224\232\326mk\276\367\203\212R\002\232\326"
-  "\276\367\203\000\000\001\212R\210\276\367\003u\255\222\224\000\000\203\212R\001\222\224"
-  "\204\276\367\002u\255\212R\224\276\367\202\232\326\205u\255\001\232\326\212\276"
-  "\367\003u\255\000\000\232\326\205\276\367\001\206\061\235\000\000\002\232\326\222\224\374"
-  "\000\000\001\232\326\242\276\367\001\222\224\247\000\000\210\276\367\001\222\224\202\000"
-  "\000\001u\255\210\276\367\202\000\000\001\222\224\202mk\202\000\000\204\276\367\002\206\061"
-  "\232\326\215\276\367\001\232\326\202u\255\202\212R\213\000\000\003\212R\222\224\232"
-  "\326\207\276\367\003u\255\000\000u\255\204\276\367\001\232\326\235\000\000\002\276\367"
-  "\222\224\373\000\000\001\232\326\244\276\367\001mk\246\000\000\001\232\326\207\276\367"
-  "\001\232\326\202\000\000\001u\255\204\276\367\003mk\212R\000\000\202mk\202u\255\004\232\326"
-  "\276\367\212R\000\000\203\276\367\002u\255\212R\214\276\367\002\222\224\206\061\223"
-  "\000\000\202\212R\002\222\224\232\326\204\276\367\003\232\326\000\000\222\224\204\276"
-  "\367\001mk\234\000\000\002\276\367mk\372\000\000\001u\255\246\276\367\001\212R\245\000\000\001"
-  "\232\326\207\276\367\001\232\326\202\000\000\001mk\210\276\367\202\232\326\202u\255"
-  "\001\222\224\202\206\061\202\276\367\003\232\326\000\000\232\326\212\276\367\002\232"
-  "\326\206\061\231\000\000\001u\255\204\276\367\003\232\326\000\000u\255\203\276\367\001\232"
-  "\326\233\000\000\002\212R\276\367\372\000\000\001mk\247\276\367\002\232\326\206\061\244"
-  "\000\000\001\232\326\207\276\367\001\232\326\202\000\000\001mk\205\276\367\003\232\326u\255"
-  "\206\061\202\000\000\001\212R\202\232\326\202u\255\202\276\367\002mku\255\212\276"
-  "\367\002\222\224\206\061\214\000\000\001\206\061\203mk\213\000\000\001\206\061\204\276\367"
-  "\002u\255\212R\204\276\367\001mk\232\000\000\002\222\224\276\367\371\000\000\001\206\061\217"
-  "\276\367\203\232\326\207u\255\202\232\326\216\276\367\001\222\224\244\000\000\001"
-  "\232\326\207\276\367\001\232\326\202\000\000\001u\255\205\276\367\202\232\326\001u"
-  "\255\202\222\224\001\206\061\202u\255\001\206\061\202\276\367\002\232\326\000\000\212"
-  "\276\367\001\232\326\210\000\000\002\212Ru\255\202\232\326\207\276\367\003\232\326"
-  "u\255mk\210\000\000\001mk\204\276\367\002\222\224mk\203\276\367\001u\255\232\000\000\002"
-  "u\255\232\326\371\000\000\001\222\224\214\276\367\006\232\326u\255mk\212Ru\255\232"
-  "\326\207\276\367\006\232\326u\255\212R\206\061mku\255\213\276\367\001\206\061\243"
-  "\000\000\001\232\326\207\276\367\001\232\326\202\000\000\001\232\326\212\276\367\004\212"
-  "R\276\367mk\206\061\202\276\367\202\222\224\211\276\367\001u\255\210\000\000\001\222"
-  "\224\216\276\367\002u\255mk\207\000\000\001\222\224\204\276\367\002\000\000\232\326\202"
-  "\276\367\001\232\326\232\000\000\002\232\326u\255\370\000\000\001\206\061\214\276\367\004"
-  "\222\224\000\000mk\232\326\215\276\367\004\232\326mk\000\000\222\224\212\276\367\001"
-  "\232\326\243\000\000\001\232\326\207\276\367\003\232\326\000\000\206\061\212\276\367\005"
-  "\222\224\206\061\222\224\206\061u\255\202\276\367\002\206\061\232\326\211\276"
-  "\367\001\212R\206\000\000\001mk\222\276\367\001u\255\207\000\000\001\232\326\203\276\367"
-  "\002\222\224mk\203\276\367\001mk\231\000\000\002\276\367\212R\370\000\000\001\222\224\212"
-  "\276\367\004\232\326\212R\206\061\232\326\221\276\367\003\232\326\212Rmk\212\276"
-  "\367\001\206\061\242\000\000\001\232\326\207\276\367\003\232\326\000\000u\255\207\276\367"
-  "\004\232\326\222\224\000\000\206\061\202\232\326\005\206\061\232\326\276\367\232\326"
-  "\000\000\211\276\367\001\232\326\206\000\000\001u\255\225\276\367\001mk\205\000\000\001\222\224"
-  "\204\276\367\002\000\000\232\326\202\276\367\001u\255\230\000\000\002mk\276\367\371\000\000"
-  "\212\276\367\003\232\326\000\000\222\224\225\276\367\003\222\224mk\232\326\210\276"
-  "\367\001u\255\242\222\224\001\232\326\207\276\367\002\232\326\000\000\204\276\367\013"
-  "\232\326\222\224\212R\000\000\206\061\222\224\232\326\276\367\232\326mk\222\224"
-  "\202\276\367\202u\255\211\276\367\001\212R\204\000\000\002\206\061\232\326\227\276"
-  "\367\001mk\204\000\000\002\206\061\232\326\203\276\367\002\222\224u\255\202\276\367"
-  "\001\232\326\230\000\000\002\222\224\232\326\370\000\000\001mk\211\276\367\003\222\224\000"
-  "\000u\255\227\276\367\002u\255\206\061\263\276\367\011\232\326\000\000\232\326u\255"
-  "\222\224\206\061\000\000\222\224\232\326\202\276\367\005\232\326u\255\212R\000\000\222"
-  "\224\203\276\367\002\206\061\232\326\210\276\367\001\232\326\205\000\000\001\232\326"
-  "\231\276\367\001mk\204\000\000\001\222\224\203\276\367\002\232\326mk\203\276\367\001"
-  "\212R\227\000\000\202\232\326\370\000\000\001u\255\210\276\367\003\232\326\000\000u\255\231"
-  "\276\367\202u\255\262\276\367\003\232\326\206\061\276\367\202u\255\001\232\326"
-  "\202\276\367\001u\255\202mk\004\000\000\206\061mk\232\326\204\276\367\001\206\061\211"
-  "\276\367\001\222\224\204\000\000\001\232\326\232\276\367\002\232\326\206\061\203\000\000"
-  "\001\212R\204\276\367\001\000\000\203\276\367\001mk\227\000\000\002\276\367\222\224\370\000"
-  "\000\211\276\367\002\222\224u\255\233\276\367\002u\255\232\326\261\276\367\002u\255"
-  "mk\202\276\367\003\232\326\222\224mk\202\212R\003mku\255\232\326\206\276\367"
-  "\002\232\326\206\061\211\276\367\001\212R\203\000\000\001u\255\234\276\367\001\232\326"
-  "\204\000\000\204\276\367\002mk\232\326\202\276\367\001u\255\226\000\000\002\212R\276\367"
-  "\370\000\000\001mk\211\276\367\001mk\235\276\367\001mk\261\276\367\003\222\224\232\326"
-  "\276\367\203mk\002u\255\232\326\212\276\367\002u\255\222\224\210\276\367\001\232"
-  "\326\203\000\000\001mk\236\276\367\001mk\203\000\000\001u\255\203\276\367\202u\255\202"
-  "\276\367\001\232\326\226\000\000\002\222\224\276\367\370\000\000\001u\255\210\276\367\002"
-  "u\255\232\326\214\276\367\002\232\326\276\367\202\232\326\215\276\367\002\232"
-  "\326u\255\260\276\367\002\222\224\232\326\220\276\367\002\212Ru\255\210\276\367"
-  "\001\232\326\203\000\000\001\232\326\214\276\367\001\232\326\202u\255\001\222\224\202"
-  "u\255\214\276\367\002\232\326\206\061\202\000\000\001mk\203\276\367\002\232\326u\255"
-  "\203\276\367\001\206\061\225\000\000\202\232\326\370\000\000\001\232\326\210\276\367\001"
-  "u\255\213\276\367\002\232\326mk\204\000\000\002\206\061\222\224\214\276\367\001u\255"
-  "\260\276\367\002\206\061\232\326\220\276\367\002\206\061\232\326\210\276\367\001"
-  "u\255\202\000\000\001mk\213\276\367\002\232\326\222\224\206\000\000\002\206\061u\255\213"
-  "\276\367\001u\255\202\000\000\001mk\203\276\367\002\232\326mk\203\276\367\001mk\225\000"
-  "\000\002\232\326u\255\370\000\000\210\276\367\002u\255\232\326\212\276\367\001mk\210"
-  "\000\000\002\206\061u\255\213\276\367\001\232\326\257\276\367\002\206\061\232\326\217"
-  "\276\367\002\232\326\206\061\211\276\367\001\222\224\202\000\000\213\276\367\001\232"
-  "\326\212\000\000\001mk\213\276\367\203\000\000\204\276\367\001\206\061\203\276\367\001\222"
-  "\224\224\000\000\003\212R\276\367mk\367\000\000\001\212R\210\276\367\001\222\224\212\276"
-  "\367\001mk\213\000\000\001u\255\212\276\367\001\222\224\257\276\367\002\000\000\232\326\210"
-  "\276\367\002\232\326u\255\202\206\061\001u\255\202\276\367\002\232\326\222\224\211"
-  "\276\367\001\212R\202\000\000\212\276\367\001\232\326\214\000\000\001mk\212\276\367\001\212"
-  "R\202\000\000\001\232\326\203\276\367\001\206\061\203\276\367\001u\255\224\000\000\003u\255"
-  "\276\367\206\061\367\000\000\001\222\224\210\276\367\001\232\326\211\276\367\001\222"
-  "\224\215\000\000\001\232\326\211\276\367\001\232\326\256\276\367\003\232\326\000\000\232"
-  "\326\204\276\367\001u\255\202\206\061\004\000\000\212R\222\224u\255\202\000\000\004\232"
-  "\326\276\367\232\326\222\224\211\276\367\003\212R\000\000u\255\212\276\367\001\212"
-  "R\215\000\000\001\232\326\211\276\367\001u\255\202\000\000\001\232\326\203\276\367\001\206"
-  "\061\203\276\367\001u\255\224\000\000\002\232\326u\255\370\000\000\001u\255\207\276\367"
-  "\202\232\326\211\276\367\001\206\061\215\000\000\001mk\212\276\367\001\232\326\255\276"
-  "\367\003u\255\000\000\222\224\204\276\367\202\232\326\205\276\367\001\212R\202\222"
-  "\224\003\276\367\232\326\222\224\211\276\367\003\212R\000\000\232\326\211\276\367"
-  "\001u\255\216\000\000\001\212R\211\276\367\001u\255\202\000\000\001\232\326\203\276\367\001"
-  "\000\000\203\276\367\001u\255\223\000\000\003mk\276\367mk\370\000\000\001\232\326\207\276\367"
-  "\001\232\326\211\276\367\001\222\224\217\000\000\001\232\326\211\276\367\001\232\326"
-  "\255\276\367\003\232\326mk\222\224\213\276\367\006\206\061\276\367\212R\276\367"
-  "u\255\222\224\211\276\367\003\206\061\000\000\232\326\211\276\367\001\212R\217\000\000"
-  "\001\232\326\211\276\367\202\000\000\001\222\224\203\276\367\002mk\232\326\203\276"
-  "\367\222\000\000\003\212R\276\367\232\326\371\000\000\210\276\367\001u\255\211\276\367"
-  "\001\212R\217\000\000\001u\255\211\276\367\001u\255\256\276\367\002u\255\212R\213\276"
-  "\367\006\206\061\276\367\206\061\276\367u\255\232\326\210\276\367\001\232\326\202"
-  "\000\000\212\276\367\001\206\061\217\000\000\001u\255\211\276\367\003\206\061\000\000\222\224"
-  "\203\276\367\002\222\224\232\326\203\276\367\221\212R\001u\255\202\276\367\001"
-  "mk\371\000\000\210\276\367\001\222\224\211\276\367\001\212R\217\000\000\001u\255\211\276"
-  "\367\001\222\224\256\276\367\003\232\326\000\000\222\224\207\276\367\011\232\326u"
-  "\255mk\206\061\276\367\212R\276\367\222\224\232\326\210\276\367\001\232\326"
-  "\202\000\000\212\276\367\001\206\061\217\000\000\001u\255\211\276\367\003mk\000\000mk\203\276"
-  "\367\002\222\224u\255\225\276\367\002\232\326\212R\371\000\000\001\222\224\207\276"
-  "\367\002\232\326mk\211\276\367\001\212R\217\000\000\001\222\224\211\276\367\001\222\224"
-  "\256\276\367\001\232\326\202\000\000\001\232\326\204\276\367\001\232\326\202\212R\010"
-  "\222\224u\255\232\326\222\224\206\061\276\367\212R\232\326\210\276\367\001\232"
-  "\326\202\000\000\212\276\367\001\206\061\217\000\000\001u\255\211\276\367\001\212R\202\000"
-  "\000\203\276\367\002u\255mk\226\212R\001\222\224\205u\255\364\232\326\210\276\367"
-  "\002\232\326mk\211\276\367\001\212R\217\000\000\001u\255\211\276\367\001\222\224\253"
-  "\276\367\203u\255\004\212R\000\000mk\232\326\202\276\367\002u\255\212R\202\000\000\003"
-  "\212R\206\061\212R\202mk\004\232\326\276\367\212R\232\326\210\276\367\001\232"
-  "\326\202\000\000\212\276\367\220\000\000\001u\255\211\276\367\001\206\061\202\000\000\377"
-  "\276\367\236\276\367\002u\255mk\211\276\367\001\222\224\217\000\000\001\232\326\211"
-  "\276\367\002\222\224\232\326\246\276\367\002mk\206\061\207\000\000\002\222\224\232\326"
-  "\202\276\367\203\232\326\001u\255\207\276\367\002\212R\232\326\210\276\367\001"
-  "\232\326\202\000\000\212\276\367\001u\255\216\000\000\001\206\061\212\276\367\203\000\000"
-  "\377\276\367\236\276\367\002u\255mk\211\276\367\001\232\326\216\000\000\001\212R\212"
-  "\276\367\002\222\224\232\326\242\276\367\203\232\326\001\222\224\213\000\000\003\212"
-  "R\222\224u\255\206\232\326\216\276\367\001\232\326\202\000\000\001u\255\212\276\367"
-  "\216\000\000\001\222\224\212\276\367\202\000\000\001\222\224\216\276\367\377\232\326"
-  "\217\232\326\003\222\224\206\061\000\000\212\276\367\001\222\224\215\000\000\001\232\326"
-  "\212\276\367\002\212R\232\326\203\276\367\236\232\326\001\222\224\230\000\000\211"
-  "\206\061\001mk\204u\255\001mk\202\000\000\001\206\061\212\276\367\001u\255\214\000\000\001\206"
-  "\061\212\276\367\001u\255\202\000\000\001\222\224\202\276\367\204\232\326\203u\255"
-  "\001\222\224\204\206\061\377\000\000\222\000\000\213\276\367\001\212R\213\000\000\001\222\224"
-  "\213\276\367\001\000\000\203\206\061\001\212R\311\000\000\001\232\326\212\276\367\001\222"
-  "\224\212\000\000\002\206\061\232\326\212\276\367\001\212R\202\000\000\003\212R\222\224\206"
-  "\061\377\000\000\236\000\000\001u\255\213\276\367\001\212R\211\000\000\001\222\224\213\276\367"
-  "\001u\255\316\000\000\001\222\224\213\276\367\001u\255\210\000\000\002mk\232\326\212\276"
-  "\367\001u\255\377\000\000\244\000\000\001\212R\214\276\367\002u\255\212R\205\000\000\002mk\232"
-  "\326\214\276\367\001\212R\317\000\000\215\276\367\001\222\224\204\206\061\002mk\232"
-  "\326\214\276\367\001mk\377\000\000\245\000\000\001\232\326\215\276\367\205\232\326\215"
-  "\276\367\001\232\326\320\000\000\001u\255\236\276\367\001\232\326\377\000\000\246\000\000\001"
-  "\212R\237\276\367\001\212R\321\000\000\001\232\326\235\276\367\001\206\061\377\000\000\247"
-  "\000\000\001u\255\235\276\367\001u\255\322\000\000\001mk\234\276\367\001\222\224\377\000\000"
-  "\251\000\000\235\276\367\324\000\000\001\222\224\232\276\367\001u\255\377\000\000\252\000\000"
-  "\001\212R\233\276\367\001\212R\324\000\000\002\206\061\222\224\230\276\367\001u\255\377"
-  "\000\000\254\000\000\001\212R\231\276\367\001\212R\327\000\000\001\222\224\226\276\367\001u\255"
-  "\377\000\000\256\000\000\001\212R\227\276\367\001\212R\331\000\000\001\222\224\224\276\367"
-  "\001\222\224\377\000\000\260\000\000\002\206\061u\255\223\276\367\002u\255\206\061\333\000"
-  "\000\002\206\061u\255\220\276\367\002\232\326\212R\377\000\000\263\000\000\002\212R\232\326"
-  "\217\276\367\002\232\326mk\337\000\000\002\206\061u\255\213\276\367\202\232\326\001"
-  "\212R\377\000\000\267\000\000\003\212Ru\255\232\326\211\276\367\003\232\326u\255mk\344"
-  "\000\000\002\206\061\222\224\206\232\326\002\222\224\212R\377\000\000\275\000\000\001\206\061"
-  "\207\222\224\001\206\061\275\000\000",
-};
-
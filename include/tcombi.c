@@ -1,103 +0,0 @@
-/* GIMP RGB C-Source image dump 1-byte-run-length-encoded (tcombi.c) */
-
-#define TCOMBI_RUN_LENGTH_DECODE(image_buf, rle_data, size, bpp) do \
-{ unsigned int __bpp; unsigned char *__ip; const unsigned char *__il, *__rd; \
-  __bpp = (bpp); __ip = (image_buf); __il = __ip + (size) * __bpp; \
-  __rd = (rle_data); if (__bpp > 3) { /* RGBA */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 4); __ip += 4; } while (--__l); __rd += 4; \
-      } else { __l *= 4; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else if (__bpp == 3) { /* RGB */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 3); __ip += 3; } while (--__l); __rd += 3; \
-      } else { __l *= 3; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else { /* RGB16 */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 2); __ip += 2; } while (--__l); __rd += 2; \
-      } else { __l *= 2; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } } while (0)
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 rle_pixel_data[1682 + 1];
-} tcombi = {
-  48, 39, 2,
-  "\210\000\000\001E)\202mk\204\337\377\005\232\326iJmkiJ\266\265\203\337\377\004\232"
-  "\326iJmkiJ\234\000\000\002mk\232\326\202\337\377\001\232\326\204\266\265\204\337"
-  "\377\202\266\265\205\337\377\202\266\265\001\262\224\230\000\000\001mk\203\337\377"
-  "\002iJE)\204\000\000\003iJmk\262\224\203\337\377\003\266\265iJmk\207\337\377\001\232"
-  "\326\224\000\000\001iJ\202\337\377\001iJ\214\000\000\001\232\326\203\337\377\202E)\001\232"
-  "\326\203\337\377\001\232\326\203\337\377\001\262\224\220\000\000\001mk\202\337\377"
-  "\001mk\217\000\000\003\262\224\266\265\232\326\210\337\377\003\232\326\337\377\266"
-  "\265\216\000\000\001iJ\202\337\377\001iJ\223\000\000\003iJmk\232\326\203\337\377\202mk"
-  "\003\262\224\232\326\337\377\216\000\000\003\262\224\337\377\232\326\224\000\000\002iJ"
-  "\262\224\206\337\377\006\232\326E)\337\377iJmkiJ\213\000\000\202\337\377\001iJ\223"
-  "\000\000\004mk\337\377\266\265mk\203\000\000\002\262\224\232\326\206\337\377\001\262\224"
-  "\211\000\000\003\232\326\337\377\266\265\223\000\000\202\232\326\001mk\204\000\000\001\262"
-  "\224\203iJ\001\000\000\205\337\377\001iJ\206\000\000\005iJ\232\326\337\377\232\326\266"
-  "\265\222\000\000\202\232\326\202\000\000\001\262\224\206\337\377\001\266\265\202\337"
-  "\377\003\266\265\000\000mk\202\337\377\003\232\326iJmk\203\000\000\001\337\377\202\266"
-  "\265\001\337\377\221\000\000\001E)\202\232\326\202\000\000\015\266\265\337\377\232\326"
-  "\266\265\337\377\232\326\337\377\266\265\337\377iJ\000\000mk\266\265\204\337"
-  "\377\002\232\326\337\377\202\266\265\002\000\000\337\377\202\000\000\001\337\377\221\000"
-  "\000\002iJ\232\326\202\000\000\004\266\265\337\377\000\000\266\265\202\337\377\005\266\265"
-  "iJmk\232\326\000\000\204\337\377\002\266\265\337\377\203iJ\001\232\326\203\337\377"
-  "\202\000\000\001\337\377\220\000\000\011E)\337\377\262\224\000\000\262\224\337\377\000\000\337"
-  "\377\232\326\202\337\377\001\266\265\202\000\000\001\266\265\205\337\377\202\266"
-  "\265\204\000\000\006\262\224\337\377\232\326\266\265\000\000\337\377\220\000\000\016\232"
-  "\326\266\265\000\000\262\224\337\377\232\326\266\265\337\377\266\265\337\377"
-  "\000\000mk\000\000mk\206\337\377\202\266\265\003\000\000\266\265mk\202\262\224\005\337\377"
-  "iJ\337\377E)\337\377\217\000\000\002\266\265\232\326\202\000\000\002\337\377\232\326"
-  "\203\337\377\002\262\224\232\326\203\000\000\001mk\213\337\377\007mk\000\000\337\377\000"
-  "\000\266\265\232\326\337\377\217\000\000\006\232\326iJ\000\000\266\265\337\377E)\204"
-  "\337\377\001iJ\202\000\000\002E)mk\213\337\377\005\266\265\000\000\337\377\000\000mk\202\337"
-  "\377\002\232\326E)\214\000\000\005iJ\232\326E)iJ\337\377\202iJ\002\232\326\337\377"
-  "\202\266\265\001iJ\202\000\000\002\232\326iJ\207\337\377\002\266\265\337\377\202\232"
-  "\326\003mk\262\224\337\377\202\000\000\001\266\265\202\337\377\001iJ\214\000\000\005\232"
-  "\326\262\224\000\000\266\265\232\326\202\000\000\002iJmk\205\000\000\003\337\377\000\000\266"
-  "\265\203\337\377\006\232\326\337\377\000\000\232\326\337\377\262\224\202E)\002\266"
-  "\265\262\224\203\000\000\003\337\377\266\265\262\224\214\000\000\001\337\377\202\000\000"
-  "\002\337\377\262\224\211\000\000\003\337\377E)\266\265\202\337\377\002\266\265\337"
-  "\377\202\000\000\007\337\377\000\000iJ\000\000E)\266\265mk\203\000\000\003\337\377\000\000\266\265"
-  "\213\000\000\005E)\337\377\000\000\266\265\337\377\212\000\000\003\262\224\337\377\232\326"
-  "\204\337\377\011\000\000\266\265\337\377\266\265\262\224mkiJ\266\265mk\203\000\000"
-  "\006\337\377\266\265\000\000iJ\232\326E)\210\000\000\005\337\377\262\224\000\000\337\377"
-  "mk\210\000\000\003iJ\000\000\266\265\206\337\377\002\000\000\266\265\204\337\377\003iJ\232"
-  "\326mk\203\000\000\002\337\377\266\265\202\000\000\003\266\265\232\326mk\207\000\000\001\337"
-  "\377\202\000\000\001\337\377\211\000\000\202\266\265\205\337\377\003\262\224\337\377"
-  "E)\207\337\377\001iJ\203\000\000\202\266\265\202\000\000\004mk\266\265\337\377\262\224"
-  "\206\000\000\001\337\377\202\000\000\001\266\265\207\000\000\004E)\000\000\337\377\266\265\204"
-  "\337\377\004\232\326\262\224\337\377iJ\206\337\377\001\266\265\204\000\000\202\337"
-  "\377\004iJ\000\000mk\000\000\202\337\377\001iJ\205\000\000\001\337\377\213\000\000\003\262\224\337"
-  "\377\266\265\203\337\377\001\232\326\203\337\377\001\000\000\206\337\377\001\262\224"
-  "\204\000\000\202\337\377\202iJ\007\262\224\337\377\232\326mk\337\377\232\326E)"
-  "\203\000\000\001\337\377\205\000\000\002iJmk\202\232\326\005\000\000\262\224\337\377iJ\266"
-  "\265\206\337\377\001\262\224\206\337\377\001\262\224\205\000\000\003iJ\337\377\232"
-  "\326\202\337\377\001\262\224\202\000\000\003mk\232\326\337\377\203\000\000\017\337\377"
-  "\000\000mkE)\000\000mk\337\377\266\265\262\224mk\000\000iJ\337\377\262\224\266\265\213"
-  "\337\377\001\232\326\210\000\000\001iJ\202mk\001iJ\205\000\000\002\232\326\337\377\202\000"
-  "\000\003\337\377\000\000\266\265\202iJ\202\337\377\001\232\326\202\000\000\007\337\377\000"
-  "\000\337\377mk\266\265\337\377\232\326\203\337\377\001\232\326\205\337\377\223"
-  "\000\000\007\266\265\337\377\262\224\337\377E)\266\265\232\326\204\337\377\005\000"
-  "\000E)\337\377\000\000\337\377\202\266\265\204\337\377\002\000\000\266\265\204\337\377"
-  "\225\000\000\001mk\202\337\377\002\232\326\266\265\205\337\377\004\232\326\337\377"
-  "\266\265\000\000\205\337\377\004\262\224\000\000\262\224\232\326\202\337\377\001\266"
-  "\265\230\000\000\202\337\377\003\232\326\337\377\232\326\204\337\377\001\262\224"
-  "\202\000\000\006\337\377mk\266\265\337\377iJ\232\326\203\337\377\002\232\326iJ\232"
-  "\000\000\002\337\377\266\265\205\337\377\001\262\224\203\000\000\006\232\326\337\377\262"
-  "\224\232\326\337\377\266\265\202\337\377\001\266\265\235\000\000\203\337\377\210"
-  "\000\000\001\232\326\203\337\377\002\232\326\262\224\240\000\000\003\337\377\232\326\266"
-  "\265\204\000\000\004\232\326\266\265\000\000mk\203\337\377\001\266\265\241\000\000\001\266"
-  "\265\203\337\377\005iJmkiJ\337\377\266\265\202\337\377\001\262\224\245\000\000\001"
-  "\232\326\206\337\377\002\266\265\262\224\250\000\000\001\232\326\205\337\377\001\266"
-  "\265\252\000\000\205\337\377\001\266\265\252\000\000\002\262\224\232\326\203\337\377"
-  "\001\262\224\254\000\000\004\266\265\337\377iJE)\223\000\000",
-};
-
@@ -1,66 +0,0 @@
-/* GIMP RGBA C-Source image dump 1-byte-run-length-encoded (temperature.c) */
-
-#define TEMPERATURE_RUN_LENGTH_DECODE(image_buf, rle_data, size, bpp) do \
-{ unsigned int __bpp; unsigned char *__ip; const unsigned char *__il, *__rd; \
-  __bpp = (bpp); __ip = (image_buf); __il = __ip + (size) * __bpp; \
-  __rd = (rle_data); if (__bpp > 3) { /* RGBA */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 4); __ip += 4; } while (--__l); __rd += 4; \
-      } else { __l *= 4; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else if (__bpp == 3) { /* RGB */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 3); __ip += 3; } while (--__l); __rd += 3; \
-      } else { __l *= 3; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else { /* RGB16 */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 2); __ip += 2; } while (--__l); __rd += 2; \
-      } else { __l *= 2; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } } while (0)
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */ 
-  unsigned char	 rle_pixel_data[866 + 1];
-} temperature = {
-  17, 36, 2,
-  "\204\000\000\001T\255\203\377\377\001P\204\213\000\000\001T\255\202\377\377\001T\255\202"
-  "\377\377\001T\255\211\000\000\003T\255\377\377T\255\203\000\000\003T\255\377\377P\204\210"
-  "\000\000\202\377\377\204\000\000\003\303\030\377\377T\255\210\000\000\002\377\377T\255\205"
-  "\000\000\002\377\377T\255\210\000\000\002\377\377T\255\205\000\000\004\377\377T\255\000\000mk\203"
-  "P\204\001mk\202\000\000\002\377\377T\255\205\000\000\003\377\377T\255\000\000\205\377\377\202"
-  "\000\000\002\377\377T\255\205\000\000\004\377\377T\255\000\000iJ\203P\204\001iJ\202\000\000\002\377"
-  "\377T\255\205\000\000\004\377\377T\255\000\000iJ\202mk\204\000\000\002\377\377T\255\205\000"
-  "\000\003\377\377T\255\000\000\203\377\377\001mk\203\000\000\002\377\377T\255\202\000\000\001E)"
-  "\202\000\000\004\377\377T\255\000\000iJ\202mk\204\000\000\013\377\377T\255\000\000T\255\377"
-  "\377T\255\000\000\377\377T\255\000\000iJ\203P\204\001iJ\202\000\000\003\377\377T\255\000\000"
-  "\202\377\377\005T\255\000\000\377\377T\255\000\000\205\377\377\202\000\000\003\377\377T\255"
-  "\000\000\202\377\377\006T\255\000\000\377\377T\255\000\000iJ\203P\204\001mk\202\000\000\003\377"
-  "\377T\255\000\000\202\377\377\010T\255\000\000\377\377T\255\000\000E)P\204mk\204\000\000\003"
-  "\377\377T\255\000\000\202\377\377\005T\255\000\000\377\377T\255\000\000\203\377\377\001m"
-  "k\203\000\000\003\377\377T\255\000\000\202\377\377\006T\255\000\000\377\377T\255\000\000mk\202"
-  "T\255\204\000\000\003\377\377T\255\000\000\202\377\377\006T\255\000\000\377\377T\255\000\000"
-  "\303\030\203iJ\001\303\030\202\000\000\003\377\377T\255\000\000\202\377\377\005T\255\000\000"
-  "\377\377T\255\000\000\205\377\377\202\000\000\003\377\377T\255\000\000\202\377\377\006T\255"
-  "\000\000\377\377T\255\000\000P\204\203T\255\001P\204\202\000\000\003\377\377T\255\000\000\202"
-  "\377\377\004T\255\000\000\377\377T\255\210\000\000\003\377\377T\255\000\000\202\377\377\004"
-  "T\255\000\000\377\377T\255\210\000\000\003\377\377T\255\000\000\202\377\377\004T\255\000\000"
-  "\377\377T\255\210\000\000\003\377\377T\255\000\000\202\377\377\004T\255\000\000\377\377T"
-  "\255\210\000\000\003\377\377T\255\000\000\202\377\377\004T\255\000\000\377\377T\255\207\000"
-  "\000\004P\204\377\377T\255\000\000\202\377\377\002T\255\000\000\202\377\377\001P\204\205"
-  "\000\000\001iJ\202\377\377\002E)iJ\203\377\377\202iJ\202\377\377\001\303\030\204\000\000"
-  "\002T\255\377\377\202mk\205\377\377\004iJP\204\377\377P\204\204\000\000\202\377\377"
-  "\002\000\000T\255\205\377\377\004T\255\000\000\377\377T\255\204\000\000\003\377\377T\255\000"
-  "\000\206\377\377\002T\255\000\000\202\377\377\204\000\000\202\377\377\001\000\000\206\377\377"
-  "\004T\255\000\000\377\377T\255\204\000\000\004T\255\377\377iJmk\205\377\377\202mk\002\377"
-  "\377T\255\204\000\000\005mk\377\377T\255\000\000mk\202\377\377\003T\255mkE)\202\377\377"
-  "\001E)\205\000\000\004T\255\377\377T\255iJ\203\000\000\001iJ\202\377\377\001P\204\207\000\000"
-  "\001T\255\203\377\377\001T\255\203\377\377\001T\255\211\000\000\002mkT\255\203\377\377"
-  "\002T\255iJ\207\000\000",
-};
-
@@ -1,74 +0,0 @@
-/* GIMP RGBA C-Source image dump 1-byte-run-length-encoded (waterHeater.c) */
-
-#define WATERHEATER_RUN_LENGTH_DECODE(image_buf, rle_data, size, bpp) do \
-{ unsigned int __bpp; unsigned char *__ip; const unsigned char *__il, *__rd; \
-  __bpp = (bpp); __ip = (image_buf); __il = __ip + (size) * __bpp; \
-  __rd = (rle_data); if (__bpp > 3) { /* RGBA */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 4); __ip += 4; } while (--__l); __rd += 4; \
-      } else { __l *= 4; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else if (__bpp == 3) { /* RGB */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 3); __ip += 3; } while (--__l); __rd += 3; \
-      } else { __l *= 3; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } else { /* RGB16 */ \
-    while (__ip < __il) { unsigned int __l = *(__rd++); \
-      if (__l & 128) { __l = __l - 128; \
-        do { memcpy (__ip, __rd, 2); __ip += 2; } while (--__l); __rd += 2; \
-      } else { __l *= 2; memcpy (__ip, __rd, __l); \
-               __ip += __l; __rd += __l; } } \
-  } } while (0)
-static const struct {
-  unsigned int 	 width;
-  unsigned int 	 height;
-  unsigned int 	 bytes_per_pixel; /* 2:RGB16, 3:RGB, 4:RGBA */
-  unsigned char	 rle_pixel_data[1135 + 1];
-} waterHeater = {
-  30, 26, 2,
-  "\207\040\000\007A\010\303\030\004!Mk\317{U\255y\316\202\232\326\006Y\316q\214\357{\212"
-  "R\004!\202\020\214\040\000\007\000\000\303\030\246\061q\214\272\326\333\336}\357\210\276"
-  "\367\007}\357\333\336y\316Q\214\246\061\303\030\000\000\206\040\000\005\000\000$!Q\214\327"
-  "\275\333\336\202\276\367\004}\357<\347\030\306\327\275\204\266\265\004\367\275"
-  "\030\306<\347}\357\202\276\367\005\333\336\327\275,c$!\000\000\203\040\000\003\206\061"
-  "q\214\272\326\202\236\367\006]\357\327\275U\255,c\010Ba\010\206\000\000\016a\010\010"
-  "B,cU\255\327\275]\357\276\367]\357\232\326Q\214e)\000\000\347\071\272\326\202"
-  "\236\367\003\034\347\024\245IJ\203\000\000\212\040\000\203\000\000\003\353Z\226\265\034\347"
-  "\202\236\367\010\070\306\010Bu\255\276\367]\357\024\245\206\061\000\000\221\040\000\202"
-  "\000\000\011\206\061\024\245]\357\236\367\327\275y\316\236\367\024\245\000\000\226\040"
-  "\000\003\000\000\024\245\236\367\202y\316\002}\357,c\230\040\000\002,c}\357\202y\316\005}\357"
-  ",c\040\000\004!e)\202\040\000\004\206\061\256s(B\000\000\202\040\000\010\252RMk\004!\040\000\000\000"
-  "(B\256s\206\061\202\040\000\005\242\020\246\061\000\000,c}\357\202y\316\034}\357,c\000\000"
-  "Mk\232\326q\214,cY\316\276\367\034\347\363\234\014c\363\234<\347\276\367\226"
-  "\265,c\020\204\333\336\276\367\030\306,c\317{\232\326q\214\000\000,c}\357\202y"
-  "\316\005}\357,c\040\000\206\061\232\326\202\276\367\004\373\336\226\265y\316\236"
-  "\367\202\276\367\003\070\306\367\275<\347\202\276\367\003y\316\363\234\333\336"
-  "\202\276\367\005\272\326\313Z\000\000,c}\357\202y\316\002}\357mk\202\000\000\001\313Z\202"
-  "\226\265\025\014c\000\000$!\020\204\327\275q\214\242\020\000\000Q\214\266\265U\255E)"
-  "\000\000iJ\327\275\266\265,c\000\000\040\000,c}\357\202y\316\004}\357\014c\040\000a\010\203"
-  "\000\000\003\303\030iJe)\203\000\000\003$!IJA\010\202\000\000\003\004!iJ\303\030\203\000\000\004\343\030"
-  "\040\000,c}\357\202y\316\027}\357,c\000\000\353Zq\214\252R(B\222\224\373\336\367"
-  "\275IJ(BiJ\373\336\272\326\020\204(BIJ\367\275}\357\262\224e)\246\061\202\020"
-  "\204\003\000\000,c}\357\202y\316\005}\357,c\040\000(B\373\336\203]\357\007\030\306<\347"
-  "}\357]\357}\357\373\336\333\336\202]\357\003}\357<\347\030\306\203<\347\005\333"
-  "\336,c\000\000,c}\357\202y\316\002}\357Mk\202\000\000\030Mk\232\326\333\336\256s\303"
-  "\030IJU\255\373\336\323\234\246\061E)q\214\373\336U\255\212R\303\030\256s\272"
-  "\326\232\326mk\000\000\040\000,c}\357\202y\316\002}\357,c\202\040\000\011\000\000\303\030\004"
-  "!\040\000$!\000\000\202\020\004!A\010\202\000\000\010a\010\004!\202\020\000\000\004!\040\000\343\030\303"
-  "\030\203\040\000\002,c}\357\202y\316\034}\357,c\000\000\212R\216s\246\061\242\020,cy\316"
-  "\363\234(BA\010\212Ru\255y\316iJa\010\246\061\363\234\232\326\317{\202\020\004"
-  "!\256smk\000\000,c}\357\202y\316\034}\357,c\000\000\313Z}\357\333\336\272\326]\357"
-  "}\357\236\367\373\336\232\326<\347\236\367}\357<\347\272\326\373\336\236"
-  "\367}\357<\347\272\326\333\336}\357\317{\000\000,c}\357\202y\316\025}\357,c\040"
-  "\000\000\000U\255\333\336]\357\323\234\252RMk\333\336}\357\070\306,c\252Ru\255}"
-  "\357\232\326\020\204\246\061\262\224\202]\357\005U\255\000\000\040\000,c}\357\202y\316"
-  "\015}\357\216s\000\000\040\000\000\000\246\061IJ\202\020\040\000\000\000\004!iJ\303\030\202\040\000"
-  "\004\004!iJE)\000\000\202\040\000\202IJ\001A\010\202\040\000\002,c}\357\202y\316\002}\357\014c"
-  "\230\040\000\002\014c}\357\202y\316\003\236\367\060\204\000\000\226\040\000\003\000\000\060\204"
-  "\236\367\202y\316\004\236\367\232\326\317{\252R\224\212R\010\252R\060\204\272"
-  "\326\236\367y\316q\214\276\367\236\367\227}\357\202\236\367\004]\357Q\214\206"
-  "\061U\255\232\272\326\002q\214\206\061",
-};
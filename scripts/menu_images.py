@@ -0,0 +1,271 @@
+"""
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+
+Converts the menu images in images/ into the display-native format described in include/MenuImage.h and writes
+include/MenuImages.h and src/MenuImages.cpp. Sources are GIMP "C source" dumps (RGB16, with or without RLE) or
+non-interlaced PNGs; PNG alpha below 50 % becomes transparent. Export XCF files to one of those first.
+
+Runs as a PlatformIO pre script and only rewrites the outputs if a source or this script is newer. Can also be run
+by hand: python3 scripts/menu_images.py
+"""
+
+import os
+import re
+import struct
+import sys
+import zlib
+
+# Symbol name, source file in images/.
+ASSETS = [
+    ("roadcruiser_xl", "roadcruiser_xl.c"),
+    ("airHeater", "airHeater.c"),
+    ("waterHeater", "waterHeater.c"),
+    ("tcombi", "tcombi.c"),
+    ("temperature", "temperature.c"),
+    ("wifiIndicator", "wifiIndicator.c"),
+]
+
+MAX_RUN = 64 * 256  # Packet length limit of the format.
+TRANSPARENT = None  # Pixel value of transparent pixels while converting.
+
+
+def rgb565(r, g, b):
+    return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3)
+
+
+def load_gimp(path):
+    text = open(path, encoding="latin-1").read()
+    match = re.search(r"=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,", text)
+    width, height, bpp = [int(v) for v in match.groups()]
+    body = text[match.end() :]
+    data = b"".join(lit.encode("latin-1").decode("unicode_escape").encode("latin-1")
+                    for lit in re.findall(r'"((?:[^"\\]|\\.)*)"', body))
+    if 2 != bpp:
+        raise ValueError("%s: only RGB16 dumps are supported" % path)
+    size = width * height * bpp
+    if "RUN_LENGTH_DECODE" in text:
+        raw = bytearray()
+        i = 0
+        while len(raw) < size:
+            length = data[i]
+            i += 1
+            if length & 128:
+                raw += data[i : i + bpp] * (length - 128)
+                i += bpp
+            else:
+                raw += data[i : i + length * bpp]
+                i += length * bpp
+    else:
+        raw = data[:size]
+    pixels = list(struct.unpack("<%dH" % (width * height), bytes(raw[:size])))
+    return width, height, pixels
+
+
+def load_png(path):
+    blob = open(path, "rb").read()
+    if blob[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("%s: not a PNG" % path)
+    pos = 8
+    idat = b""
+    palette = []
+    alpha = []
+    while pos < len(blob):
+        length, kind = struct.unpack(">I4s", blob[pos : pos + 8])
+        chunk = blob[pos + 8 : pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i : i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            alpha = list(chunk)
+        elif kind == b"IDAT":
+            idat += chunk
+    if interlace or (depth != 8 and color != 3 and color != 0) or depth == 16:
+        raise ValueError("%s: interlaced or 16 bit PNGs are not supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    stride = (width * channels * depth + 7) // 8
+    unit = max(1, channels * depth // 8)
+    raw = zlib.decompress(idat)
+    rows = []
+    previous = bytearray(stride)
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1 : (y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - unit] if i >= unit else 0
+            b = previous[i]
+            c = previous[i - unit] if i >= unit else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xff
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        rows.append(line)
+        previous = line
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            if depth < 8:
+                bit = x * depth
+                sample = (line[bit // 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1)
+                samples = [sample]
+            else:
+                samples = line[x * channels : (x + 1) * channels]
+            if color == 3:
+                r, g, b = palette[samples[0]]
+                a = alpha[samples[0]] if samples[0] < len(alpha) else 255
+            elif color in (0, 4):
+                v = samples[0] * 255 // ((1 << depth) - 1)
+                r, g, b, a = v, v, v, samples[1] if color == 4 else 255
+            else:
+                r, g, b = samples[:3]
+                a = samples[3] if color == 6 else 255
+            pixels.append(TRANSPARENT if a < 128 else rgb565(r, g, b))
+    return width, height, pixels
+
+
+def encode_row(values, unit, repeat_from):
+    """Packets: header bit 7 repeat, bit 6 long form, length - 1 in bits 0-5 plus the next byte << 6 if long."""
+    out = bytearray()
+
+    def header(repeat, count):
+        n = count - 1
+        if n < 64:
+            out.append((0x80 if repeat else 0) | n)
+        else:
+            out.append((0x80 if repeat else 0) | 0x40 | (n & 0x3f))
+            out.append(n >> 6)
+
+    i = 0
+    literal = []
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and values[i + run] == values[i] and run < MAX_RUN:
+            run += 1
+        if run >= repeat_from:
+            if literal:
+                header(False, len(literal))
+                out.extend(b"".join(unit(v) for v in literal))
+                literal = []
+            header(True, run)
+            out.extend(unit(values[i]))
+            i += run
+        else:
+            literal.append(values[i])
+            i += 1
+            if len(literal) == MAX_RUN:
+                header(False, len(literal))
+                out.extend(b"".join(unit(v) for v in literal))
+                literal = []
+    if literal:
+        header(False, len(literal))
+        out.extend(b"".join(unit(v) for v in literal))
+    return out
+
+
+def encode(width, height, pixels):
+    colors = sorted(set(p for p in pixels if p is not TRANSPARENT))
+    transparent = TRANSPARENT in pixels
+    candidates = []
+    if len(colors) + transparent <= 256:
+        palette = colors + ([0] if transparent else [])
+        index = dict((c, i) for i, c in enumerate(colors))
+        key = len(colors) if transparent else 0
+        values = [key if p is TRANSPARENT else index[p] for p in pixels]
+        candidates.append(("kMenuImagePalette", palette, key, values, lambda v: bytes([v]), 3))
+    key = next(c for c in range(0x10000) if c not in set(colors)) if transparent else 0
+    values = [key if p is TRANSPARENT else p for p in pixels]
+    candidates.append(("kMenuImageRgb565", [], key, values, lambda v: struct.pack("<H", v), 2))
+
+    best = None
+    for fmt, palette, key, values, unit, repeat_from in candidates:
+        data = bytearray()
+        offsets = []
+        for y in range(height):
+            offsets.append(len(data))
+            data += encode_row(values[y * width : (y + 1) * width], unit, repeat_from)
+        size = len(data) + 2 * len(palette) + 2 * height
+        if best is None or size < best[0]:
+            best = (size, fmt, palette, key, offsets, data)
+    size, fmt, palette, key, offsets, data = best
+    if offsets[-1] > 0xffff:
+        raise ValueError("image data exceeds the 64 KB row offsets")
+    return {"format": fmt, "palette": palette, "transparent": transparent, "key": key, "offsets": offsets,
+            "data": data, "size": size}
+
+
+def c_array(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("        " + ", ".join(fmt % v for v in values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def generate(root):
+    # The license paragraphs at the top of this script, as a C comment like in every other source file.
+    license_text = "/**" + "\n\n".join(__doc__.split("\n\n")[:2]) + "\n */\n"
+    hdr = [license_text, "", "// Generated by scripts/menu_images.py from images/, do not edit.", "",
+           "#ifndef MENU_IMAGES_H_", "#define MENU_IMAGES_H_", "", '#include "MenuImage.h"', ""]
+    src = [license_text, "", "// Generated by scripts/menu_images.py from images/, do not edit.", "",
+           '#include "MenuImages.h"', ""]
+    report = []
+    for name, source in ASSETS:
+        path = os.path.join(root, "images", source)
+        width, height, pixels = (load_png if source.endswith(".png") else load_gimp)(path)
+        image = encode(width, height, pixels)
+        hdr.append("extern const MenuImage %s; // %ux%u" % (name, width, height))
+        if image["palette"]:
+            src.append("static const uint16_t %s_palette[] = {\n%s\n};" % (name, c_array(image["palette"], "0x%04x", 12)))
+        src.append("static const uint16_t %s_rows[] = {\n%s\n};" % (name, c_array(image["offsets"], "%u", 12)))
+        src.append("static const uint8_t %s_data[] = {\n%s\n};" % (name, c_array(list(image["data"]), "0x%02x", 16)))
+        src.append("const MenuImage %s = {%u, %u, %s, %s, 0x%04x, %s, %s_rows, %s_data};" % (
+            name, width, height, image["format"], "true" if image["transparent"] else "false", image["key"],
+            "%s_palette" % name if image["palette"] else "0", name, name))
+        src.append("")
+        report.append("%-16s %3ux%-3u %-18s %6u bytes" % (name, width, height, image["format"], image["size"]))
+    hdr += ["", "#endif // MENU_IMAGES_H_", ""]
+    open(os.path.join(root, "include", "MenuImages.h"), "w").write("\n".join(hdr))
+    open(os.path.join(root, "src", "MenuImages.cpp"), "w").write("\n".join(src))
+    return report
+
+
+def outdated(root):
+    outputs = [os.path.join(root, "include", "MenuImages.h"), os.path.join(root, "src", "MenuImages.cpp")]
+    if not all(os.path.exists(p) for p in outputs):
+        return True
+    built = min(os.path.getmtime(p) for p in outputs)
+    sources = [os.path.join(root, "images", source) for _, source in ASSETS] + [os.path.join(root, "scripts", "menu_images.py")]
+    return any(os.path.getmtime(p) > built for p in sources)
+
+
+def main(root, force=False):
+    if force or outdated(root):
+        for line in generate(root):
+            print("MenuImages: " + line)
+
+
+try:
+    Import("env")  # noqa: F821, PlatformIO
+    main(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main(os.path.abspath(os.path.join(os.path.dirname(__file__), os.pardir)), "-f" in sys.argv)
@@ -0,0 +1,49 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#include "DisplayStream.h"
+
+
+void DisplayStream::setService(DisplayStreamService service, void* context) {
+        serviceContext = context;
+        this->service = service;
+}
+
+void DisplayStream::serviceTransfer(void) {
+        if (service && !servicing) {
+                servicing = true;
+                service(serviceContext);
+                servicing = false;
+        }
+}
+
+void DisplayStream::fillRect(Adafruit_ILI9341* display, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        int16_t rows = getChunkRows(w);
+        for (int16_t row = 0; row < h; row += rows) {
+                display->fillRect(x, y + row, w, min(rows, int16_t(h - row)), color);
+                serviceTransfer();
+        }
+}
+
+void DisplayStream::drawRGBBitmap(Adafruit_ILI9341* display, int16_t x, int16_t y, const uint16_t* pixels, int16_t w, int16_t h) {
+        int16_t rows = getChunkRows(w);
+        for (int16_t row = 0; row < h; row += rows) {
+                display->drawRGBBitmap(x, y + row, const_cast<uint16_t*>(pixels + row * w), w, min(rows, int16_t(h - row)));
+                serviceTransfer();
+        }
+}
@@ -0,0 +1,233 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#include "EnergyMenu.h"
+#include "defaults.h"
+
+static const uint64_t CHARGE_PER_DECI_AH = 360000000ULL; // mA * msec
+static const uint64_t ENERGY_PER_WH = 3600000000000ULL; // uW * msec
+static const char* const periodNames[kIbsPeriodCount] = {"day", "trip", "total"};
+
+// Columns in characters.
+static const uint8_t inColumn = 9;
+static const uint8_t outColumn = 18;
+static const uint8_t valueLength = 8;
+
+
+void EnergyMenu::addWidgets(void) {
+        widgets.add(&batteryLabel);
+        widgets.add(&current);
+        for (uint8_t p = 0; p < kIbsPeriodCount; ++p) {
+                widgets.add(&chargeIn[p]);
+                widgets.add(&chargeOut[p]);
+                widgets.add(&energyIn[p]);
+                widgets.add(&energyOut[p]);
+                chargeIn[p].setFormat(5, 1, "");
+                chargeOut[p].setFormat(5, 1, "");
+                energyIn[p].setFormat(7, 0, "");
+                energyOut[p].setFormat(7, 0, "");
+        }
+        widgets.add(&resetTripLabel);
+        battery = 0;
+        resetTrip = 0;
+        lastUpdate = 0;
+}
+
+void EnergyMenu::printScreenImplementation(void) {
+        commonPrintScreen();
+
+        h = Defaults.getFontH();
+        w = Defaults.getFontCharW();
+        uint16_t y = 3 * h;
+
+        adaIli9431->setCursor(0, y);
+        adaIli9431->print("Battery: ");
+        batteryLabel.setPosition(adaIli9431->getCursorX(), y, 3);
+        current.setPosition(outColumn * w, y, valueLength);
+        y += h;
+        adaIli9431->setCursor(0, y);
+        adaIli9431->print("               in      out");
+        for (uint8_t p = 0; p < kIbsPeriodCount; ++p) {
+                adaIli9431->setCursor(0, y + (1 + p) * h);
+                adaIli9431->print("Ah ");
+                adaIli9431->print(periodNames[p]);
+                chargeIn[p].setPosition(inColumn * w, y + (1 + p) * h, valueLength);
+                chargeOut[p].setPosition(outColumn * w, y + (1 + p) * h, valueLength);
+                adaIli9431->setCursor(0, y + (1 + kIbsPeriodCount + p) * h);
+                adaIli9431->print("Wh ");
+                adaIli9431->print(periodNames[p]);
+                energyIn[p].setPosition(inColumn * w, y + (1 + kIbsPeriodCount + p) * h, valueLength);
+                energyOut[p].setPosition(outColumn * w, y + (1 + kIbsPeriodCount + p) * h, valueLength);
+        }
+        y += (1 + 2 * kIbsPeriodCount) * h;
+        adaIli9431->setCursor(0, y);
+        adaIli9431->print("Reset trip: ");
+        resetTripLabel.setPosition(adaIli9431->getCursorX(), y, 3);
+
+        resetTrip = 0;
+        updateTotals();
+}
+
+void EnergyMenu::updateScreenImplementation(void) {
+        if (1000 <= millis() - lastUpdate) {
+                updateTotals();
+        }
+        updateBattery(menuEntered && selectionFocus.at(0), itemSelected);
+        updateResetTrip(menuEntered && selectionFocus.at(1), itemSelected);
+
+        widgets.render(adaIli9431);
+}
+
+void EnergyMenu::updateTotals(void) {
+        lastUpdate = millis();
+        bool all = ibsBank->getCount() == battery;
+        if (!all && !ibsBank->isEnabled(battery)) {
+                battery = 0;
+        }
+
+        bool available = all ? 0 < ibsBank->getAvailableCount() : ibsBank->getIbs(battery)->isAvailable();
+        if (available) {
+                float amps = all ? ibsBank->getBatteryCurrent() : ibsBank->getIbs(battery)->getBatteryCurrent();
+                snprintf(string, sizeof string, "%+7.2fA", amps);
+        } else {
+                snprintf(string, sizeof string, "n/a");
+        }
+        current.setText(string);
+
+        for (uint8_t p = 0; p < kIbsPeriodCount; ++p) {
+                const IbsEnergyTotals totals = all ? ibsBank->getTotals((IbsEnergyPeriod) p)
+                                               : ibsBank->getIbs(battery)->getEnergyCounter().getTotals((IbsEnergyPeriod) p);
+                chargeIn[p].setValue(totals.chargedCharge / CHARGE_PER_DECI_AH);
+                chargeOut[p].setValue(totals.dischargedCharge / CHARGE_PER_DECI_AH);
+                energyIn[p].setValue(totals.chargedEnergy / ENERGY_PER_WH);
+                energyOut[p].setValue(totals.dischargedEnergy / ENERGY_PER_WH);
+        }
+}
+
+static void getColors(boolean highlighted, boolean selected, uint16_t* fgColor, uint16_t* bgColor) {
+        *fgColor = Defaults.getFgColor();
+        *bgColor = Defaults.getBgColor();
+        if (highlighted) {
+                *fgColor = Defaults.getFgHighlightColor();
+                if (!selected) {
+                        *bgColor = Defaults.getBgHighlightColor();
+                } else {
+                        *bgColor = Defaults.getBgHlSelectedColor();
+                }
+        }
+}
+
+void EnergyMenu::updateBattery(boolean highlighted, boolean selected) {
+        uint16_t fgColor, bgColor;
+        getColors(highlighted, selected, &fgColor, &bgColor);
+        if (ibsBank->getCount() == battery) {
+                snprintf(string, sizeof string, "all");
+        } else {
+                snprintf(string, sizeof string, "%3u", battery + 1);
+        }
+        batteryLabel.setText(string);
+        batteryLabel.setColors(fgColor, bgColor);
+}
+
+void EnergyMenu::updateResetTrip(boolean highlighted, boolean selected) {
+        uint16_t fgColor, bgColor;
+        getColors(highlighted, selected, &fgColor, &bgColor);
+        resetTripLabel.setText(1 == resetTrip ? "yes" : "---");
+        resetTripLabel.setColors(fgColor, bgColor);
+}
+
+void EnergyMenu::onEnterButtonImplementation(void) {
+        selectionIndex = 0;
+        updateSelectionFocus();
+
+        itemSelected = false;
+        menuEntered = true;
+}
+
+void EnergyMenu::onLeaveButtonImplementation(void) {
+        menuEntered = false;
+        if (1 == resetTrip) {
+                if (ibsBank->getCount() == battery) {
+                        Serial.println("Resetting trip of all batteries.");
+                        ibsBank->resetTotals(kIbsPeriodTrip);
+                } else {
+                        Serial.printf("Resetting trip of battery %u.\r\n", battery + 1);
+                        ibsBank->getIbs(battery)->getEnergyCounter().reset(kIbsPeriodTrip);
+                }
+                resetTrip = 0;
+                updateTotals();
+        }
+}
+
+void EnergyMenu::inputLeft(void) {
+        if (itemSelected) {
+                if (0 == selectionIndex) { // Battery
+                        for (uint8_t i = battery; 0 < i; --i) {
+                                if (ibsBank->isEnabled(i - 1)) {
+                                        battery = i - 1;
+                                        break;
+                                }
+                        }
+                        updateTotals();
+                } else if (1 == selectionIndex) { // Reset trip
+                        resetTrip = 0; // ---
+                }
+        } else {
+                if (0 < selectionIndex) {
+                        --selectionIndex;
+                } else {
+                        selectionIndex = selectionFocus.size() - 1;
+                }
+        }
+        updateSelectionFocus();
+}
+
+void EnergyMenu::inputRight(void) {
+        if (itemSelected) {
+                if (0 == selectionIndex) { // Battery
+                        uint8_t i = battery + 1;
+                        while (i < ibsBank->getCount() && !ibsBank->isEnabled(i)) {
+                                ++i;
+                        }
+                        battery = min(i, ibsBank->getCount()); // All combined comes last.
+
+                        updateTotals();
+                } else if (1 == selectionIndex) { // Reset trip
+                        resetTrip = 1; // yes
+                }
+        } else {
+                if ((selectionFocus.size() - 1) > selectionIndex) {
+                        ++selectionIndex;
+                } else {
+                        selectionIndex = 0;
+                }
+        }
+        updateSelectionFocus();
+}
+
+void EnergyMenu::inputPush(void) {
+        itemSelected = !itemSelected;
+        updateSelectionFocus();
+}
+
+void EnergyMenu::updateSelectionFocus(void) {
+        // 1.: Battery, 2.: Reset trip
+        selectionFocus.clear();
+        selectionFocus.assign(2, false);
+        selectionFocus.at(selectionIndex) = true;
+}
@@ -20,23 +20,27 @@
 #include "GfxMenu.h"
 #include "MainMenu.h"
 #include "IbsMenu.h"
+#include "EnergyMenu.h"
 #include "TrumaCombiMenu.h"
 #include "SetupMenu.h"
 #include "HelpMenu.h"
+#include "DisplayStream.h"
 
 #include <Fonts/FreeMonoBold12pt7b.h>
 
 //######################################
-#include "HellaIbs.h"
-HellaIbs hellaIbs;
+#include "IbsBank.h"
+IbsBank ibsBank;
 
 //######################################
-#include "LinDriver.h"
+#include "LinBusArbiter.h"
 
 //######################################
 // Menu item pointers:
 MainMenu* mainMenu;
 IbsMenu* ibsMenu;
+IbsMenu* ibsMenu2;
+EnergyMenu* energyMenu;
 TrumaCombiMenu* combiMenu;
 SetupMenu* setupMenu;
 HelpMenu* helpMenu;
@@ -54,13 +58,13 @@ GfxMenu::~GfxMenu(void) {
         //delete adaIli9431;
 }
 
-void GfxMenu::setup(LinDriver* linDriver) {
+void GfxMenu::setup(LinBusArbiter* linArbiter) {
         lastMenuCountUpdate = 0;
         lastMenuItemCount = 0;
 
-        if (linDriver) {
-                linDriver->begin();
-                hellaIbs.setup(linDriver);
+        if (linArbiter) {
+                linArbiter->begin();
+                ibsBank.setup(linArbiter);
         }
 
         if (0 != pinPower) {
@@ -95,9 +99,11 @@ void GfxMenu::setup(LinDriver* linDriver) {
 
                 //######################################
                 // Initialize MenuItems:
-                ibsMenu = new IbsMenu(adaIli9431, "Battery", &hellaIbs);
+                ibsMenu = new IbsMenu(adaIli9431, "Battery", ibsBank.getIbs(0));
+                ibsMenu2 = new IbsMenu(adaIli9431, "Battery 2", ibsBank.getIbs(1));
+                energyMenu = new EnergyMenu(adaIli9431, "Energy", &ibsBank);
                 combiMenu = new TrumaCombiMenu(adaIli9431, "Truma Heating");
-                setupMenu = new SetupMenu(adaIli9431, "Setup");
+                setupMenu = new SetupMenu(adaIli9431, "Setup", &ibsBank);
                 helpMenu = new HelpMenu(adaIli9431, "Help");
                 mainMenu = new MainMenu(adaIli9431, "Main", ibsMenu);
 
@@ -107,8 +113,12 @@ void GfxMenu::setup(LinDriver* linDriver) {
                 mainMenu->setPrevMenuItem(0);
                 mainMenu->setNextMenuItem(ibsMenu);
                 ibsMenu->setPrevMenuItem(mainMenu);
-                ibsMenu->setNextMenuItem(combiMenu);
-                combiMenu->setPrevMenuItem(ibsMenu);
+                ibsMenu->setNextMenuItem(ibsMenu2);
+                ibsMenu2->setPrevMenuItem(ibsMenu);
+                ibsMenu2->setNextMenuItem(energyMenu);
+                energyMenu->setPrevMenuItem(ibsMenu2);
+                energyMenu->setNextMenuItem(combiMenu);
+                combiMenu->setPrevMenuItem(energyMenu);
                 combiMenu->setNextMenuItem(setupMenu);
                 setupMenu->setPrevMenuItem(combiMenu);
                 setupMenu->setNextMenuItem(helpMenu);
@@ -120,13 +130,17 @@ void GfxMenu::setup(LinDriver* linDriver) {
 }
 
 
+IbsBank& GfxMenu::getIbsBank(void) {
+        return ibsBank;
+}
+
 void GfxMenu::changeLoopState(GfxMenuLoopState newState) {
         loopState = newState;
         lastLoopStateChange = millis();
 }
 
 void GfxMenu::loop(void) {
-        hellaIbs.loop();
+        ibsBank.loop();
 
         uint32_t durationSinceLastStateChange =  millis() - lastLoopStateChange;
 
@@ -176,7 +190,7 @@ void GfxMenu::loop(void) {
 }
 
 void GfxMenu::printBootLogo(void) {
-        adaIli9431->fillScreen(Defaults.getBgColor());
+        DisplayStream::getInstance().fillRect(adaIli9431, 0, 0, DISPLAY_W, DISPLAY_H, Defaults.getBgColor());
         adaIli9431->setTextColor(Defaults.getFgColor(), Defaults.getBgColor());
         adaIli9431->setFont(&FreeMonoBold12pt7b);
 
@@ -16,39 +16,113 @@
  */
 
 #include "HellaIbs.h"
+#include "Persistence.h"
 
 
 //##############################################################################
 // LIN frames
-uint8_t linDiagRequestIbsGen1_123[] = {0x01, 0x06, 0xB2, 0x00, 0x36, 0x00, 0x0a, 0xf1};
-uint8_t linDiagRequestIbsGen2_12_[] = {0x01, 0x06, 0xB2, 0x00, 0x36, 0x00, 0x0a, 0xf6};
-uint8_t linDiagRequestIbsGen2___3[] = {0x01, 0x06, 0xB2, 0x00, 0x37, 0x00, 0x0a, 0xf6};
+// Read by identifier 0 (product identification) with the IBS's supplier ID and function ID, sent by the LIN transport layer.
+const uint8_t linDiagRequestIbsGen1_123[IBS_DIAG_REQUEST_LENGTH] = {0xB2, 0x00, 0x36, 0x00, 0x0a, 0xf1};
+const uint8_t linDiagRequestIbsGen2_12_[IBS_DIAG_REQUEST_LENGTH] = {0xB2, 0x00, 0x36, 0x00, 0x0a, 0xf6};
+const uint8_t linDiagRequestIbsGen2___3[IBS_DIAG_REQUEST_LENGTH] = {0xB2, 0x00, 0x37, 0x00, 0x0a, 0xf6};
+// Supplier ID 0x7FFF and function ID 0xFFFF are LIN wildcards: whatever IBS sits on the NAD answers with its own IDs.
+const uint8_t linDiagRequestIbsAny[IBS_DIAG_REQUEST_LENGTH] = {0xB2, 0x00, 0xFF, 0x7F, 0xFF, 0xFF};
 
 
-const uint8_t IBS_MAX_COUNT = 4;
-uint8_t ibsTypeIndex = 0;
+const uint8_t IBS_INSTANCE_NAD[IBS_INSTANCE_COUNT] = {0x01, 0x02};
+
 const IbsType ibs[IBS_MAX_COUNT] = {
-        {0x01, linDiagRequestIbsGen2___3, true, "Gen2 Var. 3      ", 0x22, 7, 0x25, 6, 0x26, 6},
-        {0x01, linDiagRequestIbsGen2_12_, true, "Gen2 Var. 1-2    ", 0x22, 7, 0x25, 6, 0x26, 6},
-        {0x02, linDiagRequestIbsGen1_123, false, "Gen2 Var. 1-3, S2", 0x28, 7, 0x2B, 6, 0x2C, 6},
-        {0x01, linDiagRequestIbsGen1_123, false, "Gen1 Var. 1-3, S1", 0x22, 7, 0x25, 6, 0x26, 6},
+        {0x01, linDiagRequestIbsGen2___3, true, "Gen2 Var. 3      ", kIbsSlotS1},
+        {0x01, linDiagRequestIbsGen2_12_, true, "Gen2 Var. 1-2    ", kIbsSlotS1},
+        {0x02, linDiagRequestIbsGen1_123, false, "Gen2 Var. 1-3, S2", kIbsSlotS2},
+        {0x01, linDiagRequestIbsGen1_123, false, "Gen1 Var. 1-3, S1", kIbsSlotS1},
 };
 
+// The RTC cache keeps the raw frames of either slot.
+static_assert(IbsS1Frame2::length == IbsS2Frame2::length && IbsS1Frame5::length == IbsS2Frame5::length && IbsS1Frame6::length == IbsS2Frame6::length, "S1 and S2 frames must share their layout.");
+
+
+// Hella IBS diagnostic configuration PDUs (SID and data), NAD and PCI are added by the LIN transport layer.
+const uint8_t linDiagIbsRetrieveNominalCapacity[] = {0xB2, 0x39};
+const uint8_t linDiagIbsRetrieveBatteryType[] = {0xB2, 0x3A, 0xFF, 0x7F, 0xFF, 0xFF};
+const uint8_t linDiagIbsRetrieveBattTableState[] = {0x30};
+const uint8_t IBS_SID_WRITE = 0xB5;
+const uint8_t IBS_ID_NOMINAL_CAPACITY = 0x39;
+const uint8_t IBS_ID_BATTERY_TYPE = 0x3A;
+// Bits of configPending.
+const uint8_t IBS_CONFIG_NOMINAL_CAPACITY = 0x01;
+const uint8_t IBS_CONFIG_BATTERY_TYPE = 0x02;
+
+// Kept in RTC slow memory, so it survives deep sleep (but not a power cycle). Persistence holds all but the readings.
+const uint32_t IBS_CACHE_MAGIC = 0x49425331; // "IBS1"
+typedef struct IbsCache {
+        uint32_t magic;
+        uint8_t ibsIndex;
+        uint8_t variant;
+        uint8_t batteryType;
+        uint8_t frameValid; // Bit 0: frame2, bit 1: frame5, bit 2: frame6.
+        uint8_t frame2[IbsS1Frame2::length];
+        uint8_t frame5[IbsS1Frame5::length];
+        uint8_t frame6[IbsS1Frame6::length];
+} IbsCache;
+RTC_DATA_ATTR static IbsCache ibsCache[IBS_INSTANCE_COUNT];
+RTC_DATA_ATTR static IbsEnergyStore energyStore[IBS_INSTANCE_COUNT];
+const PersistenceSlot IBS_SLOT[IBS_INSTANCE_COUNT] = {kPSlotIbs, kPSlotIbs2};
+const PersistenceSlot IBS_ENERGY_SLOT[IBS_INSTANCE_COUNT] = {kPSlotIbsEnergy, kPSlotIbsEnergy2};
 
-// Hella IBS diagnostic configuration frames
-uint8_t linDiagIbsRetrieveNominalCapacity[] = {0x01 /* change NAD according to IBS type */, 0x02, 0xB2, 0x39, 0xFF, 0xFF, 0xFF, 0xFF};
-uint8_t linDiagIbsWriteNominalCapacity[] = {0x01 /* change NAD according to IBS type */, 0x03, 0xB5, 0x39, 0x00 /* set before sending! */, 0xFF, 0xFF, 0xFF};
+const uint8_t MESSAGE_DELAY = 60; // msec
+const uint16_t IBS_PROBE_TIMEOUT = 100; // msec, an IBS answers its identification at the first response header.
+const uint16_t IBS_DETECT_DELAY = 1000; // msec before a detection attempt, doubled after each one that found nothing...
+const uint16_t IBS_DETECT_DELAY_MAX = 32000; // ...up to this.
+// Default poll periods in msec. Current and voltage change fast, SOC, SOH, Ri and capacities take minutes.
+const uint16_t POLL_PERIOD[kIbsFrameCount] = {1000, 10000, 10000};
+const uint16_t POLL_PERIOD_HIGH_SPEED[kIbsFrameCount] = {100, 2000, 2000};
+
+
+template<typename T>
+static inline void updateField(T& field, T value, uint16_t bit, uint16_t& changes) {
+        if (field != value) {
+                field = value;
+                changes |= bit;
+        }
+}
 
-uint8_t linDiagIbsRetrieveBatteryType[] = {0x01 /* change NAD according to IBS type */, 0x06, 0xB2, 0x3A, 0xFF, 0x7F, 0xFF, 0xFF};
-uint8_t linDiagIbsWriteBatteryType[] = {0x01 /* change NAD according to IBS type */, 0x03, 0xB5, 0x3A, 0x00 /* set before sending! */, 0xFF, 0xFF, 0xFF};
+static inline void updateFlag(uint8_t& flags, uint8_t flag, bool value, uint16_t bit, uint16_t& changes) {
+        updateField(flags, uint8_t(value ? flags | flag : flags & ~flag), bit, changes);
+}
 
-uint8_t linDiagIbsRetrieveBattTableState[] = {0x01 /* change NAD according to IBS type */, 0x01, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 
-const uint8_t MESSAGE_DELAY = 60; // msec
+HellaIbs::HellaIbs() {
+        linArbiter = 0;
+        transport = 0;
+        instance = 0;
+        nad = IBS_INSTANCE_NAD[0];
+        cache = &ibsCache[0];
+        connectedIbsIndex = 0xff;
+        probeAny = true;
+        wildcardUnsupported = false;
+        verifyFailed = false;
+        detectDelay = IBS_DETECT_DELAY;
+        startConfigure = false;
+        configStatus = kIbsConfigIdle;
+        statsScheduleChanged = false;
+        memset(&measurement, 0, sizeof measurement);
+        memset(subscribers, 0, sizeof subscribers);
+        pendingChanges = 0;
+        memcpy(pollPeriod, POLL_PERIOD, sizeof pollPeriod);
+        memcpy(pollPeriodHighSpeed, POLL_PERIOD_HIGH_SPEED, sizeof pollPeriodHighSpeed);
+        changeLoopState(kHilsNoIbsConnected);
+}
 
 
-void HellaIbs::setup(LinDriver* linDriver) {
-        this->linDriver = linDriver;
+void HellaIbs::setup(LinBusArbiter* linArbiter, LinTransport* transport, uint8_t instance) {
+        this->linArbiter = linArbiter;
+        this->transport = transport;
+        this->instance = min(instance, (uint8_t) (IBS_INSTANCE_COUNT - 1));
+        nad = IBS_INSTANCE_NAD[this->instance];
+        cache = &ibsCache[this->instance];
+        energyCounter.setup(&energyStore[this->instance], IBS_ENERGY_SLOT[this->instance]);
+        restoreCache();
 }
 
 void HellaIbs::changeLoopState(HellaIbsLoopState newState) {
@@ -59,69 +133,99 @@ void HellaIbs::changeLoopState(HellaIbsLoopState newState) {
 void HellaIbs::loop(void) {
         uint16_t durationSinceLastStateChange =  millis() - lastLoopStateChange;
 
+        energyCounter.loop();
+
         switch (loopState) {
 
         //######################################
         case kHilsNoIbsConnected:
-                ibsTypeIndex = 0;
+                probeIndex = 0;
+                probeAny = !wildcardUnsupported;
                 connectedIbsIndex = 0xff;
-                available = false;
+                setAvailable(false);
+                energyCounter.breakSeries();
+                runtimeEstimator.breakSeries();
+
+                if (detectDelay < durationSinceLastStateChange && linArbiter) {
+                        if (!verifyFailed && IBS_CACHE_MAGIC == cache->magic && IBS_MAX_COUNT > cache->ibsIndex && nad == ibs[cache->ibsIndex].nad) {
+                                // The IBS seen last is most likely still there, a single frame read confirms it.
+                                connectedIbsIndex = cache->ibsIndex;
+                                changeLoopState(kHilsVerifyCachedIbs);
+                        } else {
+                                // Checking for IBS, testing its initial NAD, supplier ID and function ID
+                                changeLoopState(kHilsRequestIbs);
+                        }
+                }
+                break;
 
-                if (1000 < durationSinceLastStateChange) {
-                        // Checking for IBS, testing its initial NAD, supplier ID and function ID
-                        if (linDriver) {
+        case kHilsVerifyCachedIbs:
+                if (kIbsSlotS2 == ibs[connectedIbsIndex].slot ? recvFrame(s2Frames.frame2) : recvFrame(s1Frames.frame2)) {
+                        if (0xff == result) {
+                                setAvailable(true);
+                                detectDelay = IBS_DETECT_DELAY;
+                                decodeStatsFrame(resultAddr, result);
+                                changeLoopState(kHilsPrepareReadStats);
+                                Serial.printf("IBS %u restored: %s\r\n", instance + 1, getName().c_str());
+                        } else {
+                                // Gone or replaced, identify whatever is on the NAD now.
+                                verifyFailed = true;
+                                connectedIbsIndex = 0xff;
                                 changeLoopState(kHilsRequestIbs);
                         }
                 }
                 break;
 
         case kHilsRequestIbs:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
+                // Without wildcard support only the variants answering on this instance's NAD are probed one by one.
+                while (!probeAny && IBS_MAX_COUNT > probeIndex && nad != ibs[probeIndex].nad) {
+                        ++probeIndex;
+                }
+                if (IBS_MAX_COUNT <= probeIndex) {
+                        detectionFailed();
+                } else if (MESSAGE_DELAY < durationSinceLastStateChange) {
                         // Checking for IBS, testing its supplier ID, function ID and variant
-                        ibs[ibsTypeIndex].diagRequestFrame[0] = ibs[ibsTypeIndex].nad; // Set correct NAD.
-                        linDriver->send(0x3C, ibs[ibsTypeIndex].diagRequestFrame, 8);
+                        probeFound = false;
+                        transport->request(nad, probeAny ? linDiagRequestIbsAny : ibs[probeIndex].diagRequestPdu, IBS_DIAG_REQUEST_LENGTH, onProbeResponse, this,
+                                           true, IBS_PROBE_TIMEOUT);
                         changeLoopState(kHilsResponseIbs);
                 }
                 break;
 
         case kHilsResponseIbs:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        clearLinInfoFrame();
-                        result = linDriver->recv(0x3D, linInfoFrame, 8);
-                        if (0 == result) { // No answer?
-                                ++ibsTypeIndex;
-                                if (ibsTypeIndex >= IBS_MAX_COUNT) {
-                                        changeLoopState(kHilsNoIbsConnected);
-                                } else {
-                                        changeLoopState(kHilsRequestIbs);
-                                }
-                        } else {
-                                connectedIbsIndex = ibsTypeIndex;
-                                available = true;
-                                variant = linInfoFrame[7];
+                if (!transport->isPending(this)) {
+                        if (probeFound) {
+                                wildcardUnsupported = !probeAny;
+                                verifyFailed = false;
+                                detectDelay = IBS_DETECT_DELAY;
+                                setAvailable(true);
                                 changeLoopState(kHilsRequestBatteryType);
-                                Serial.printf("IBS found: %s\r\n", getName().c_str());
+                                Serial.printf("IBS %u found: %s\r\n", instance + 1, getName().c_str());
+                        } else if (probeAny) { // Rejected, or silently ignored by an IBS without wildcard support: walk the table.
+                                probeAny = false;
+                                probeIndex = 0;
+                                changeLoopState(kHilsRequestIbs);
+                        } else { // No answer?
+                                ++probeIndex;
+                                changeLoopState(kHilsRequestIbs);
                         }
                 }
                 break;
 
         case kHilsRequestBatteryType:
                 if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        linDiagIbsRetrieveBatteryType[0] = ibs[ibsTypeIndex].nad; // Set correct NAD.
-                        linDriver->send(0x3C, linDiagIbsRetrieveBatteryType, sizeof linDiagIbsRetrieveBatteryType);
+                        batteryTypeRead = false;
+                        transport->request(nad, linDiagIbsRetrieveBatteryType, sizeof linDiagIbsRetrieveBatteryType, onBatteryTypeResponse, this);
                         changeLoopState(kHilsResponseBatteryType);
                 }
                 break;
 
         case kHilsResponseBatteryType:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        clearLinInfoFrame();
-                        result = linDriver->recv(0x3D, linInfoFrame, 8);
-                        if (0 == result) { // No answer?
-                                changeLoopState(kHilsNoIbsConnected);
-                        } else {
-                                batteryType = (IbsBatteryType) linInfoFrame[3];
+                if (!transport->isPending(this)) {
+                        if (batteryTypeRead) {
+                                updateCache();
                                 changeLoopState(kHilsPrepareReadStats);
+                        } else {
+                                changeLoopState(kHilsNoIbsConnected);
                         }
                 }
                 break;
@@ -129,132 +233,421 @@ void HellaIbs::loop(void) {
 
         //######################################
         case kHilsPrepareReadStats:
-                changeLoopState(kHilsReadFrame2);
+                setupStatsSchedule();
+                changeLoopState(kHilsReadStats);
                 break;
 
-        case kHilsReadFrame2:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        clearLinInfoFrame();
-                        result = linDriver->recv(ibs[connectedIbsIndex].frm2, linInfoFrame, ibs[connectedIbsIndex].frm2length);
-                        if (0 == result) { // No answer?
-                                changeLoopState(kHilsNoIbsConnected);
-                        } else {
-                                batteryVoltage = (float((linInfoFrame[4] << 8) + linInfoFrame[3])) / 1000; // V
-                                batteryCurrent = (float((int32_t(linInfoFrame[2]) << 16) + (int32_t(linInfoFrame[1]) << 8) + int32_t(linInfoFrame[0]) - int32_t(2000000L))) / 1000.0; // A
-                                temperature = long(linInfoFrame[5]) / 2 - 40;
-                                ibsError = bitRead(linInfoFrame[6], 7);
-                                changeLoopState(kHilsReadFrame5);
-                        }
+        case kHilsReadStats:
+                // Frames are decoded by onStatsFrame(), a lost IBS is handled there as well.
+                if (startConfigure) {
+                        linArbiter->setSchedule(this, 0, 0, 0);
+                        changeLoopState(kHilsPrepareConfig);
+                } else if (highSpeedCommunication != statsScheduleHighSpeed || statsScheduleChanged) {
+                        setupStatsSchedule();
                 }
                 break;
 
-        case kHilsReadFrame5:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        clearLinInfoFrame();
-                        result = linDriver->recv(ibs[connectedIbsIndex].frm5, linInfoFrame, ibs[connectedIbsIndex].frm5length);
-                        if (0 == result) { // No answer?
-                                changeLoopState(kHilsNoIbsConnected);
-                        } else {
-                                soc = int(linInfoFrame[0]) / 2; // %
-                                soh = int(linInfoFrame[1]) / 2; // %
-                                optChargeVoltage = 13.0 + 0.05 * (linInfoFrame[3] - 160); // V
-                                avgRi = (float) (linInfoFrame[4] | linInfoFrame[5] << 8) / 100; // mOhm
-                                changeLoopState(kHilsReadFrame6);
-                        }
-                }
+
+        //######################################
+        case kHilsPrepareConfig:
+                startConfigure = false;
+                configPending = IBS_CONFIG_NOMINAL_CAPACITY | IBS_CONFIG_BATTERY_TYPE;
+                configAttempt = 0;
+                changeLoopState(startConfigExchange() ? kHilsWriteConfig : kHilsRetryConfig);
                 break;
 
-        case kHilsReadFrame6:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        clearLinInfoFrame();
-                        result = linDriver->recv(ibs[connectedIbsIndex].frm6, linInfoFrame, ibs[connectedIbsIndex].frm6length);
-                        if (0 == result) { // No answer?
-                                changeLoopState(kHilsNoIbsConnected);
+        case kHilsWriteConfig:
+                if (!transport->isPending(this)) {
+                        ++configAttempt;
+                        if (0 == configPending) {
+                                setConfigStatus(kIbsConfigOk);
+                                updateCache();
+                                changeLoopState(kHilsPrepareReadStats);
+                        } else if (IBS_CONFIG_ATTEMPTS > configAttempt) {
+                                Serial.printf("IBS %u configuration not verified, retrying.\r\n", instance + 1);
+                                changeLoopState(kHilsRetryConfig);
                         } else {
-                                availableCapacity = (float) ((linInfoFrame[1] << 8) + linInfoFrame[0]) / 10; // Ah
-                                dischargeableCapacity = (float) ((linInfoFrame[3] << 8) + linInfoFrame[2]) / 10; // Ah
-                                nominalCapacity = linInfoFrame[4]; // Ah; TODO: *2 in case of newer IBS version...
-                                calibrated = bitRead(linInfoFrame[5], 0);
-                                changeLoopState(kHilsPauseAfterRead);
+                                Serial.printf("IBS %u configuration failed.\r\n", instance + 1);
+                                setConfigStatus(kIbsConfigFailed);
+                                changeLoopState(kHilsRequestBatteryType);
                         }
                 }
                 break;
 
-        case kHilsPauseAfterRead:
-                if (startConfigure) {
-                        changeLoopState(kHilsPrepareConfig);
-                } else if (2000 < durationSinceLastStateChange || (highSpeedCommunication && 200 < durationSinceLastStateChange)) { // Read battery stats once in two seconds.
-                        changeLoopState(kHilsPrepareReadStats);
+        case kHilsRetryConfig:
+                if (IBS_CONFIG_RETRY_DELAY < durationSinceLastStateChange) {
+                        changeLoopState(startConfigExchange() ? kHilsWriteConfig : kHilsRetryConfig);
                 }
                 break;
 
 
         //######################################
-        case kHilsPrepareConfig:
-                startConfigure = false;
-                changeLoopState(kHilsWriteConfigCapacityStep1);
+        default:
+                if (linArbiter) {
+                        linArbiter->setSchedule(this, 0, 0, 0);
+                        linArbiter->cancel(this);
+                }
+                if (transport) {
+                        transport->cancel(this);
+                }
+                recvPending = false;
+                changeLoopState(kHilsNoIbsConnected); // An unknown/unexpected error occurred, start over with IBS detection again.
                 break;
+        }
 
-        case kHilsWriteConfigCapacityStep1:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        // Please note: Sequence and minimum wait time between writes are very important.
-                        // Start write capacity sequence:
-                        linDiagIbsRetrieveNominalCapacity[0] = ibs[connectedIbsIndex].nad; // Set correct NAD.
-                        linDriver->send(0x3C, linDiagIbsRetrieveNominalCapacity, 8);
-                        changeLoopState(kHilsWriteConfigCapacityStep2);
+        publish();
+}
+
+void HellaIbs::detectionFailed(void) {
+        detectDelay = min(2 * detectDelay, (int) IBS_DETECT_DELAY_MAX);
+        changeLoopState(kHilsNoIbsConnected);
+}
+
+void HellaIbs::stop(void) {
+        if (linArbiter) {
+                linArbiter->setSchedule(this, 0, 0, 0);
+                linArbiter->cancel(this);
+        }
+        if (transport) {
+                transport->cancel(this);
+        }
+        recvPending = false;
+        detectDelay = IBS_DETECT_DELAY;
+        changeLoopState(kHilsNoIbsConnected);
+        setAvailable(false);
+        publish();
+}
+
+void HellaIbs::restoreCache(void) {
+        const PersistenceSlot slotId = IBS_SLOT[instance];
+        if (IBS_CACHE_MAGIC == cache->magic && IBS_MAX_COUNT > cache->ibsIndex && nad == ibs[cache->ibsIndex].nad) {
+                // Woken up from deep sleep: show the last readings right away.
+                connectedIbsIndex = cache->ibsIndex;
+                variant = cache->variant;
+                setBatteryType((IbsBatteryType) cache->batteryType);
+                if (kIbsSlotS2 == ibs[connectedIbsIndex].slot) {
+                        restoreFrames(s2Frames);
+                } else {
+                        restoreFrames(s1Frames);
                 }
-                break;
+        } else if (Persistence::getInstance().isSlotValid(slotId)) {
+                char slot[3];
+                Persistence::getInstance().readSlot(slotId, slot, sizeof slot);
+                if (IBS_MAX_COUNT <= (uint8_t) slot[0] || nad != ibs[(uint8_t) slot[0]].nad) {
+                        return;
+                }
+                connectedIbsIndex = slot[0];
+                variant = slot[1];
+                setBatteryType((IbsBatteryType) slot[2]);
+                cache->magic = IBS_CACHE_MAGIC;
+                cache->ibsIndex = connectedIbsIndex;
+                cache->variant = variant;
+                cache->batteryType = measurement.sample.batteryType;
+                cache->frameValid = 0;
+        } else {
+                return;
+        }
+        changeLoopState(kHilsVerifyCachedIbs);
+}
 
-        case kHilsWriteConfigCapacityStep2:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        linDiagIbsWriteNominalCapacity[4] = configNominalCapacity;
-                        linDiagIbsWriteNominalCapacity[0] = ibs[connectedIbsIndex].nad; // Set correct NAD.
-                        linDriver->send(0x3C, linDiagIbsWriteNominalCapacity, 8);
-                        changeLoopState(kHilsWriteConfigBattTypeStep1);
+void HellaIbs::updateCache(void) {
+        if (IBS_CACHE_MAGIC != cache->magic || connectedIbsIndex != cache->ibsIndex) {
+                cache->frameValid = 0;
+        }
+        cache->magic = IBS_CACHE_MAGIC;
+        cache->ibsIndex = connectedIbsIndex;
+        cache->variant = variant;
+        cache->batteryType = measurement.sample.batteryType;
+
+        // Only write the EEPROM if something changed.
+        char slot[3] = {(char) connectedIbsIndex, (char) variant, (char) measurement.sample.batteryType};
+        char stored[sizeof slot];
+        Persistence::getInstance().readSlot(IBS_SLOT[instance], stored, sizeof stored);
+        if (!Persistence::getInstance().isSlotValid(IBS_SLOT[instance]) || 0 != memcmp(slot, stored, sizeof slot)) {
+                Persistence::getInstance().writeSlot(IBS_SLOT[instance], slot, sizeof slot);
+        }
+}
+
+void HellaIbs::setConfigStatus(IbsConfigStatus status) {
+        if (configStatus != status) {
+                configStatus = status;
+                pendingChanges |= kIbsFieldConfig;
+        }
+}
+
+bool HellaIbs::startConfigExchange(void) {
+        // Please note: Sequence is very important, the IBS only takes a value right after it has been retrieved.
+        // One transaction: every request waits for the IBS's response instead of a fixed delay, the values not verified
+        // yet are written and then read back. Only the read-back decides about success.
+        const uint8_t writeNominalCapacity[] = {IBS_SID_WRITE, IBS_ID_NOMINAL_CAPACITY, (uint8_t) configNominalCapacity};
+        const uint8_t writeBatteryType[] = {IBS_SID_WRITE, IBS_ID_BATTERY_TYPE, (uint8_t) configBattType};
+        bool queued = true;
+
+        if (configPending & IBS_CONFIG_NOMINAL_CAPACITY) {
+                queued = queued && transport->request(nad, linDiagIbsRetrieveNominalCapacity, sizeof linDiagIbsRetrieveNominalCapacity, onConfigStep, this);
+                queued = queued && transport->request(nad, writeNominalCapacity, sizeof writeNominalCapacity, onConfigStep, this);
+        }
+        if (configPending & IBS_CONFIG_BATTERY_TYPE) {
+                queued = queued && transport->request(nad, linDiagIbsRetrieveBatteryType, sizeof linDiagIbsRetrieveBatteryType, onConfigStep, this);
+                queued = queued && transport->request(nad, writeBatteryType, sizeof writeBatteryType, onConfigStep, this);
+        }
+        if (configPending & IBS_CONFIG_NOMINAL_CAPACITY) {
+                queued = queued && transport->request(nad, linDiagIbsRetrieveNominalCapacity, sizeof linDiagIbsRetrieveNominalCapacity, onNominalCapacityReadBack, this);
+        }
+        if (configPending & IBS_CONFIG_BATTERY_TYPE) {
+                queued = queued && transport->request(nad, linDiagIbsRetrieveBatteryType, sizeof linDiagIbsRetrieveBatteryType, onBatteryTypeReadBack, this);
+        }
+        if (!queued) {
+                transport->cancel(this); // The transport is busy with another IBS, try again without counting an attempt.
+        }
+        return queued;
+}
+
+void HellaIbs::onProbeResponse(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result) {
+        HellaIbs* hellaIbs = static_cast<HellaIbs*>(context);
+        if (kLtrOk != result || 6 > length) { // RSID, supplier ID, function ID and variant.
+                return;
+        }
+        for (uint8_t i = 0; i < IBS_MAX_COUNT; ++i) {
+                if (nad == ibs[i].nad && 0 == memcmp(&response[1], &ibs[i].diagRequestPdu[2], 4)) {
+                        hellaIbs->connectedIbsIndex = i;
+                        hellaIbs->variant = response[5];
+                        hellaIbs->probeFound = true;
+                        return;
                 }
-                break;
+        }
+        Serial.printf("IBS %u unknown: supplier 0x%02x%02x, function 0x%02x%02x\r\n", hellaIbs->instance + 1, response[2], response[1], response[4], response[3]);
+}
 
-        case kHilsWriteConfigBattTypeStep1:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        // Start write battery type sequence:
-                        linDiagIbsRetrieveBatteryType[0] = ibs[connectedIbsIndex].nad; // Set correct NAD.
-                        linDriver->send(0x3C, linDiagIbsRetrieveBatteryType, 8);
-                        changeLoopState(kHilsWriteConfigBattTypeStep2);
+void HellaIbs::onConfigStep(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result) {
+        HellaIbs* hellaIbs = static_cast<HellaIbs*>(context);
+        if (kLtrNoResponse == result) {
+                hellaIbs->transport->cancel(hellaIbs); // No use in waiting for the rest, the attempt is over.
+        }
+}
+
+void HellaIbs::onNominalCapacityReadBack(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result) {
+        HellaIbs* hellaIbs = static_cast<HellaIbs*>(context);
+        if (kLtrOk == result && 2 <= length && (uint8_t) hellaIbs->configNominalCapacity == response[1]) {
+                hellaIbs->configPending &= ~IBS_CONFIG_NOMINAL_CAPACITY;
+        }
+}
+
+void HellaIbs::onBatteryTypeReadBack(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result) {
+        HellaIbs* hellaIbs = static_cast<HellaIbs*>(context);
+        if (kLtrOk == result && 2 <= length) {
+                hellaIbs->setBatteryType((IbsBatteryType) response[1]);
+                if (hellaIbs->configBattType == response[1]) {
+                        hellaIbs->configPending &= ~IBS_CONFIG_BATTERY_TYPE;
                 }
-                break;
+        }
+}
 
-        case kHilsWriteConfigBattTypeStep2:
-                if (MESSAGE_DELAY < durationSinceLastStateChange) {
-                        // Start write battery type sequence:
-                        linDiagIbsWriteBatteryType[4] = configBattType;
-                        linDiagIbsWriteBatteryType[0] = ibs[connectedIbsIndex].nad; // Set correct NAD.
-                        linDriver->send(0x3C, linDiagIbsWriteBatteryType, 8);
-                        changeLoopState(kHilsRequestBatteryType);
+void HellaIbs::onBatteryTypeResponse(void* context, uint8_t nad, const uint8_t* response, uint16_t length, LinTransportResult result) {
+        HellaIbs* hellaIbs = static_cast<HellaIbs*>(context);
+        if (kLtrOk == result && 2 <= length) {
+                hellaIbs->setBatteryType((IbsBatteryType) response[1]);
+                hellaIbs->batteryTypeRead = true;
+        }
+}
+
+void HellaIbs::setupStatsSchedule(void) {
+        statsScheduleHighSpeed = highSpeedCommunication;
+        statsScheduleChanged = false;
+        const uint16_t* period = statsScheduleHighSpeed ? pollPeriodHighSpeed : pollPeriod;
+        if (kIbsSlotS2 == ibs[connectedIbsIndex].slot) {
+                setupStatsSchedule(s2Frames, period);
+        } else {
+                setupStatsSchedule(s1Frames, period);
+        }
+}
+
+template<class Frames>
+void HellaIbs::setupStatsSchedule(Frames& frames, const uint16_t* period) {
+        // One pass of the table polls frame 2, frames 5 and 6 are sub-rated and spread over different passes.
+        // The arbiter adds the pause and interleaves the tables of all IBS sharing the bus.
+        uint8_t divider[kIbsFrameCount];
+        for (uint8_t i = 0; i < kIbsFrameCount; ++i) {
+                divider[i] = constrain((period[i] + period[kIbsFrame2] / 2) / period[kIbsFrame2], 1, 255);
+        }
+        statsSchedule[kIbsFrame2] = linReadSlot(frames.frame2, onStatsFrame, this, divider[kIbsFrame2], 0);
+        statsSchedule[kIbsFrame5] = linReadSlot(frames.frame5, onStatsFrame, this, divider[kIbsFrame5], divider[kIbsFrame5] / kIbsFrameCount);
+        statsSchedule[kIbsFrame6] = linReadSlot(frames.frame6, onStatsFrame, this, divider[kIbsFrame6], 2 * divider[kIbsFrame6] / kIbsFrameCount);
+        linArbiter->setSchedule(this, statsSchedule, kIbsFrameCount, period[kIbsFrame2]);
+}
+
+void HellaIbs::setPollPeriod(IbsFrameIndex frame, uint16_t period, uint16_t periodHighSpeed) {
+        if (kIbsFrameCount <= frame) {
+                return;
+        }
+        pollPeriod[frame] = max(period, (uint16_t) LIN_SCHEDULE_TIME_BASE);
+        pollPeriodHighSpeed[frame] = max(periodHighSpeed, (uint16_t) LIN_SCHEDULE_TIME_BASE);
+        statsScheduleChanged = true;
+}
+
+void HellaIbs::onStatsFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result) {
+        HellaIbs* hellaIbs = static_cast<HellaIbs*>(context);
+        if (kIbsFrame2 == hellaIbs->decodeStatsFrame(addr, result)) {
+                const IbsSample& sample = hellaIbs->measurement.sample;
+                hellaIbs->energyCounter.addSample(sample.current, sample.voltage, millis());
+                if (hellaIbs->runtimeEstimator.addSample(sample.current, sample.dischargeableCapacity, sample.availableCapacity, sample.nominalCapacity, millis())) {
+                        hellaIbs->pendingChanges |= kIbsFieldRuntime;
                 }
-                break;
+        }
+}
+
+uint8_t HellaIbs::decodeStatsFrame(uint8_t addr, uint8_t result) {
+        if (0 == result) { // No answer?
+                linArbiter->setSchedule(this, 0, 0, 0);
+                changeLoopState(kHilsNoIbsConnected);
+                return kIbsFrameCount;
+        }
+        if (0xff != result) { // Bad checksum, wait for the next pass.
+                return kIbsFrameCount;
+        }
+        return kIbsSlotS2 == ibs[connectedIbsIndex].slot ? decodeFrames(s2Frames, addr) : decodeFrames(s1Frames, addr);
+}
 
+template<class Frames>
+uint8_t HellaIbs::decodeFrames(const Frames& frames, uint8_t addr) {
+        if (frames.frame2.id == addr) {
+                decodeFrame(frames.frame2);
+                return kIbsFrame2;
+        } else if (frames.frame5.id == addr) {
+                decodeFrame(frames.frame5);
+                return kIbsFrame5;
+        } else if (frames.frame6.id == addr) {
+                decodeFrame(frames.frame6);
+                return kIbsFrame6;
+        }
+        return kIbsFrameCount;
+}
 
-        //######################################
-        default:
-                changeLoopState(kHilsNoIbsConnected); // An unknown/unexpected error occurred, start over with IBS detection again.
-                break;
+template<class Frames>
+void HellaIbs::restoreFrames(Frames& frames) {
+        if (bitRead(cache->frameValid, 0)) {
+                memcpy(frames.frame2.data, cache->frame2, sizeof cache->frame2);
+                decodeFrame(frames.frame2);
+        }
+        if (bitRead(cache->frameValid, 1)) {
+                memcpy(frames.frame5.data, cache->frame5, sizeof cache->frame5);
+                decodeFrame(frames.frame5);
+        }
+        if (bitRead(cache->frameValid, 2)) {
+                memcpy(frames.frame6.data, cache->frame6, sizeof cache->frame6);
+                decodeFrame(frames.frame6);
+        }
+}
+
+template<uint8_t ID>
+void HellaIbs::decodeFrame(const IbsFrame2<ID>& frame) {
+        IbsSample& sample = measurement.sample;
+        updateField(sample.voltage, frame.getVoltage(), kIbsFieldVoltage, pendingChanges);
+        updateField(sample.current, frame.getCurrent(), kIbsFieldCurrent, pendingChanges);
+        updateField(sample.temperature, int16_t(frame.getTemperature() - 80), kIbsFieldTemperature, pendingChanges); // 0 = -40 °C
+        updateFlag(sample.flags, kIbsSampleError, frame.isError(), kIbsFieldError, pendingChanges);
+        memcpy(cache->frame2, frame.data, sizeof cache->frame2);
+        bitSet(cache->frameValid, 0);
+}
+
+template<uint8_t ID>
+void HellaIbs::decodeFrame(const IbsFrame5<ID>& frame) {
+        IbsSample& sample = measurement.sample;
+        updateField(sample.soc, uint8_t(frame.getSoc() / 2), kIbsFieldSoc, pendingChanges); // %
+        updateField(sample.soh, uint8_t(frame.getSoh() / 2), kIbsFieldSoh, pendingChanges); // %
+        updateField(sample.optChargeVoltage, uint16_t(5000 + 50 * frame.getOptChargeVoltage()), kIbsFieldOptChargeVoltage, pendingChanges); // 160 = 13.0 V
+        updateField(sample.avgRi, frame.getAvgRi(), kIbsFieldAvgRi, pendingChanges);
+        memcpy(cache->frame5, frame.data, sizeof cache->frame5);
+        bitSet(cache->frameValid, 1);
+}
+
+template<uint8_t ID>
+void HellaIbs::decodeFrame(const IbsFrame6<ID>& frame) {
+        IbsSample& sample = measurement.sample;
+        updateField(sample.availableCapacity, frame.getAvailableCapacity(), kIbsFieldAvailableCapacity, pendingChanges);
+        updateField(sample.dischargeableCapacity, frame.getDischargeableCapacity(), kIbsFieldDischargeableCapacity, pendingChanges);
+        updateField(sample.nominalCapacity, int16_t(frame.getNominalCapacity()), kIbsFieldNominalCapacity, pendingChanges); // TODO: *2 in case of newer IBS version...
+        updateFlag(sample.flags, kIbsSampleCalibrated, frame.isCalibrated(), kIbsFieldCalibrated, pendingChanges);
+        memcpy(cache->frame6, frame.data, sizeof cache->frame6);
+        bitSet(cache->frameValid, 2);
+}
+
+void HellaIbs::setAvailable(bool available) {
+        updateFlag(measurement.sample.flags, kIbsSampleAvailable, available, kIbsFieldAvailable, pendingChanges);
+}
+
+void HellaIbs::setBatteryType(IbsBatteryType batteryType) {
+        updateField(measurement.sample.batteryType, uint8_t(batteryType), kIbsFieldBatteryType, pendingChanges);
+}
+
+void HellaIbs::publish(void) {
+        if (0 == pendingChanges) {
+                return;
+        }
+        ++measurement.version;
+        measurement.changed = pendingChanges;
+        pendingChanges = 0;
+        for (uint8_t i = 0; i < IBS_MAX_SUBSCRIBERS; ++i) {
+                uint16_t changed = measurement.changed & subscribers[i].mask;
+                if (subscribers[i].callback && changed) {
+                        subscribers[i].callback(subscribers[i].context, this, changed);
+                }
+        }
+}
+
+bool HellaIbs::subscribe(IbsUpdateCallback callback, void* context, uint16_t mask) {
+        for (uint8_t i = 0; i < IBS_MAX_SUBSCRIBERS; ++i) {
+                if (!subscribers[i].callback) {
+                        subscribers[i].callback = callback;
+                        subscribers[i].context = context;
+                        subscribers[i].mask = mask;
+                        return true;
+                }
+        }
+        return false;
+}
+
+void HellaIbs::unsubscribe(IbsUpdateCallback callback, void* context) {
+        for (uint8_t i = 0; i < IBS_MAX_SUBSCRIBERS; ++i) {
+                if (callback == subscribers[i].callback && context == subscribers[i].context) {
+                        subscribers[i].callback = 0;
+                }
+        }
+}
+
+template<class Frame>
+bool HellaIbs::recvFrame(Frame& frame) {
+        if (!recvPending) {
+                memset(frame.data, 0x00, sizeof frame.data);
+                recvDone = false;
+                recvPending = linArbiter->read(frame, kLinPriorityPoll, onRecvFrame, this);
+                return false;
+        }
+        if (!recvDone) {
+                return false;
         }
+        recvPending = false;
+        return true;
 }
 
-void HellaIbs::clearLinInfoFrame(void) {
-        memset(linInfoFrame, 0x00, sizeof linInfoFrame);
+void HellaIbs::onRecvFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result) {
+        HellaIbs* hellaIbs = static_cast<HellaIbs*>(context);
+        hellaIbs->result = result;
+        hellaIbs->resultAddr = addr;
+        hellaIbs->recvDone = true;
 }
 
 void HellaIbs::configure(int16_t nominalCapacity /* Ah */, IbsBatteryType battType /* Std | Gel | AGM */) {
         startConfigure = true;
         configNominalCapacity = nominalCapacity;
         configBattType = battType;
+        setConfigStatus(kIbsConfigBusy);
 }
 
 
 String HellaIbs::getName(void) {
-        if (available) {
-                return ibs[ibsTypeIndex].name;
+        if (isAvailable()) {
+                return ibs[connectedIbsIndex].name;
         } else {
                 return String("unknown");
         }
@@ -0,0 +1,135 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "HellaIbsSimulator.h"
+
+
+HellaIbsSimulator::HellaIbsSimulator(const IbsType* type, uint8_t variant) {
+        this->type = type;
+        this->variant = variant;
+        online = true;
+        wildcards = true;
+        responseDelay = 200; // uSec, a typical slave reacts within a few bit times.
+        script = 0;
+        diagResponsePending = false;
+
+        // A 100 Ah AGM battery at rest, slightly discharging.
+        current = -1500;
+        voltage = 12800;
+        temperature = (20 + 40) * 2;
+        error = false;
+        soc = 80 * 2;
+        soh = 95 * 2;
+        optChargeVoltage = 160 + 16;
+        avgRi = 850;
+        availableCapacity = 800;
+        dischargeableCapacity = 400;
+        nominalCapacity = 100;
+        calibrated = true;
+        batteryType = kBatteryTypeAgm;
+}
+
+void HellaIbsSimulator::setDiagResponse(uint8_t pci, uint8_t rsid, const uint8_t* payload, uint8_t length) {
+        memset(diagResponse, 0xFF, sizeof diagResponse);
+        diagResponse[0] = type->nad;
+        diagResponse[1] = pci;
+        diagResponse[2] = rsid;
+        if (0 < length) {
+                memcpy(&diagResponse[3], payload, length);
+        }
+        diagResponsePending = true;
+}
+
+uint8_t HellaIbsSimulator::publish(uint8_t id, uint8_t* data) {
+        if (script) {
+                script(this, id);
+        }
+        if (!online) {
+                return 0;
+        }
+
+        if (0x3D == id) {
+                if (!diagResponsePending) {
+                        return 0;
+                }
+                diagResponsePending = false;
+                memcpy(data, diagResponse, sizeof diagResponse);
+                return sizeof diagResponse;
+        }
+
+        const bool s2 = kIbsSlotS2 == type->slot;
+        if ((s2 ? IbsS2Frame2::id : IbsS1Frame2::id) == id) {
+                uint32_t rawCurrent = current + 2000000L;
+                data[0] = rawCurrent;
+                data[1] = rawCurrent >> 8;
+                data[2] = rawCurrent >> 16;
+                data[3] = voltage;
+                data[4] = voltage >> 8;
+                data[5] = temperature;
+                data[6] = error ? 0x80 : 0x00;
+                return IbsS1Frame2::length;
+        } else if ((s2 ? IbsS2Frame5::id : IbsS1Frame5::id) == id) {
+                data[0] = soc;
+                data[1] = soh;
+                data[2] = 0x00;
+                data[3] = optChargeVoltage;
+                data[4] = avgRi;
+                data[5] = avgRi >> 8;
+                return IbsS1Frame5::length;
+        } else if ((s2 ? IbsS2Frame6::id : IbsS1Frame6::id) == id) {
+                data[0] = availableCapacity;
+                data[1] = availableCapacity >> 8;
+                data[2] = dischargeableCapacity;
+                data[3] = dischargeableCapacity >> 8;
+                data[4] = nominalCapacity;
+                data[5] = calibrated ? 0x01 : 0x00;
+                return IbsS1Frame6::length;
+        }
+        return 0;
+}
+
+void HellaIbsSimulator::subscribe(uint8_t id, const uint8_t* data, uint8_t nBytes) {
+        if (!online || 0x3C != id || 8 != nBytes || type->nad != data[0]) {
+                return;
+        }
+
+        uint8_t sid = data[2];
+        uint8_t identifier = data[3];
+        if (0xB2 == sid) { // Read by identifier
+                if (0x00 == identifier) {
+                        // Product identification, only answered if supplier and function ID are ours or wildcards.
+                        const uint8_t* id = &type->diagRequestPdu[2];
+                        bool supplier = (wildcards && 0xFF == data[4] && 0x7F == data[5]) || (id[0] == data[4] && id[1] == data[5]);
+                        bool function = (wildcards && 0xFF == data[6] && 0xFF == data[7]) || (id[2] == data[6] && id[3] == data[7]);
+                        if (supplier && function) {
+                                uint8_t payload[5] = {id[0], id[1], id[2], id[3], variant};
+                                setDiagResponse(0x06, sid + 0x40, payload, sizeof payload);
+                        }
+                } else if (0x39 == identifier) {
+                        setDiagResponse(0x02, sid + 0x40, &nominalCapacity, 1);
+                } else if (0x3A == identifier) {
+                        setDiagResponse(0x02, sid + 0x40, &batteryType, 1);
+                }
+        } else if (0xB5 == sid) { // Hella specific write
+                if (0x39 == identifier) {
+                        nominalCapacity = data[4];
+                } else if (0x3A == identifier) {
+                        batteryType = data[4];
+                }
+                setDiagResponse(0x01, sid + 0x40, 0, 0);
+        }
+}
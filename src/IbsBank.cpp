@@ -0,0 +1,104 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#include "IbsBank.h"
+#include "Persistence.h"
+
+
+void IbsBank::setup(LinBusArbiter* linArbiter) {
+        LinBusArbiter* linArbiters[IBS_INSTANCE_COUNT];
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                linArbiters[i] = linArbiter;
+        }
+        setup(linArbiters);
+}
+
+void IbsBank::setup(LinBusArbiter* const linArbiters[IBS_INSTANCE_COUNT]) {
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                uint8_t owner = 0;
+                while (linArbiters[owner] != linArbiters[i]) {
+                        ++owner;
+                }
+                if (owner == i) {
+                        transports[i].setup(linArbiters[i]);
+                }
+                sensors[i].setup(linArbiters[i], &transports[owner], i);
+                enabled[i] = 0 == i || Persistence::getInstance().readSlotBoolean(kPSlotIbs2OnOff);
+        }
+}
+
+void IbsBank::loop(void) {
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                transports[i].loop(); // Idle without a bus.
+        }
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                if (enabled[i]) {
+                        sensors[i].loop();
+                }
+        }
+}
+
+void IbsBank::setEnabled(uint8_t instance, bool enable) {
+        if (0 == instance || IBS_INSTANCE_COUNT <= instance || enable == enabled[instance]) {
+                return;
+        }
+        enabled[instance] = enable;
+        Persistence::getInstance().writeSlotBoolean(kPSlotIbs2OnOff, enable);
+        if (!enable) {
+                sensors[instance].stop();
+        }
+}
+
+uint8_t IbsBank::getAvailableCount(void) const {
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                if (sensors[i].isAvailable()) {
+                        ++count;
+                }
+        }
+        return count;
+}
+
+float IbsBank::getBatteryCurrent(void) const {
+        int32_t current = 0;
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                if (sensors[i].isAvailable()) {
+                        current += sensors[i].getSample().current;
+                }
+        }
+        return current / 1000.0f;
+}
+
+IbsEnergyTotals IbsBank::getTotals(IbsEnergyPeriod period) {
+        IbsEnergyTotals sum;
+        memset(&sum, 0, sizeof sum);
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                const IbsEnergyTotals& totals = sensors[i].getEnergyCounter().getTotals(period);
+                sum.chargedCharge += totals.chargedCharge;
+                sum.dischargedCharge += totals.dischargedCharge;
+                sum.chargedEnergy += totals.chargedEnergy;
+                sum.dischargedEnergy += totals.dischargedEnergy;
+        }
+        return sum;
+}
+
+void IbsBank::resetTotals(IbsEnergyPeriod period) {
+        for (uint8_t i = 0; i < IBS_INSTANCE_COUNT; ++i) {
+                sensors[i].getEnergyCounter().reset(period);
+        }
+}
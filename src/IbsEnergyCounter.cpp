@@ -0,0 +1,151 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "IbsEnergyCounter.h"
+#include <time.h>
+
+
+const uint32_t IBS_ENERGY_MAGIC = 0x49424531; // "IBE1"
+const time_t CLOCK_VALID = 1609459200; // 2021-01-01, earlier times count from power-on, the clock is not set yet.
+const uint64_t CHARGE_PER_MAH = 3600000ULL; // mA * msec
+const uint64_t ENERGY_PER_MWH = 3600000000ULL; // uW * msec
+
+// Persistence layout: trip and total, each as charged/discharged mAh and charged/discharged mWh.
+const uint8_t CHECKPOINT_VALUES = 8;
+static_assert(CHECKPOINT_VALUES * sizeof(uint32_t) + 1 == 33, "kPSlotIbsEnergy length must match the checkpoint.");
+
+
+// 0 while the clock is not set.
+static uint32_t getLocalDay(time_t now) {
+        if (CLOCK_VALID > now) {
+                return 0;
+        }
+        struct tm local;
+        localtime_r(&now, &local);
+        return (local.tm_year + 1900) * 1000UL + local.tm_yday;
+}
+
+
+IbsEnergyCounter::IbsEnergyCounter(void) {
+        hasLastSample = false;
+        lastCheck = 0;
+        store = 0;
+}
+
+void IbsEnergyCounter::setup(IbsEnergyStore* store, PersistenceSlot slot) {
+        this->store = store;
+        this->slot = slot;
+        if (IBS_ENERGY_MAGIC == store->magic) {
+                return; // Woken up from deep sleep, the totals are still there.
+        }
+        memset(store, 0, sizeof *store);
+        store->magic = IBS_ENERGY_MAGIC;
+        store->day = getLocalDay(time(nullptr));
+        store->lastCheckpoint = time(nullptr);
+        restore();
+}
+
+void IbsEnergyCounter::loop(void) {
+        if (1000 > millis() - lastCheck) {
+                return;
+        }
+        lastCheck = millis();
+
+        uint32_t now = time(nullptr);
+        uint32_t today = getLocalDay(now);
+        if (0 != today && today != store->day) {
+                if (0 != store->day) {
+                        reset(kIbsPeriodDay);
+                } // else the clock has just been set, what was counted since power-on belongs to today.
+                store->day = today;
+        }
+        if (store->dirty && IBS_ENERGY_CHECKPOINT_INTERVAL <= now - store->lastCheckpoint) {
+                checkpoint();
+        }
+}
+
+void IbsEnergyCounter::addSample(int32_t current, uint16_t voltage, uint32_t time) {
+        if (hasLastSample && IBS_ENERGY_MAX_SAMPLE_GAP >= time - lastSampleTime) {
+                uint64_t charge = (uint64_t) (0 > lastCurrent ? -int64_t(lastCurrent) : lastCurrent) * (time - lastSampleTime);
+                uint64_t energy = charge * lastVoltage;
+                for (uint8_t i = 0; i < kIbsPeriodCount; ++i) {
+                        if (0 <= lastCurrent) {
+                                store->totals[i].chargedCharge += charge;
+                                store->totals[i].chargedEnergy += energy;
+                        } else {
+                                store->totals[i].dischargedCharge += charge;
+                                store->totals[i].dischargedEnergy += energy;
+                        }
+                }
+                if (0 < charge) {
+                        store->dirty = true;
+                }
+        }
+        hasLastSample = true;
+        lastCurrent = current;
+        lastVoltage = voltage;
+        lastSampleTime = time;
+}
+
+void IbsEnergyCounter::reset(IbsEnergyPeriod period) {
+        if (kIbsPeriodCount <= period) {
+                return;
+        }
+        memset(&store->totals[period], 0, sizeof store->totals[period]);
+        if (kIbsPeriodDay != period) {
+                checkpoint();
+        }
+}
+
+const IbsEnergyTotals& IbsEnergyCounter::getTotals(IbsEnergyPeriod period) const {
+        if (kIbsPeriodCount <= period) {
+                period = kIbsPeriodTotal;
+        }
+        return store->totals[period];
+}
+
+void IbsEnergyCounter::checkpoint(void) {
+        uint32_t values[CHECKPOINT_VALUES];
+        for (uint8_t i = 0; i < 2; ++i) {
+                const IbsEnergyTotals& totals = store->totals[kIbsPeriodTrip + i];
+                values[i * 4 + 0] = totals.chargedCharge / CHARGE_PER_MAH;
+                values[i * 4 + 1] = totals.dischargedCharge / CHARGE_PER_MAH;
+                values[i * 4 + 2] = totals.chargedEnergy / ENERGY_PER_MWH;
+                values[i * 4 + 3] = totals.dischargedEnergy / ENERGY_PER_MWH;
+        }
+        Persistence::getInstance().writeSlot(slot, (char*) values, sizeof values);
+        store->lastCheckpoint = time(nullptr);
+        store->dirty = false;
+}
+
+void IbsEnergyCounter::restore(void) {
+        if (!Persistence::getInstance().isSlotValid(slot)) {
+                return;
+        }
+        uint32_t values[CHECKPOINT_VALUES];
+        Persistence::getInstance().readSlot(slot, (char*) values, sizeof values);
+        if (0xfefefefe == values[0]) {
+                return; // Erased slot.
+        }
+        for (uint8_t i = 0; i < 2; ++i) {
+                IbsEnergyTotals& totals = store->totals[kIbsPeriodTrip + i];
+                totals.chargedCharge = values[i * 4 + 0] * CHARGE_PER_MAH;
+                totals.dischargedCharge = values[i * 4 + 1] * CHARGE_PER_MAH;
+                totals.chargedEnergy = values[i * 4 + 2] * ENERGY_PER_MWH;
+                totals.dischargedEnergy = values[i * 4 + 3] * ENERGY_PER_MWH;
+        }
+}
@@ -41,17 +41,9 @@ static uint64_t lastDisplayErrorTime = millis();
 static uint16_t errorColor[2] = {Defaults.getBgColor(), Defaults.getErrorColor()};
 static uint8_t errorColorIndex = 0;
 
-static uint8_t lastSoc;
-static uint8_t lastCalibrated;
-static float lastBatteryCurrent;
-static int16_t lastIx;
-static float lastBatteryVoltage;
-static float lastAvailableCapacity;
-static float lastDischargeableCapacity;
-static uint8_t lastNominalCapacity;
-static float lastTemperature;
-static uint8_t lastSoh;
-static IbsBatteryType lastBatteryType;
+// Fields drawn by the battery and runtime indicators, shared with the main menu.
+static const uint16_t batteryIndicatorFields = kIbsFieldSoc | kIbsFieldCalibrated;
+static const uint16_t batteryStatusFields = batteryIndicatorFields | kIbsFieldRuntime;
 
 
 static uint16_t nominalCapacitySetupValue;
@@ -64,6 +56,9 @@ IbsMenu::IbsMenu(Adafruit_ILI9341* adaIli9431, HellaIbs* ibs)
         : MenuItem(adaIli9431), MenuBatteryStatus() {
         this->adaIli9431 = adaIli9431;
         this->ibs = ibs;
+        pendingFields = kIbsFieldAll;
+        ibs->subscribe(onIbsUpdate, this);
+        addWidgets();
         batteryY = Defaults.getFontH() * 3;
         ampereMeterY = Defaults.getFontH() * 3;
         statsY = Defaults.getFontH() * 4;
@@ -73,11 +68,37 @@ IbsMenu::IbsMenu(Adafruit_ILI9341* adaIli9431, String headline, HellaIbs* ibs)
         : MenuItem(adaIli9431, headline), MenuBatteryStatus() {
         this->adaIli9431 = adaIli9431;
         this->ibs = ibs;
+        pendingFields = kIbsFieldAll;
+        ibs->subscribe(onIbsUpdate, this);
+        addWidgets();
         batteryY = Defaults.getFontH() * 3;
         ampereMeterY = Defaults.getFontH() * 3;
         statsY = Defaults.getFontH() * 4;
 }
 
+void IbsMenu::addWidgets(void) {
+        widgets.add(&runtimeHeading);
+        widgets.add(&voltage);
+        widgets.add(&availableCapacity);
+        widgets.add(&dischargeableCapacity);
+        widgets.add(&nominalCapacity);
+        widgets.add(&temperature);
+        widgets.add(&batteryType);
+        widgets.add(&soh);
+        widgets.add(&ampFactor);
+        widgets.add(&currentGauge);
+        widgets.add(&current);
+        batteryWidgets.add(&socBar);
+        batteryWidgets.add(&soc);
+        batteryWidgets.add(&runtime);
+
+        voltage.setFormat(2, 1, "V");
+        availableCapacity.setFormat(3, 0, "Ah");
+        dischargeableCapacity.setFormat(3, 0, "Ah");
+        temperature.setFormat(2, 0, "\xb0" "C", true);
+        soh.setFormat(4, 0, "%");
+}
+
 void IbsMenu::printScreenImplementation(void) {
         commonPrintScreen();
         ibs->setHighSpeedCommunication(true);
@@ -99,14 +120,6 @@ void IbsMenu::printScreenImplementation(void) {
         adaIli9431->setCursor(statsX, statsY + 6 * h); adaIli9431->print("Type:"); // Battery type: Std|AGM|Gel
         adaIli9431->setCursor(statsX, statsY + 7 * h); adaIli9431->print("SOH :"); // State of health
 
-        adaIli9431->setFont(Defaults.getMiniFont());
-        int16_t x1, y1;
-        uint16_t w1, h1;
-        adaIli9431->getTextBounds(ibs->getName(), 0, 0, &x1, &y1, &w1, &h1);
-        adaIli9431->setCursor(DISPLAY_W / 2 - w1 / 2, statsY + 9 * h);
-        adaIli9431->print(ibs->getName()); // IBS name
-        adaIli9431->setFont(Defaults.getFont());
-
         // Amperemeter:
         uint16_t x = ampereMeterX;
         uint16_t y = ampereMeterY;
@@ -134,99 +147,102 @@ void IbsMenu::printScreenImplementation(void) {
         adaIli9431->setCursor(x + ampereMeterW + ampereMeterMarkerW * 1.5, y + ampereMeterH + Defaults.getFontY() / 2);
         adaIli9431->print("-2");
 
-        lastSoc = 199;
-        lastCalibrated = 99;
-        lastBatteryCurrent = -999.9;
-        lastIx = 0xff;
-        lastBatteryVoltage = -999.9;
-        lastAvailableCapacity = -999.9;
-        lastDischargeableCapacity = -999.9;
-        lastNominalCapacity = 0;
-        lastTemperature = -99.9;
-        lastSoh = 0;
-        lastBatteryType = (IbsBatteryType) 0x00;
+        x1 = statsX + 5 * w + 10;
+        runtimeHeading.setPosition(statsX, statsY + 8 * h, 5);
+        voltage.setPosition(x1, statsY + 0 * h, 5);
+        availableCapacity.setPosition(x1, statsY + 1 * h, 5);
+        dischargeableCapacity.setPosition(x1, statsY + 2 * h, 5);
+        nominalCapacity.setPosition(x1, statsY + 3 * h, 5);
+        temperature.setPosition(x1, statsY + 9 * h / 2, 5);
+        batteryType.setPosition(x1, statsY + 6 * h, 5);
+        soh.setPosition(x1, statsY + 7 * h, 5);
+        ampFactor.setPosition(ampereMeterFactorX, ampereMeterY - Defaults.getFontH(), 4);
+        currentGauge.setPosition(ampereMeterX + 1, ampereMeterY, ampereMeterW - 2, ampereMeterH, ampereMeterNeedleH);
+        current.setPosition(ampereMeterX, ampereMeterY + ampereMeterH + Defaults.getFontY() * 2, 6);
+        pendingFields = kIbsFieldAll;
 
         nominalCapacitySetupValue = 0xffff;
 }
 
+void IbsMenu::onIbsUpdate(void* context, const HellaIbs* ibs, uint16_t changed) {
+        static_cast<IbsMenu*>(context)->pendingFields |= changed;
+}
+
 void IbsMenu::updateScreenImplementation(void) {
         updateBatteryIndicator(batteryX, batteryY, batteryWidth, batteryHeight);
 
         h = Defaults.getFontH();
         w = Defaults.getFontCharW();
         x1 = statsX + 5 * w + 10;
-        uint16_t fgColor = Defaults.getFgColor();
-        uint16_t bgColor = ILI9341_BLACK;
 
-        float voltage = ibs->getBatteryVoltage();
-        if (lastBatteryVoltage != voltage) {
-                snprintf(string, sizeof string, "%2d.%1dV", (uint8_t)voltage, (uint8_t)(voltage * 10) % 10);
-                updateDisplayText(string, x1, statsY + 0 * h, fgColor, bgColor);
-                lastBatteryVoltage = voltage;
+        if (pendingFields & kIbsFieldRuntime) {
+                switch (ibs->getRuntimeEstimator().getTrend()) {
+                case kIbsTrendDischarging:
+                        runtimeHeading.setText("Empt:");
+                        break;
+                case kIbsTrendCharging:
+                        runtimeHeading.setText("Full:");
+                        break;
+                default:
+                        runtimeHeading.setText("Time:");
+                        break;
+                }
+                updateRuntimeIndicator(x1, statsY + 8 * h); // Time to empty or full
         }
 
-        float availableCapacity = ibs->getAvailableCapacity();
-        if (lastAvailableCapacity != availableCapacity) {
-                snprintf(string, sizeof string, "%3dAh", (uint8_t)availableCapacity);
-                updateDisplayText(string, x1, statsY + 1 * h, fgColor, bgColor); // Available capacity
-                lastAvailableCapacity = availableCapacity;
+        uint16_t changed = pendingFields & ~batteryStatusFields;
+        pendingFields &= batteryStatusFields;
+        const IbsSample& sample = ibs->getSample();
+
+        if (changed & kIbsFieldVoltage) {
+                voltage.setValue(sample.voltage / 100);
         }
 
-        float dischargeableCapacity = ibs->getDischargeableCapacity();
-        if (lastDischargeableCapacity != dischargeableCapacity) {
-                snprintf(string, sizeof string, "%3dAh", (uint8_t)dischargeableCapacity);
-                updateDisplayText(string, x1, statsY + 2 * h, fgColor, bgColor); // Dischargable capacity
-                lastDischargeableCapacity = dischargeableCapacity;
+        if (changed & kIbsFieldAvailableCapacity) {
+                availableCapacity.setValue(sample.availableCapacity / 10);
         }
 
-        int16_t nominalCapacity;
-        if (menuEntered) {
-                nominalCapacity = nominalCapacitySetupValue;
-        } else {
-                nominalCapacity = ibs->getNominalCapacity();
+        if (changed & kIbsFieldDischargeableCapacity) {
+                dischargeableCapacity.setValue(sample.dischargeableCapacity / 10);
         }
-        if (lastNominalCapacity != nominalCapacity) {
+
+        if (changed & kIbsFieldNominalCapacity) {
+                int16_t nominalCapacity;
+                if (menuEntered) {
+                        nominalCapacity = nominalCapacitySetupValue;
+                } else {
+                        nominalCapacity = sample.nominalCapacity;
+                }
                 updateNominalCapacityStat(x1, statsY + 3 * h, nominalCapacity, menuEntered && selectionFocus.at(0), itemSelected);
-                lastNominalCapacity = nominalCapacity;
         }
 
-        float temperature = ibs->getTemperature();
-        if (lastTemperature != temperature) {
-                snprintf(string, sizeof string, "%+2d C", (int8_t)temperature);
-                uint16_t tempY = statsY + 9 * h / 2;
-                updateDisplayText(string, x1, tempY, fgColor, bgColor); // Battery temperature
-                adaIli9431->drawCircle(x1 + 4 * w, tempY - Defaults.getFontH() / 2, 2, fgColor); // degree
-                adaIli9431->drawCircle(x1 + 4 * w, tempY - Defaults.getFontH() / 2, 3, fgColor); // bold
-                lastTemperature = temperature;
+        if (changed & kIbsFieldTemperature) {
+                temperature.setValue(sample.temperature / 2);
         }
 
-        IbsBatteryType batteryType;
-        if (menuEntered) {
-                batteryType = battTypes[battTypeSelectionIndex];
-        } else {
-                batteryType = ibs->getBatteryType();
-        }
-        if (lastBatteryType != batteryType) {
+        if (changed & kIbsFieldBatteryType) {
+                IbsBatteryType batteryType;
+                if (menuEntered) {
+                        batteryType = battTypes[battTypeSelectionIndex];
+                } else {
+                        batteryType = (IbsBatteryType) sample.batteryType;
+                }
                 updateBatteryTypeStat(x1, statsY + 6 * h, batteryType, menuEntered && selectionFocus.at(1), itemSelected);
-                lastBatteryType = batteryType;
         }
 
-        uint8_t soh = ibs->getSoh();
-        if (lastSoh != soh) {
-                snprintf(string, sizeof string, " %3d%%", soh);
-                updateDisplayText(string, x1, statsY + 7 * h, fgColor, bgColor); // State of health
-                lastSoh = soh;
+        if (changed & (kIbsFieldConfig | kIbsFieldAvailable)) {
+                updateConfigStatus(statsY + 9 * h);
+        }
+
+        if (changed & kIbsFieldSoh) {
+                soh.setValue(sample.soh);
         }
 
-        float current = ibs->getBatteryCurrent();
-        if (lastBatteryCurrent != current) {
+        if (changed & kIbsFieldCurrent) {
+                float current = ibs->getBatteryCurrent();
                 boolean currentOutOfScope = false;
                 boolean charging = true;
                 int16_t ix;
-
-                int16_t x1, y1;
-                uint16_t w, h;
-                adaIli9431->getTextBounds("x100", 0, 0, &x1, &y1, &w, &h);
                 uint16_t handleColor = ILI9341_BLUE;
 
                 if (current < 0) {
@@ -250,18 +266,16 @@ void IbsMenu::updateScreenImplementation(void) {
                         currentOutOfScope = true;
                 }
 
-                String ampFactorString;
                 if (current <= 2) {
-                        ampFactorString = "    ";
+                        ampFactor.setText("    ");
                         ix = uint8_t(ampMeterCenterY * current / 2.0);
                 } else if ((current > 2) && (current <= 20)) {
-                        ampFactorString = " x10";
+                        ampFactor.setText(" x10");
                         ix = uint8_t(ampMeterCenterY * current / 20.0);
                 } else /*if (current > 20)*/ {
-                        ampFactorString = "x100";
+                        ampFactor.setText("x100");
                         ix = uint8_t(ampMeterCenterY * current / 200.0);
                 }
-                updateDisplayText(ampFactorString.c_str(), ampereMeterFactorX, ampereMeterY - Defaults.getFontH(), fgColor, bgColor);
 
                 if (!charging) {
                         ix = -ix;
@@ -270,18 +284,44 @@ void IbsMenu::updateScreenImplementation(void) {
                 if (currentOutOfScope) {
                         handleColor = ILI9341_YELLOW;
                 }
-                if (lastIx != ix) {
-                        if (0xff != lastIx) {
-                                // Clear last needle display if lastIx is valid:
-                                adaIli9431->fillRect(ampereMeterX + 1, ampereMeterY + ampMeterCenterY - ampereMeterNeedleH / 2 - lastIx, ampereMeterW - 2, ampereMeterNeedleH, Defaults.getFgColor());
-                        }
-                        adaIli9431->fillRect(ampereMeterX + 1, ampereMeterY + ampMeterCenterY - ampereMeterNeedleH / 2 - ix, ampereMeterW - 2, ampereMeterNeedleH, handleColor);
-                        lastIx = ix;
-                }
-                updateDisplayText(string, ampereMeterX, ampereMeterY + ampereMeterH + Defaults.getFontY() * 2, fgColor, bgColor);
+                currentGauge.setNeedle(ix, handleColor);
+                this->current.setText(string);
+        }
+
+        widgets.render(adaIli9431);
+}
 
-                lastBatteryCurrent = current;
+void IbsMenu::updateConfigStatus(uint16_t y) {
+        // The IBS name, in green once a configuration has been verified. Pending and failed configurations replace it.
+        String text = ibs->getName();
+        uint16_t color = Defaults.getFgColor();
+        switch (ibs->getConfigStatus()) {
+        case kIbsConfigBusy:
+                text = "Writing configuration...";
+                color = ILI9341_YELLOW;
+                break;
+        case kIbsConfigOk:
+                color = ILI9341_GREEN;
+                break;
+        case kIbsConfigFailed:
+                text = "Configuration failed, please retry.";
+                color = Defaults.getErrorColor();
+                break;
+        default:
+                break;
         }
+
+        adaIli9431->setFont(Defaults.getMiniFont());
+        int16_t x1, y1;
+        uint16_t w1, h1;
+        adaIli9431->getTextBounds("Xg", 0, y, &x1, &y1, &w1, &h1);
+        DisplayStream::getInstance().fillRect(adaIli9431, 0, y1, DISPLAY_W, h1, Defaults.getBgColor());
+        adaIli9431->getTextBounds(text, 0, 0, &x1, &y1, &w1, &h1);
+        adaIli9431->setTextColor(color);
+        adaIli9431->setCursor(DISPLAY_W / 2 - w1 / 2, y);
+        adaIli9431->print(text);
+        adaIli9431->setTextColor(Defaults.getFgColor(), ILI9341_BLACK);
+        adaIli9431->setFont(Defaults.getFont());
 }
 
 void IbsMenu::onEnterButtonImplementation(void) {
@@ -291,8 +331,7 @@ void IbsMenu::onEnterButtonImplementation(void) {
 
                 itemSelected = false;
                 menuEntered = true;
-                lastNominalCapacity = 0;
-                lastBatteryType = (IbsBatteryType) 0x00;
+                pendingFields |= kIbsFieldNominalCapacity | kIbsFieldBatteryType;
                 nominalCapacitySetupValue = ibs->getNominalCapacity();
                 IbsBatteryType battType = ibs->getBatteryType();
                 for (uint8_t i = 0; i<battTypesCount; ++i) {
@@ -306,8 +345,7 @@ void IbsMenu::onEnterButtonImplementation(void) {
 
 void IbsMenu::onLeaveButtonImplementation(void) {
         menuEntered = false;
-        lastNominalCapacity = 0;
-        lastBatteryType = (IbsBatteryType) 0x00;
+        pendingFields |= kIbsFieldNominalCapacity | kIbsFieldBatteryType;
         ibs->configure(nominalCapacitySetupValue, battTypes[battTypeSelectionIndex]);
 }
 
@@ -368,8 +406,7 @@ void IbsMenu::updateSelectionFocus(void) {
         selectionFocus.assign(2, false);
         selectionFocus.at(selectionIndex) = true;
 
-        lastNominalCapacity = 0;
-        lastBatteryType = (IbsBatteryType) 0x00;
+        pendingFields |= kIbsFieldNominalCapacity | kIbsFieldBatteryType;
 }
 
 void IbsMenu::drawBatteryIndicator(uint16_t x, uint16_t y, uint8_t w, uint8_t h, uint8_t poleH, uint8_t poleW) {
@@ -377,13 +414,17 @@ void IbsMenu::drawBatteryIndicator(uint16_t x, uint16_t y, uint8_t w, uint8_t h,
         adaIli9431->fillRect(x + xPoleOffset, y - poleH, poleW, poleH, Defaults.getFgColor());
         adaIli9431->fillRect(x + w - xPoleOffset - poleW, y - poleH, poleW, poleH, Defaults.getFgColor());
         adaIli9431->drawRect(x, y, w, h, Defaults.getFgColor());
-        lastSoc = 0xff;
+        socBar.setPosition(x + 2, y + 2, w - 4, h - 4);
+        soc.setPosition(x + w / 2 - Defaults.getFontCharW() * 2, y + h + Defaults.getFontY() * 2, 4);
+        batteryWidgets.invalidate();
+        pendingFields |= batteryStatusFields;
 }
 
 void IbsMenu::updateBatteryIndicator(uint16_t batteryX, uint16_t batteryY, uint16_t batteryWidth, uint16_t batteryHeight) {
-        uint8_t soc = ibs->getSoc();
-        uint8_t calibrated = ibs->isCalibrated();
-        if (lastSoc != soc || lastCalibrated != calibrated) {
+        if (pendingFields & batteryIndicatorFields) {
+                pendingFields &= ~batteryIndicatorFields;
+                uint8_t soc = ibs->getSoc();
+                bool calibrated = ibs->isCalibrated();
                 uint16_t color = Defaults.getFgColor();
                 if (80 < soc) color = ILI9341_GREEN;
                 else if (80 >= soc && soc > 20) {
@@ -392,10 +433,7 @@ void IbsMenu::updateBatteryIndicator(uint16_t batteryX, uint16_t batteryY, uint1
                         color = getColorGradient(ILI9341_RED, ILI9341_GREEN, gradient);
                 }
                 else if (20 >= soc) color = ILI9341_RED;
-                uint16_t socHeight = soc * (batteryHeight - 4) /  100;
-
-                adaIli9431->fillRect(batteryX + 2, batteryY + 2, batteryWidth - 4, batteryHeight - 4 - socHeight, Defaults.getBgColor());
-                adaIli9431->fillRect(batteryX + 2, batteryY + 2 + (batteryHeight - 4 - socHeight), batteryWidth - 4, socHeight, color);
+                socBar.setLevel(soc, color);
 
                 if (calibrated) {
                         color = Defaults.getFgColor();
@@ -403,14 +441,12 @@ void IbsMenu::updateBatteryIndicator(uint16_t batteryX, uint16_t batteryY, uint1
                         color = Defaults.getErrorColor();
                 }
                 if (0 != soc) {
-                        snprintf(string, sizeof string, "%3d%%", ibs->getSoc());
+                        snprintf(string, sizeof string, "%3d%%", soc);
                 } else {
                         snprintf(string, sizeof string, "n/a ");
                 }
-                updateDisplayText(string, batteryX + batteryWidth / 2 - Defaults.getFontCharW() * 2, batteryY + batteryHeight + Defaults.getFontY() * 2, color, Defaults.getBgColor());
-
-                lastSoc = soc;
-                lastCalibrated = calibrated;
+                this->soc.setText(string);
+                this->soc.setColors(color, Defaults.getBgColor());
         } else if (ibs->isError()) {
                 if (millis() - lastDisplayErrorTime >= 1000) {
                         lastDisplayErrorTime = millis();
@@ -419,9 +455,34 @@ void IbsMenu::updateBatteryIndicator(uint16_t batteryX, uint16_t batteryY, uint1
                         } else {
                                 errorColorIndex = 0;
                         }
-                        adaIli9431->fillRect(batteryX + 2, batteryY + 2, batteryWidth - 4, batteryHeight - 4, errorColor[errorColorIndex]);
+                        socBar.setLevel(100, errorColor[errorColorIndex]);
+                }
+        }
+        batteryWidgets.render(adaIli9431);
+}
+
+void IbsMenu::updateRuntimeIndicator(uint16_t x, uint16_t y) {
+        runtime.setPosition(x, y, 5);
+        if (pendingFields & kIbsFieldRuntime) {
+                pendingFields &= ~kIbsFieldRuntime;
+
+                const IbsRuntimeEstimator& estimator = ibs->getRuntimeEstimator();
+                uint32_t minutes = estimator.getMinutes();
+                if (IBS_RUNTIME_UNKNOWN == minutes) {
+                        snprintf(string, sizeof string, "--:--");
+                } else if (100 * 60 > minutes) {
+                        snprintf(string, sizeof string, "%02u:%02u", minutes / 60, minutes % 60);
+                } else {
+                        snprintf(string, sizeof string, "%4ud", min(minutes / (24 * 60), (uint32_t) 9999));
+                }
+                uint16_t color = Defaults.getFgColor();
+                if (kIbsTrendCharging == estimator.getTrend()) {
+                        color = ILI9341_GREEN;
                 }
+                runtime.setText(string);
+                runtime.setColors(color, Defaults.getBgColor());
         }
+        batteryWidgets.render(adaIli9431);
 }
 
 void IbsMenu::updateNominalCapacityStat(uint16_t x, uint16_t y, int16_t capacity, boolean highlighted, boolean selected) {
@@ -436,7 +497,9 @@ void IbsMenu::updateNominalCapacityStat(uint16_t x, uint16_t y, int16_t capacity
                 }
         }
         snprintf(string, sizeof string, "%3dAh", capacity);
-        updateDisplayText(string, x, y, fgColor, bgColor); // Nominal capacity
+        nominalCapacity.setPosition(x, y, 5);
+        nominalCapacity.setText(string);
+        nominalCapacity.setColors(fgColor, bgColor);
 }
 
 void IbsMenu::updateBatteryTypeStat(uint16_t x, uint16_t y, IbsBatteryType batteryType, boolean highlighted, boolean selected) {
@@ -464,5 +527,7 @@ void IbsMenu::updateBatteryTypeStat(uint16_t x, uint16_t y, IbsBatteryType batte
                         bgColor = Defaults.getBgHlSelectedColor();
                 }
         }
-        updateDisplayText(string, x, y, fgColor, bgColor); // Battery type
+        this->batteryType.setPosition(x, y, 5);
+        this->batteryType.setText(string);
+        this->batteryType.setColors(fgColor, bgColor);
 }
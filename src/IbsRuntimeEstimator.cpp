@@ -0,0 +1,93 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "IbsRuntimeEstimator.h"
+
+
+IbsRuntimeEstimator::IbsRuntimeEstimator(void) {
+        reset();
+}
+
+void IbsRuntimeEstimator::reset(void) {
+        hasLastSample = false;
+        ewma = 0;
+        memset(bucketCharge, 0, sizeof bucketCharge);
+        memset(bucketTime, 0, sizeof bucketTime);
+        windowCharge = 0;
+        windowTime = 0;
+        bucket = 0;
+        averageCurrent = 0;
+        trend = kIbsTrendIdle;
+        minutes = IBS_RUNTIME_UNKNOWN;
+}
+
+bool IbsRuntimeEstimator::addSample(int32_t current, uint16_t dischargeable, uint16_t available, int16_t nominal, uint32_t time) {
+        uint32_t dt = time - lastSampleTime;
+        bool integrate = hasLastSample && IBS_RUNTIME_MAX_SAMPLE_GAP >= dt && 0 < dt;
+        if (!hasLastSample && 0 == windowTime) {
+                ewma = int64_t(current) << 8; // Start the fast average at the first reading.
+        }
+        hasLastSample = true;
+        lastSampleTime = time;
+        if (!integrate) {
+                lastCurrent = current;
+                return false;
+        }
+
+        ewma += ((int64_t(current) << 8) - ewma) * dt / (IBS_RUNTIME_EWMA_TAU + dt);
+
+        int64_t charge = int64_t(lastCurrent) * dt;
+        lastCurrent = current;
+        bucketCharge[bucket] += charge;
+        bucketTime[bucket] += dt;
+        windowCharge += charge;
+        windowTime += dt;
+        if (IBS_RUNTIME_BUCKET_TIME <= bucketTime[bucket]) {
+                // The oldest bucket drops out of the window and is reused.
+                bucket = (bucket + 1) % IBS_RUNTIME_WINDOW_BUCKETS;
+                windowCharge -= bucketCharge[bucket];
+                windowTime -= bucketTime[bucket];
+                bucketCharge[bucket] = 0;
+                bucketTime[bucket] = 0;
+        }
+
+        int32_t fast = ewma / 256;
+        averageCurrent = fast;
+        if (IBS_RUNTIME_BUCKET_TIME <= windowTime) {
+                int32_t window = windowCharge / windowTime;
+                int32_t deviation = abs(fast - window);
+                if (deviation <= abs(window) * IBS_RUNTIME_LOAD_STEP / 100 + IBS_RUNTIME_IDLE_CURRENT) {
+                        averageCurrent = window;
+                }
+        }
+
+        IbsTrend newTrend = kIbsTrendIdle;
+        uint32_t newMinutes = IBS_RUNTIME_UNKNOWN;
+        if (-IBS_RUNTIME_IDLE_CURRENT > averageCurrent) {
+                newTrend = kIbsTrendDischarging;
+                newMinutes = uint32_t(dischargeable) * 100 * 60 / uint32_t(-averageCurrent); // 0.1 Ah -> mAh
+        } else if (IBS_RUNTIME_IDLE_CURRENT < averageCurrent) {
+                newTrend = kIbsTrendCharging;
+                int32_t missing = int32_t(nominal) * 1000 - int32_t(available) * 100; // mAh
+                newMinutes = 0 < missing ? uint32_t(missing) * 60 / uint32_t(averageCurrent) : 0;
+        }
+
+        bool changed = newTrend != trend || newMinutes != minutes;
+        trend = newTrend;
+        minutes = newMinutes;
+        return changed;
+}
@@ -0,0 +1,283 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "LinBusArbiter.h"
+
+
+// Diagnostic frames carry NAD addressed data for one client only, they are never shared.
+static inline bool isCoalescable(uint8_t addr) {
+        return 0x3C != addr && 0x3D != addr;
+}
+
+// Passes of the merged table, running every "cycle" msec, per pass of a client polled every "period" msec.
+static inline uint16_t getRate(uint16_t period, uint16_t cycle) {
+        return max((uint16_t) (((uint32_t) period + cycle / 2) / cycle), (uint16_t) 1);
+}
+
+bool LinBusArbiter::read(uint8_t addr, uint8_t* message, uint8_t nBytes, uint8_t proto, LinRequestPriority priority, LinRecvCallback callback, void* context) {
+        LinBusRequest request;
+        request.addr = addr;
+        request.nBytes = nBytes;
+        request.proto = proto;
+        request.write = false;
+        request.priority = priority;
+        request.message = message;
+        request.callback = callback;
+        request.context = context;
+        return submit(request);
+}
+
+bool LinBusArbiter::write(uint8_t addr, const uint8_t* message, uint8_t nBytes, uint8_t proto, LinRequestPriority priority, LinRecvCallback callback, void* context) {
+        LinBusRequest request;
+        if (nBytes > sizeof request.data) {
+                nBytes = sizeof request.data;
+        }
+        request.addr = addr;
+        request.nBytes = nBytes;
+        request.proto = proto;
+        request.write = true;
+        request.priority = priority;
+        memcpy(request.data, message, nBytes);
+        request.message = request.data;
+        request.callback = callback;
+        request.context = context;
+        return submit(request);
+}
+
+bool LinBusArbiter::submit(const LinBusRequest& request) {
+        if (!request.write) {
+                // The very same poll is queued already, just let it inherit the more urgent priority.
+                for (uint8_t i = 0; i < queueCount; ++i) {
+                        LinBusRequest* queued = &queue[i];
+                        if (!queued->write && queued->addr == request.addr && queued->message == request.message
+                            && queued->callback == request.callback && queued->context == request.context) {
+                                if (request.priority < queued->priority) {
+                                        queued->priority = request.priority;
+                                }
+                                return true;
+                        }
+                }
+        }
+        if (LIN_ARBITER_QUEUE_SIZE <= queueCount) {
+                return false;
+        }
+        queue[queueCount] = request;
+        queue[queueCount].sequence = nextSequence++;
+        if (request.write) {
+                queue[queueCount].message = queue[queueCount].data;
+        }
+        ++queueCount;
+        return true;
+}
+
+void LinBusArbiter::removeAt(uint8_t index) {
+        --queueCount;
+        for (uint8_t i = index; i < queueCount; ++i) {
+                queue[i] = queue[i + 1];
+                if (queue[i].write) {
+                        queue[i].message = queue[i].data;
+                }
+        }
+}
+
+void LinBusArbiter::cancel(void* context) {
+        for (uint8_t i = queueCount; i > 0; --i) {
+                if (queue[i - 1].context == context) {
+                        removeAt(i - 1);
+                }
+        }
+        if (activePending && active.context == context) {
+                active.callback = 0;
+        }
+}
+
+void LinBusArbiter::loop(void) {
+        if (activePending && !linDriver->isBusy()) {
+                complete(linDriver->getResult());
+        }
+        if (busWasBusy && !linDriver->isBusy()) {
+                busIdleSince = micros();
+        }
+        busWasBusy = linDriver->isBusy();
+
+        dispatch(); // Before the driver's loop, so queued requests go ahead of a due schedule slot.
+
+        if (linDriver->isBusy() || micros() - busIdleSince >= interFrameSpace) {
+                linDriver->loop(); // Idle, it would start the next schedule slot.
+        }
+
+        if (activePending && !linDriver->isBusy()) {
+                complete(linDriver->getResult());
+        }
+        if (busWasBusy && !linDriver->isBusy()) {
+                busIdleSince = micros();
+        }
+        busWasBusy = linDriver->isBusy();
+}
+
+void LinBusArbiter::dispatch(void) {
+        if (activePending || 0 == queueCount || linDriver->isBusy() || micros() - busIdleSince < interFrameSpace) {
+                return;
+        }
+
+        uint8_t next = 0;
+        for (uint8_t i = 1; i < queueCount; ++i) {
+                if (queue[i].priority < queue[next].priority
+                    || (queue[i].priority == queue[next].priority && (int32_t) (queue[i].sequence - queue[next].sequence) < 0)) {
+                        next = i;
+                }
+        }
+        active = queue[next];
+        if (active.write) {
+                active.message = active.data;
+        }
+        removeAt(next);
+
+        activePending = true;
+        if (active.write) {
+                linDriver->send(active.addr, active.message, active.nBytes, active.proto);
+        } else {
+                linDriver->recvAsync(active.addr, active.message, active.nBytes, active.proto);
+        }
+        busWasBusy = true;
+}
+
+void LinBusArbiter::complete(uint8_t result) {
+        activePending = false;
+        busIdleSince = micros();
+
+        // Other clients waiting for the same unconditional frame get this response as well.
+        if (!active.write && isCoalescable(active.addr)) {
+                for (uint8_t i = queueCount; i > 0; --i) {
+                        LinBusRequest duplicate = queue[i - 1];
+                        if (duplicate.write || duplicate.addr != active.addr || duplicate.nBytes != active.nBytes || duplicate.proto != active.proto) {
+                                continue;
+                        }
+                        removeAt(i - 1);
+                        if (duplicate.message != active.message) {
+                                memcpy(duplicate.message, active.message, active.nBytes);
+                        }
+                        if (duplicate.callback) {
+                                duplicate.callback(duplicate.context, duplicate.addr, duplicate.message, result);
+                        }
+                }
+        }
+        if (active.callback) {
+                active.callback(active.context, active.addr, active.message, result);
+        }
+}
+
+bool LinBusArbiter::setSchedule(void* owner, const LinScheduleSlot* slots, uint8_t count, uint16_t period) {
+        LinScheduleSegment* segment = 0;
+        uint8_t slotCount = 0;
+        for (uint8_t i = 0; i < LIN_ARBITER_MAX_SCHEDULES; ++i) {
+                if (segments[i].owner == owner) {
+                        segment = &segments[i];
+                } else if (0 < segments[i].count) {
+                        slotCount += segments[i].count + 1;
+                } else if (!segment && !segments[i].owner) {
+                        segment = &segments[i];
+                }
+        }
+        if (0 == count) {
+                slots = 0;
+                owner = 0;
+        } else if (!segment || LIN_ARBITER_SCHEDULE_SIZE < slotCount + count + 1) {
+                return false;
+        }
+        if (segment) {
+                LinScheduleSegment previous = *segment;
+                *segment = {owner, slots, count, max(period, (uint16_t) LIN_SCHEDULE_TIME_BASE), linDriver->getNextSchedulePass()};
+                if (!dividersFit()) {
+                        *segment = previous;
+                        return false;
+                }
+        }
+        buildSchedule();
+        return true;
+}
+
+// Shortest period of all clients, 0 without any.
+uint16_t LinBusArbiter::getCycle(void) const {
+        uint16_t cycle = 0;
+        for (uint8_t i = 0; i < LIN_ARBITER_MAX_SCHEDULES; ++i) {
+                if (0 < segments[i].count && (0 == cycle || segments[i].period < cycle)) {
+                        cycle = segments[i].period;
+                }
+        }
+        return cycle;
+}
+
+// Merged slots run on every "divider * rate"-th pass, which must fit into LinScheduleSlot::divider.
+bool LinBusArbiter::dividersFit(void) const {
+        uint16_t cycle = getCycle();
+        for (uint8_t i = 0; i < LIN_ARBITER_MAX_SCHEDULES; ++i) {
+                const LinScheduleSegment& segment = segments[i];
+                uint32_t rate = 0 < segment.count ? getRate(segment.period, cycle) : 1;
+                if (255 < rate) {
+                        return false;
+                }
+                for (uint8_t j = 0; j < segment.count; ++j) {
+                        if (255 < max(segment.slots[j].divider, (uint8_t) 1) * rate) {
+                                return false;
+                        }
+                }
+        }
+        return true;
+}
+
+void LinBusArbiter::buildSchedule(void) {
+        uint16_t cycle = getCycle();
+        if (0 == cycle) {
+                linDriver->setScheduleTable(0, 0);
+                return;
+        }
+
+        // Every client gets its frames followed by an idle slot, so their frames are spread evenly over the cycle.
+        // Sub-rated clients only show up on every "rate"-th pass, the others share the cycle.
+        uint8_t fullRate = 0;
+        for (uint8_t i = 0; i < LIN_ARBITER_MAX_SCHEDULES; ++i) {
+                if (0 < segments[i].count && 1 == getRate(segments[i].period, cycle)) {
+                        ++fullRate;
+                }
+        }
+        uint16_t share = cycle / fullRate;
+        uint8_t k = 0;
+        for (uint8_t i = 0; i < LIN_ARBITER_MAX_SCHEDULES; ++i) {
+                const LinScheduleSegment& segment = segments[i];
+                if (0 == segment.count) {
+                        continue;
+                }
+                uint16_t rate = getRate(segment.period, cycle);
+                uint8_t base = segment.passBase % rate;
+                uint16_t busTime = 0;
+                for (uint8_t j = 0; j < segment.count; ++j) {
+                        LinScheduleSlot slot = segment.slots[j];
+                        uint16_t divider = max(slot.divider, (uint8_t) 1);
+                        if (1 == divider) {
+                                busTime += slot.delay ? slot.delay : linDriver->getFrameSlotTime(slot.nBytes);
+                        }
+                        // Due on every "rate"-th pass of the merged table and then on the client's own sub-rate.
+                        slot.divider = divider * rate; // Checked by dividersFit().
+                        slot.phase = (slot.phase * rate + base) % slot.divider;
+                        schedule[k++] = slot;
+                }
+                uint16_t pause = (1 == rate && share > busTime) ? share - busTime : LIN_SCHEDULE_TIME_BASE;
+                schedule[k++] = {0, LinIdleSlot, 0, pause, 0, 0, 0, (uint8_t) rate, base};
+        }
+        linDriver->setScheduleTable(schedule, k);
+}
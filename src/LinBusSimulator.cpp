@@ -0,0 +1,218 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "LinBusSimulator.h"
+
+static const uint8_t SIM_BREAK_BITS = 14; // 13 bit BREAK plus delimiter.
+static const uint8_t SIM_BYTE_BITS = 10; // Start, 8 data, stop.
+
+
+LinBusSimulator::LinBusSimulator(void) {
+        slaveCount = 0;
+        baudrate = 19200;
+        bitTime = 1000000UL / baudrate;
+        busFreeTime = 0;
+        breakStart = 0;
+        breakEnd = 0;
+        rxHead = 0;
+        rxTail = 0;
+        rxHandedOver = 0;
+        rxFifoFull = LIN_SIM_RX_FIFO_FULL;
+        rxTimeout = LIN_SIM_RX_TIMEOUT_BYTES;
+        frameLength = 0;
+        frameResponded = false;
+        headerCount = 0;
+        longHeaderCount = 0;
+        responseCount = 0;
+        masterFrameCount = 0;
+}
+
+void LinBusSimulator::attach(LinSimSlave* slave) {
+        if (slaveCount < LIN_SIM_MAX_SLAVES) {
+                slaves[slaveCount++] = slave;
+        }
+}
+
+uint8_t LinBusSimulator::checksum(uint8_t pid, const uint8_t* data, uint8_t nBytes) {
+        uint16_t sum = pid;
+        while (nBytes-- > 0) sum += *(data++);
+        while (sum >> 8) sum = (sum & 255) + (sum >> 8);
+        return ~sum;
+}
+
+void LinBusSimulator::begin(unsigned long baud, uint32_t config, int8_t rxPin, int8_t txPin) {
+        baudrate = baud;
+        bitTime = 1000000UL / baudrate;
+        busFreeTime = micros();
+        rxHead = 0;
+        rxTail = 0;
+        rxHandedOver = 0;
+        rxFifoFull = LIN_SIM_RX_FIFO_FULL;
+        rxTimeout = LIN_SIM_RX_TIMEOUT_BYTES;
+        frameLength = 0;
+}
+
+void LinBusSimulator::end(void) {
+}
+
+unsigned long LinBusSimulator::occupyBus(uint8_t bits) {
+        unsigned long now = micros();
+        if ((long)(busFreeTime - now) < 0) {
+                busFreeTime = now;
+        }
+        busFreeTime += bits * bitTime;
+        return busFreeTime;
+}
+
+void LinBusSimulator::sendBreak(void) {
+        deliverMasterFrame();
+        breakEnd = occupyBus(SIM_BREAK_BITS);
+        breakStart = breakEnd - SIM_BREAK_BITS * bitTime;
+        frameLength = 0;
+        frameResponded = false;
+}
+
+size_t LinBusSimulator::write(uint8_t data) {
+        occupyBus(SIM_BYTE_BITS);
+        if (frameLength < sizeof frame) {
+                frame[frameLength++] = data;
+        }
+        if (2 == frameLength) { // sync and PID
+                if (busFreeTime - breakStart > LIN_SIM_HEADER_MAX_BITS * bitTime) {
+                        ++longHeaderCount;
+                        frameResponded = true; // Nobody takes it as a header.
+                } else {
+                        ++headerCount;
+                        onHeader(frame[1]);
+                }
+        } else if (sizeof frame == frameLength) {
+                deliverMasterFrame();
+        }
+        return 1;
+}
+
+size_t LinBusSimulator::write(const uint8_t* buffer, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+                write(buffer[i]);
+        }
+        return size;
+}
+
+void LinBusSimulator::onHeader(uint8_t pid) {
+        uint8_t data[8];
+        for (uint8_t s = 0; s < slaveCount; ++s) {
+                uint8_t nBytes = slaves[s]->publish(pid & 0x3f, data);
+                if (0 == nBytes) {
+                        continue;
+                }
+                if (LIN_SIM_NO_RESPONSE == nBytes) {
+                        break;
+                }
+                bool classic = 0x3C == (pid & 0x3f) || 0x3D == (pid & 0x3f);
+                int16_t cksum = slaves[s]->getChecksum(checksum(classic ? 0 : pid, data, nBytes));
+                unsigned long arrival = busFreeTime + slaves[s]->getResponseDelay();
+                for (uint8_t i = 0; i < nBytes + (0 <= cksum ? 1 : 0); ++i) {
+                        arrival += SIM_BYTE_BITS * bitTime;
+                        queueRx(i < nBytes ? data[i] : cksum, arrival);
+                }
+                busFreeTime = arrival;
+                frameResponded = true;
+                ++responseCount;
+                break;
+        }
+}
+
+void LinBusSimulator::deliverMasterFrame(void) {
+        // sync, PID, at least one data byte and the checksum.
+        if (!frameResponded && 4 <= frameLength) {
+                uint8_t pid = frame[1];
+                uint8_t id = pid & 0x3f;
+                uint8_t nBytes = frameLength - 3;
+                bool classic = 0x3C == id || 0x3D == id;
+                if (checksum(classic ? 0 : pid, &frame[2], nBytes) == frame[frameLength - 1]) {
+                        ++masterFrameCount;
+                        for (uint8_t s = 0; s < slaveCount; ++s) {
+                                slaves[s]->subscribe(id, &frame[2], nBytes);
+                        }
+                }
+        }
+        frameLength = 0;
+        frameResponded = true; // Deliver once only.
+}
+
+void LinBusSimulator::queueRx(uint8_t data, unsigned long arrival) {
+        uint8_t next = (rxHead + 1) % LIN_SIM_RX_QUEUE_SIZE;
+        if (next == rxTail) {
+                return; // Overrun, like a full UART FIFO.
+        }
+        rxQueue[rxHead].data = data;
+        rxQueue[rxHead].arrival = arrival;
+        rxHead = next;
+}
+
+void LinBusSimulator::updateRxFifo(void) {
+        unsigned long now = micros();
+        unsigned long byteTime = SIM_BYTE_BITS * bitTime;
+        while (rxHandedOver != rxHead) {
+                // Bytes received completely but still in the FIFO, up to the fill level that hands them over.
+                uint8_t received = 0;
+                uint8_t last = rxHandedOver;
+                for (uint8_t i = rxHandedOver; i != rxHead && (long)(now - rxQueue[i].arrival) >= 0 && received < rxFifoFull;
+                     i = (i + 1) % LIN_SIM_RX_QUEUE_SIZE) {
+                        last = i;
+                        ++received;
+                }
+                if (0 == received) {
+                        return;
+                }
+                uint8_t next = (last + 1) % LIN_SIM_RX_QUEUE_SIZE;
+                if (received < rxFifoFull) {
+                        // FIFO timeout: the line must stay idle for rxTimeout byte times, a new start bit restarts it.
+                        unsigned long expiry = rxQueue[last].arrival + rxTimeout * byteTime;
+                        if ((long)(now - expiry) < 0 || (next != rxHead && (long)(rxQueue[next].arrival - byteTime - expiry) < 0)) {
+                                return;
+                        }
+                }
+                rxHandedOver = next;
+        }
+}
+
+int LinBusSimulator::available(void) {
+        updateRxFifo();
+        return (rxHandedOver + LIN_SIM_RX_QUEUE_SIZE - rxTail) % LIN_SIM_RX_QUEUE_SIZE;
+}
+
+int LinBusSimulator::peek(void) {
+        if (0 == available()) {
+                return -1;
+        }
+        return rxQueue[rxTail].data;
+}
+
+int LinBusSimulator::read(void) {
+        int data = peek();
+        if (0 <= data) {
+                rxTail = (rxTail + 1) % LIN_SIM_RX_QUEUE_SIZE;
+        }
+        return data;
+}
+
+void LinBusSimulator::flush(void) {
+        while ((long)(busFreeTime - micros()) > 0) {
+                yield();
+        }
+}
@@ -0,0 +1,45 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "LinCapture.h"
+
+
+uint16_t LinCapture::beginExport(LinCaptureHeader* header, uint32_t baudrate, uint16_t maxRecords) {
+        uint16_t count = available();
+        if (count > maxRecords) {
+                count = maxRecords;
+        }
+        memcpy(header->magic, "LINC", sizeof header->magic);
+        header->version = LIN_CAPTURE_VERSION;
+        header->recordSize = sizeof(LinCaptureRecord);
+        header->count = count;
+        header->dropped = dropped;
+        header->baudrate = baudrate;
+        dropped = 0;
+        return count;
+}
+
+uint16_t LinCapture::read(LinCaptureRecord* buffer, uint16_t count) {
+        uint16_t copied = 0;
+        uint16_t current = tail;
+        while (copied < count && current != head) {
+                buffer[copied++] = records[current];
+                current = (current + 1) & (LIN_CAPTURE_SIZE - 1);
+        }
+        tail = current;
+        return copied;
+}
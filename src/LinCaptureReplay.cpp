@@ -0,0 +1,154 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#include "LinCaptureReplay.h"
+
+static const uint8_t REPLAY_BYTE_BITS = 10; // Start, 8 data, stop.
+
+
+LinCaptureReplay::LinCaptureReplay(void) {
+        clear();
+}
+
+void LinCaptureReplay::clear(void) {
+        running = false;
+        frameMask = ~0ULL & ~(1ULL << 0x3C) & ~(1ULL << 0x3D);
+        loaded = 0;
+        count = 0;
+        speed = 1;
+        position = 0;
+        checksum = -1;
+        responseDelay = 0;
+        replayed = 0;
+        silent = 0;
+}
+
+size_t LinCaptureReplay::load(const uint8_t* data, size_t length) {
+        size_t taken = 0;
+        if (sizeof header > loaded) {
+                taken = min(length, (size_t) (sizeof header - loaded));
+                memcpy((uint8_t*) &header + loaded, data, taken);
+                loaded += taken;
+        }
+        size_t offset = loaded - sizeof header;
+        if (sizeof header <= loaded && sizeof records > offset) {
+                size_t n = min(length - taken, (size_t) (sizeof records - offset));
+                memcpy((uint8_t*) records + offset, data + taken, n);
+                loaded += n;
+                taken += n;
+        }
+        return taken;
+}
+
+bool LinCaptureReplay::start(uint8_t speed) {
+        running = false;
+        if (sizeof header > loaded || 0 != memcmp(header.magic, "LINC", sizeof header.magic)
+            || LIN_CAPTURE_VERSION != header.version || sizeof(LinCaptureRecord) != header.recordSize || 0 == header.baudrate) {
+                return false;
+        }
+        count = min((uint32_t) header.count, (uint32_t) ((loaded - sizeof header) / sizeof(LinCaptureRecord)));
+        if (0 == count) {
+                return false;
+        }
+        // The replay starts with the first frame it answers.
+        origin = LIN_REPLAY_NONE;
+        for (uint16_t i = 0; i < count && LIN_REPLAY_NONE == origin; ++i) {
+                if (kLcrHeader == records[i].type && (frameMask & (1ULL << (records[i].data & 0x3f)))) {
+                        origin = i;
+                }
+        }
+        if (LIN_REPLAY_NONE == origin) {
+                return false;
+        }
+        memset(cursor, 0xff, sizeof cursor);
+        bitTime = 1000000UL / header.baudrate;
+        this->speed = max(speed, (uint8_t) 1);
+        position = 0;
+        clockRunning = false;
+        replayed = 0;
+        silent = 0;
+        running = true;
+        return true;
+}
+
+uint16_t LinCaptureReplay::findHeader(uint16_t from, uint8_t id) {
+        for (uint16_t i = from; i < count; ++i) {
+                if (kLcrHeader == records[i].type && id == (records[i].data & 0x3f)) {
+                        return i;
+                }
+        }
+        return LIN_REPLAY_NONE;
+}
+
+uint8_t LinCaptureReplay::publish(uint8_t id, uint8_t* data) {
+        if (!running || !(frameMask & (1ULL << id))) {
+                return 0;
+        }
+        unsigned long now = micros();
+        if (clockRunning) {
+                position += (uint64_t) (now - lastUpdate) * speed;
+        }
+        clockRunning = true;
+        lastUpdate = now;
+        if (position > records[count - 1].timestamp - records[origin].timestamp) {
+                running = false; // End of the recording, the other nodes take over again.
+                return 0;
+        }
+
+        // Move on to the latest frame of "id" that has been recorded up to the current position.
+        uint16_t frame = cursor[id];
+        for (uint16_t next = findHeader(LIN_REPLAY_NONE == frame ? origin : frame + 1, id);
+             LIN_REPLAY_NONE != next && position >= records[next].timestamp - records[origin].timestamp;
+             next = findHeader(next + 1, id)) {
+                frame = next;
+        }
+        if (LIN_REPLAY_NONE == frame) {
+                // Not recorded up to here yet, the own schedule polls it earlier than the recorded one did.
+                frame = findHeader(origin, id);
+                if (LIN_REPLAY_NONE == frame) {
+                        ++silent;
+                        return LIN_SIM_NO_RESPONSE;
+                }
+        } else {
+                cursor[id] = frame;
+        }
+
+        uint8_t nBytes = 0;
+        uint16_t i = frame + 1;
+        for (; i < count && kLcrByte == records[i].type && 8 > nBytes; ++i) {
+                data[nBytes++] = records[i].data;
+        }
+        if (0 == nBytes) {
+                ++silent;
+                return LIN_SIM_NO_RESPONSE;
+        }
+        bool complete = i < count && (kLcrChecksumOk == records[i].type || kLcrChecksumError == records[i].type);
+        checksum = complete ? records[i].data : -1;
+        // The first byte is recorded once it has been received completely.
+        unsigned long delay = records[frame + 1].timestamp - records[frame].timestamp;
+        responseDelay = delay > REPLAY_BYTE_BITS * bitTime ? delay - REPLAY_BYTE_BITS * bitTime : 0;
+        ++replayed;
+        return nBytes;
+}
+
+void LinCaptureReplay::subscribe(uint8_t id, const uint8_t* data, uint8_t nBytes) {
+}
+
+int16_t LinCaptureReplay::getChecksum(uint8_t checksum) {
+        return this->checksum;
+}
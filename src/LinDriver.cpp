@@ -25,6 +25,14 @@
 #include "LinDriver.h"
 #include "debug.h"
 
+#define LIN_PID_ROW(id) linProtectedId(id), linProtectedId(id + 1), linProtectedId(id + 2), linProtectedId(id + 3), \
+        linProtectedId(id + 4), linProtectedId(id + 5), linProtectedId(id + 6), linProtectedId(id + 7)
+
+const uint8_t LIN_PID_TABLE[64] = {
+        LIN_PID_ROW(0x00), LIN_PID_ROW(0x08), LIN_PID_ROW(0x10), LIN_PID_ROW(0x18),
+        LIN_PID_ROW(0x20), LIN_PID_ROW(0x28), LIN_PID_ROW(0x30), LIN_PID_ROW(0x38),
+};
+
 
 LinDriver::LinDriver(LIN_SERIAL* serial, uint8_t txePin, uint8_t rxPin, uint8_t txPin, uint32_t baudrate) {
         this->serial = serial;
@@ -33,32 +41,70 @@ LinDriver::LinDriver(LIN_SERIAL* serial, uint8_t txePin, uint8_t rxPin, uint8_t
         this->baudrate = baudrate;
         this->rxPin = rxPin;
         this->txPin = txPin;
+
+        serialOn = 0;
+        result = 0;
+        requestCallback = 0;
+        requestContext = 0;
+        loopState = kLdlsIdle;
+        capture = 0;
+        adaptiveTimeouts = false;
+        memset(responseLatency, 0, sizeof responseLatency);
+        resetFrameStats();
+
+        headerRetries = 0;
+        scheduleTable = 0;
+        scheduleCount = 0;
+        scheduleIndex = 0;
+        schedulePass = 0;
+        nextSlotTime = 0;
 }
 
 void LinDriver::begin(void) {
         serial->begin(baudrate, SERIAL_8N1, rxPin, txPin);
         serialOn  = 1;
+#ifdef LIN_HARDWARE_BREAK
+        if (serial == &Serial1) {
+                uartDev = &UART1;
+        } else if (serial == &Serial2) {
+                uartDev = &UART2;
+        } else {
+                uartDev = &UART0;
+        }
+        uartDev->idle_conf.tx_brk_num = LIN_BREAK_DURATION;
+        uartDev->conf1.rxfifo_full_thrhd = LIN_RX_FIFO_FULL;
+        uartDev->conf1.rx_tout_thrhd = LIN_RX_TIMEOUT_BYTES;
+#elif defined(LIN_SIMULATION)
+        serial->setRxFifoThresholds(LIN_RX_FIFO_FULL, LIN_RX_TIMEOUT_BYTES);
+#endif
 
         uint64_t Tbit = 100000 / baudrate; // Not quite in uSec, I'm saving an extra 10 to change a 1.4 (40%) to 14 below...
         uint64_t nominalFrameTime = ((34 * Tbit) + 90 * Tbit); // 90 = 10*max # payload bytes + checksum (9).
         timeout = LIN_TIMEOUT_IN_FRAMES * 14 * nominalFrameTime; // 14 is the specced addtl 40% space above normal*10 -- the extra 10 is just pulled out of the 1000000 needed to convert to uSec (so that there are no decimal #s).
+        headerTime = (2 * 10 + 2) * 1000000UL / baudrate; // sync + ID byte, 10 bits each, plus two bits of slack for the UART's FIFO.
+        headerMaxTime = 34 * 14 * 100000UL / baudrate;
+        monitorFrameGap = LIN_MONITOR_FRAME_GAP * 1000000UL / baudrate;
         pinMode (txePin, OUTPUT);
         digitalWrite(txePin, HIGH);
 }
 
 
 // Generate a BREAK signal (a low signal for longer than a byte) across the serial line
-void LinDriver::headerBreak(void)
+bool LinDriver::headerBreak(void)
 {
+#ifdef LIN_HARDWARE_BREAK
+        // The UART sends tx_brk_num bits of NULL by itself as soon as its TX FIFO is empty, see UART_TXD_BRK in the
+        // ESP32 TRM. So there is no need to reprogram the baud rate or to spin here, isBreakDone() polls for the end.
+        uartDev->int_clr.tx_brk_done = 1;
+        uartDev->conf0.txd_brk = 1;
+        return false;
+#elif defined(LIN_SIMULATION)
+        serial->sendBreak(); // Like the hardware BREAK.
+        return false;
+#else // It's assumed to be an ESP8266 or Arduino:
         uint64_t brkend = (1000000UL / ((uint64_t)baudrate));
         uint64_t brkbegin = brkend * LIN_BREAK_DURATION;
 
-#ifdef ESP32 // ESP32 does not support digital output on Tx pin so we're faking the signal the other way...
-        serial->updateBaudRate(baudrate / 2);
-        serial->write(LIN_HEADER_BREAK);
-        delayMicroseconds(brkbegin);
-        serial->updateBaudRate(baudrate);
-#else // It's assumed to be an ESP8266 or Arduino:
         if (serialOn) serial->end();
 
         pinMode(txPin, OUTPUT);
@@ -71,9 +117,63 @@ void LinDriver::headerBreak(void)
         if (brkend > 16383) delay(brkend / 1000); // delayMicroseconds unreliable above 16383 see arduino man pages
         else delayMicroseconds(brkend);
 
-        serial->begin(serialSpd);
+        serial->begin(baudrate);
         serialOn = 1;
+        return true;
+#endif
+}
+
+bool LinDriver::isBreakDone(void)
+{
+#ifdef LIN_HARDWARE_BREAK
+        if (!uartDev->int_raw.tx_brk_done) {
+                return false;
+        }
+#elif defined(LIN_SIMULATION)
+        if (!serial->isBreakDone()) {
+                return false;
+        }
 #endif
+        endBreak();
+        return true;
+}
+
+void LinDriver::endBreak(void)
+{
+#ifdef LIN_HARDWARE_BREAK
+        uartDev->conf0.txd_brk = 0;
+        uartDev->int_clr.tx_brk_done = 1;
+#endif
+}
+
+void LinDriver::startHeader(void)
+{
+        requestStart = micros();
+        if (headerBreak()) {
+                sendHeaderTail();
+        } else {
+                changeLoopState(kLdlsBreak);
+        }
+}
+
+// Everything after the BREAK: sync, ID and for write requests data and checksum.
+void LinDriver::sendHeaderTail(void)
+{
+        serial->write(LIN_HEADER_SYNC);
+        serial->write(requestIdByte); // ID byte
+        if (requestWrite) {
+                serial->write(txMessage, requestNBytes + 1); // data bytes and checksum
+                record(kLcrHeader, requestIdByte);
+                for (uint8_t i = 0; i < requestNBytes; ++i) {
+                        record(kLcrByte, txMessage[i]);
+                }
+                record(kLcrChecksumOk, txMessage[requestNBytes]);
+                // The UART's FIFO does the rest, the request ends once the frame is on the bus so that the next one keeps its distance.
+                requestTimeout = headerTime + (requestNBytes + 1) * 10 * 1000000UL / baudrate;
+        }
+        // No flush() here, loop() waits for headerTime to pass instead of blocking on the UART.
+        requestStart = micros();
+        changeLoopState(kLdlsHeader);
 }
 
 /* Lin defines its checksum as an inverted 8 bit sum with carry */
@@ -89,73 +189,362 @@ uint8_t LinDriver::dataChecksum(const uint8_t* message, char nBytes, uint16_t su
 /* Create the Lin ID parity */
 uint8_t LinDriver::addrParity(uint8_t addr)
 {
-        uint8_t p0 = bitExtract(addr, 0) ^ bitExtract(addr, 1) ^ bitExtract(addr, 2) ^ bitExtract(addr, 4);
-        uint8_t p1 = ~(bitExtract(addr, 1) ^ bitExtract(addr, 3) ^ bitExtract(addr, 4) ^ bitExtract(addr, 5));
-        return (p0 | (p1 << 1)) << 6;
+        return LIN_PID_TABLE[addr & 0x3f] & 0xc0;
 }
 
 /* Send a message across the Lin bus */
 void LinDriver::send(uint8_t addr, const uint8_t* message, uint8_t nBytes, uint8_t proto)
 {
-        uint8_t addrbyte = (addr & 0x3f) | addrParity(addr);
+        if (isMonitorMode()) {
+                return;
+        }
+        while (isBusy()) loop(); // Let a running request finish first.
+        if (nBytes > sizeof txMessage - 1) {
+                nBytes = sizeof txMessage - 1;
+        }
+        requestAddr = addr;
+        requestIdByte = LIN_PID_TABLE[addr & 0x3f];
+        requestNBytes = nBytes;
+        requestProto = proto;
+        requestWrite = true;
+        requestCallback = 0;
+        requestContext = 0;
+        countUp(frameStats[addr & 0x3f].requests);
+        memcpy(txMessage, message, nBytes);
         // LIN diagnostic frame shall always use CHKSUM of protocol version 1.
-        uint8_t cksum = dataChecksum(message, nBytes, (proto == 1 || addr == 0x3C) ? 0 : addrbyte);
-        headerBreak(); // Generate the low signal that exceeds 1 char.
-        serial->write(LIN_HEADER_SYNC);
-        serial->write(addrbyte); // ID byte
-        serial->write(message, nBytes); // data bytes
-        serial->write(cksum); // checksum
+        txMessage[nBytes] = dataChecksum(message, nBytes, (proto == 1 || addr == 0x3C) ? 0 : requestIdByte);
+        headerRetries = 0;
+        startHeader(); // Generate the low signal that exceeds 1 char.
 }
 
 
 uint8_t LinDriver::recv(uint8_t addr, uint8_t* message, uint8_t nBytes, uint8_t proto)
 {
-        uint8_t bytesRcvd = 0;
-        unsigned int timeoutCount = 0;
+        if (isMonitorMode()) {
+                return 0;
+        }
+        while (isBusy()) loop(); // Let a running request finish first.
+        recvAsync(addr, message, nBytes, proto);
+        while (isBusy()) loop();
+        return result;
+}
+
+bool LinDriver::recvAsync(uint8_t addr, uint8_t* message, uint8_t nBytes, uint8_t proto, LinRecvCallback callback, void* context)
+{
+        if (isBusy()) {
+                return false;
+        }
+        requestAddr = addr;
+        requestMessage = message;
+        requestNBytes = nBytes;
+        requestProto = proto;
+        requestCallback = callback;
+        requestContext = context;
+        requestWrite = false;
+        requestIdByte = LIN_PID_TABLE[addr & 0x3f];
+        bytesRcvd = 0;
+        result = 0;
+        requestTimeout = getResponseTimeout(nBytes);
+        firstByteTimeout = getFirstByteTimeout(addr, nBytes);
+        countUp(frameStats[addr & 0x3f].requests);
+        frameStats[addr & 0x3f].bytesExpected += nBytes + 1;
+
         // Empty receive buffer:
         while (0 < serial->available()) {
                 serial->read();
         }
         // Now start sending the request.
-        headerBreak(); // Generate the low signal that exceeds 1 char.
-        serial->write(LIN_HEADER_SYNC); // Sync byte
-        uint8_t idByte = (addr & 0x3f) | addrParity(addr);
-        serial->write(idByte); // ID byte
-        serial->flush();
-        digitalWrite(txePin, LOW); // don't pull up
-
-        for (uint8_t i = 0; i < nBytes; i++) {
-                // This while loop strategy does not take into account the added time for the logic.  So the actual timeout will be slightly longer then written here.
-                while (!serial->available()) {
-                        delayMicroseconds(100);
-                        timeoutCount += 100;
-                        if (timeoutCount >= timeout) goto done;
+        headerRetries = 0;
+        startHeader(); // Generate the low signal that exceeds 1 char.
+        return true;
+}
+
+void LinDriver::changeLoopState(LinDriverLoopState newState) {
+        loopState = newState;
+}
+
+void LinDriver::loop(void)
+{
+        switch (loopState) {
+        case kLdlsIdle:
+                runSchedule();
+                break;
+
+        case kLdlsBreak:
+                if (isBreakDone()) {
+                        // The delimiter lasts until loop() comes back, a late loop() would stretch the header beyond
+                        // what slaves accept. Rather send the break again.
+                        if (micros() - requestStart + headerTime <= headerMaxTime) {
+                                sendHeaderTail();
+                        } else {
+                                countUp(frameStats[requestAddr & 0x3f].headerAborts);
+                                if (LIN_HEADER_RETRIES > headerRetries++) {
+                                        startHeader();
+                                } else {
+                                        finishRequest(0);
+                                }
+                        }
+                } else if (micros() - requestStart >= timeout) {
+                        endBreak(); // Should not happen, but never lock up the bus.
+                        record(kLcrTimeout, 0);
+                        countUp(frameStats[requestAddr & 0x3f].timeouts);
+                        finishRequest(0);
                 }
-                uint8_t byte = serial->read();
-                if (!(0 == bytesRcvd && (LIN_HEADER_BREAK == byte || LIN_HEADER_SYNC == byte))) {
-                        message[i] = byte;
-                        bytesRcvd++;
+                break;
+
+        case kLdlsHeader:
+                if (micros() - requestStart < (requestWrite ? requestTimeout : headerTime)) {
+                        break;
                 }
-        }
-        while (!serial->available()) {
-                delayMicroseconds(100);
-                timeoutCount += 100;
-                if (timeoutCount >= timeout) goto done;
-        }
-        if (serial->available()) {
-                uint8_t cksum = serial->read();
-                bytesRcvd++;
-                // LIN diagnostic frame shall always use CHKSUM of protocol version 1.
-                if (proto == 1 || addr == 0x3D) {
-                        idByte = 0; // Don't cksum the ID byte in LIN 1.x
+                if (requestWrite) {
+                        finishRequest(0xff);
+                        break;
                 }
-                if (dataChecksum(message, nBytes, idByte) == cksum) {
-                        bytesRcvd = 0xff;
+                digitalWrite(txePin, LOW); // don't pull up
+                requestStart = micros(); // Response timeout starts after the header has been sent.
+                lastResponsePoll = requestStart;
+                record(kLcrHeader, requestIdByte); // Once it is on the bus, as in monitor mode, so response delays replay as recorded.
+                changeLoopState(kLdlsResponse);
+        // fall through
+
+        case kLdlsResponse: {
+                unsigned long now = micros();
+                bool exact = now - lastResponsePoll <= 10 * 1000000UL / baudrate;
+                lastResponsePoll = now;
+                while (0 < serial->available()) {
+                        uint8_t byte = serial->read();
+                        LinFrameStats* stats = &frameStats[requestAddr & 0x3f];
+                        if (bytesRcvd < requestNBytes) {
+                                if (!(0 == bytesRcvd && (LIN_HEADER_BREAK == byte || LIN_HEADER_SYNC == byte))) {
+                                        if (0 == bytesRcvd) {
+                                                learnResponseLatency(now - requestStart, exact);
+                                        }
+                                        requestMessage[bytesRcvd] = byte;
+                                        bytesRcvd++;
+                                        stats->bytesReceived++;
+                                        record(kLcrByte, byte);
+                                } else {
+                                        countUp(stats->echoBytes);
+                                }
+                        } else {
+                                bytesRcvd++;
+                                stats->bytesReceived++;
+                                // LIN diagnostic frame shall always use CHKSUM of protocol version 1.
+                                uint8_t idByte = (requestProto == 1 || requestAddr == 0x3D) ? 0 : requestIdByte; // Don't cksum the ID byte in LIN 1.x
+                                bool checksumOk = dataChecksum(requestMessage, requestNBytes, idByte) == byte;
+                                record(checksumOk ? kLcrChecksumOk : kLcrChecksumError, byte);
+                                countUp(checksumOk ? stats->responses : stats->checksumErrors);
+                                finishRequest(checksumOk ? 0xff : bytesRcvd);
+                                return;
+                        }
+                }
+                if (micros() - requestStart >= (0 == bytesRcvd ? firstByteTimeout : requestTimeout)) {
+                        if (0 == bytesRcvd && firstByteTimeout < getFirstByteTimeout(0xff, requestNBytes)) {
+                                responseLatency[requestAddr & 0x3f] = 0; // Learned latency was too tight, use the spec next time.
+                        }
+                        record(kLcrTimeout, bytesRcvd);
+                        countUp(0 == bytesRcvd ? frameStats[requestAddr & 0x3f].timeouts : frameStats[requestAddr & 0x3f].incomplete);
+                        finishRequest(bytesRcvd);
                 }
+                break;
+        }
+
+        case kLdlsMonitor:
+                monitorLoop();
+                break;
+
+        default:
+                changeLoopState(kLdlsIdle);
+                break;
         }
-done:
+}
+
+void LinDriver::finishRequest(uint8_t result)
+{
         digitalWrite(txePin, HIGH);
-        return bytesRcvd;
+        this->result = result;
+        changeLoopState(kLdlsIdle);
+        if (requestCallback) {
+                requestCallback(requestContext, requestAddr, requestMessage, result);
+        }
+}
+
+void LinDriver::setScheduleTable(const LinScheduleSlot* table, uint8_t count)
+{
+        if (0 == scheduleCount) {
+                nextSlotTime = millis();
+        }
+        schedulePass = getNextSchedulePass();
+        scheduleIndex = 0;
+        scheduleTable = table;
+        scheduleCount = table ? count : 0;
+}
+
+uint16_t LinDriver::getFrameSlotTime(uint8_t nBytes)
+{
+        // Nominal frame: 34 bits header and inter byte space plus 10 bits per data byte and checksum, 40% tolerance on top.
+        uint32_t frameTime = (14UL * (34 + 10 * (nBytes + 1)) * 100UL + baudrate - 1) / baudrate; // msec, rounded up
+        return (frameTime + LIN_SCHEDULE_TIME_BASE - 1) / LIN_SCHEDULE_TIME_BASE * LIN_SCHEDULE_TIME_BASE;
+}
+
+unsigned long LinDriver::getResponseTimeout(uint8_t nBytes)
+{
+        // Data bytes and checksum, 10 bits each, 40% tolerance on top.
+        unsigned long responseTime = 14UL * 10 * (nBytes + 1) * 100000UL / baudrate;
+        responseTime += LIN_RX_LATENCY_BYTES * 10 * 1000000UL / baudrate;
+        return responseTime < timeout ? responseTime : timeout;
+}
+
+unsigned long LinDriver::getFirstByteTimeout(uint8_t addr, uint8_t nBytes)
+{
+        // The slave may spend all of the frame's 40% tolerance before the first byte, the header's 34 bits share included.
+        unsigned long byteTime = 10 * 1000000UL / baudrate;
+        unsigned long firstByteTime = 4UL * (34 + 10 * (nBytes + 1)) * 100000UL / baudrate + byteTime;
+        firstByteTime += LIN_RX_LATENCY_BYTES * byteTime;
+
+        uint16_t latency = (addr < 64 && adaptiveTimeouts) ? responseLatency[addr] : 0;
+        if (0 != latency && latency + latency / 2 + byteTime < firstByteTime) {
+                firstByteTime = latency + latency / 2 + byteTime;
+        }
+        return firstByteTime;
+}
+
+// Feeds the latency histogram with every measurement, learns from exact ones only: fast attack, slow decay, a single late
+// response raises the learned latency at once.
+void LinDriver::learnResponseLatency(unsigned long latency, bool exact)
+{
+        uint8_t bucket = 0;
+        while (bucket < LIN_LATENCY_BUCKETS - 1 && latency >= ((unsigned long) LIN_LATENCY_BUCKET_BASE << bucket)) {
+                ++bucket;
+        }
+        countUp(frameStats[requestAddr & 0x3f].latency[bucket]);
+        if (!exact) {
+                return;
+        }
+
+        uint16_t* learned = &responseLatency[requestAddr & 0x3f];
+        if (latency > 0xffff) {
+                latency = 0xffff;
+        }
+        if (latency >= *learned) {
+                *learned = latency;
+        } else {
+                *learned -= (*learned - latency) / 8;
+        }
+}
+
+void LinDriver::runSchedule(void)
+{
+        if (0 == scheduleCount || (long)(millis() - nextSlotTime) < 0) {
+                return;
+        }
+        const LinScheduleSlot* slot = &scheduleTable[scheduleIndex];
+        for (uint8_t skipped = 0; 1 < slot->divider && slot->phase != schedulePass % slot->divider; ++skipped) {
+                if (skipped >= scheduleCount) {
+                        return; // Nothing due in this pass, go on with the next call.
+                }
+                nextScheduleSlot();
+                slot = &scheduleTable[scheduleIndex];
+        }
+        uint8_t proto = (slot->flags & Lin2Frame) ? 2 : 1;
+        if (slot->flags & LinIdleSlot) {
+                // Nothing on the bus, just let the slot time pass.
+        } else if (slot->flags & LinReadFrame) {
+                recvAsync(slot->addr, slot->message, slot->nBytes, proto, slot->callback, slot->context);
+        } else {
+                send(slot->addr, slot->message, slot->nBytes, proto);
+        }
+
+        uint16_t slotTime = slot->delay ? slot->delay : getFrameSlotTime(slot->nBytes);
+        nextSlotTime += slotTime;
+        if ((long)(millis() - nextSlotTime) > (long)slotTime) {
+                nextSlotTime = millis() + slotTime; // We fell behind by more than a slot, don't try to catch up with a burst.
+        }
+        nextScheduleSlot();
+}
+
+void LinDriver::nextScheduleSlot(void)
+{
+        if (++scheduleIndex >= scheduleCount) {
+                scheduleIndex = 0;
+                ++schedulePass;
+        }
+}
+
+void LinDriver::setMonitorMode(bool enable)
+{
+        if (enable == isMonitorMode()) {
+                return;
+        }
+        if (enable) {
+                while (isBusy()) loop(); // Let a running request finish first.
+                digitalWrite(txePin, LOW); // don't pull up
+                while (0 < serial->available()) {
+                        serial->read();
+                }
+                monitorSync = false;
+                monitorHeader = false;
+                monitorLength = 0;
+                monitorLastByte = micros();
+                changeLoopState(kLdlsMonitor);
+        } else {
+                endMonitorFrame();
+                digitalWrite(txePin, HIGH);
+                nextSlotTime = millis();
+                changeLoopState(kLdlsIdle);
+        }
+}
+
+// A frame is break, sync, protected ID and the response. The response length is not known to a listener, so the
+// frame ends when the bus has been idle for monitorFrameGap. Each byte is recorded when the next one arrives, so the
+// last one is recorded as the checksum only and captures look the same as the ones of the driver's own frames.
+void LinDriver::monitorLoop(void)
+{
+        while (0 < serial->available()) {
+                uint8_t byte = serial->read();
+                unsigned long previousByte = monitorLastByte;
+                if (micros() - monitorLastByte >= monitorFrameGap) {
+                        endMonitorFrame();
+                }
+                monitorLastByte = micros();
+                if (monitorHeader) {
+                        if (0 < monitorLength) {
+                                record(kLcrByte, monitorFrame[monitorLength - 1], previousByte);
+                        }
+                        if (sizeof monitorFrame == monitorLength) {
+                                --monitorLength; // Too long for a LIN frame, keep the latest bytes.
+                                memmove(monitorFrame, &monitorFrame[1], monitorLength);
+                        }
+                        monitorFrame[monitorLength++] = byte;
+                } else if (monitorSync && LIN_PID_TABLE[byte & 0x3f] == byte) {
+                        monitorHeader = true;
+                        monitorPid = byte;
+                        record(kLcrHeader, byte);
+                } else {
+                        monitorSync = LIN_HEADER_SYNC == byte; // Anything before the sync is the break.
+                }
+        }
+        if (micros() - monitorLastByte >= monitorFrameGap) {
+                endMonitorFrame();
+        }
+}
+
+void LinDriver::endMonitorFrame(void)
+{
+        if (monitorHeader) {
+                if (0 == monitorLength) {
+                        record(kLcrTimeout, 0); // Header without response.
+                } else {
+                        uint8_t nBytes = monitorLength - 1;
+                        uint8_t byte = monitorFrame[nBytes];
+                        // Which checksum model the slave uses is not known either, so accept classic as well as enhanced.
+                        bool checksumOk = dataChecksum(monitorFrame, nBytes, 0) == byte || dataChecksum(monitorFrame, nBytes, monitorPid) == byte;
+                        record(checksumOk ? kLcrChecksumOk : kLcrChecksumError, byte, monitorLastByte);
+                }
+        }
+        monitorSync = false;
+        monitorHeader = false;
+        monitorLength = 0;
 }
 
 void LinDriver::busSleep(void) {
@@ -0,0 +1,271 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "LinTransport.h"
+
+// Protocol control information, high nibble of the second frame byte.
+const uint8_t LIN_PCI_SF = 0x00;
+const uint8_t LIN_PCI_FF = 0x10;
+const uint8_t LIN_PCI_CF = 0x20;
+
+
+void LinTransport::setup(LinBusArbiter* linArbiter, LinRequestPriority priority) {
+        this->linArbiter = linArbiter;
+        this->priority = priority;
+}
+
+void LinTransport::changeLoopState(LinTransportLoopState newState) {
+        loopState = newState;
+        lastLoopStateChange = millis();
+}
+
+bool LinTransport::request(uint8_t nad, const uint8_t* pdu, uint16_t length, LinTransportCallback callback, void* context, bool expectResponse,
+                           uint16_t responseTimeout) {
+        if (LIN_TP_QUEUE_SIZE <= queueCount || 0 == length || LIN_TP_MAX_LENGTH < length) {
+                return false;
+        }
+        LinTransportRequest* request = &queue[(queueHead + queueCount) % LIN_TP_QUEUE_SIZE];
+        request->nad = nad;
+        memcpy(request->pdu, pdu, length);
+        request->length = length;
+        request->expectResponse = expectResponse;
+        request->responseTimeout = responseTimeout;
+        request->callback = callback;
+        request->context = context;
+        ++queueCount;
+        return true;
+}
+
+void LinTransport::cancel(void) {
+        if (linArbiter) {
+                linArbiter->cancel(this);
+        }
+        queueCount = 0;
+        changeLoopState(kLtlsIdle);
+}
+
+void LinTransport::cancel(void* context) {
+        uint8_t kept = 0;
+        for (uint8_t i = 0; i < queueCount; ++i) {
+                LinTransportRequest* request = &queue[(queueHead + i) % LIN_TP_QUEUE_SIZE];
+                if (0 == i && kLtlsIdle != loopState) {
+                        if (request->context == context) {
+                                request->callback = 0;
+                        }
+                } else if (request->context == context) {
+                        continue;
+                }
+                if (kept != i) {
+                        queue[(queueHead + kept) % LIN_TP_QUEUE_SIZE] = *request;
+                }
+                ++kept;
+        }
+        queueCount = kept;
+}
+
+bool LinTransport::isPending(void* context) {
+        for (uint8_t i = 0; i < queueCount; ++i) {
+                if (queue[(queueHead + i) % LIN_TP_QUEUE_SIZE].context == context) {
+                        return true;
+                }
+        }
+        return false;
+}
+
+void LinTransport::loop(void) {
+        unsigned long durationSinceLastStateChange = millis() - lastLoopStateChange;
+
+        switch (loopState) {
+        case kLtlsIdle:
+                if (0 < queueCount && linArbiter) {
+                        txOffset = 0;
+                        txSequence = 0;
+                        rxLength = 0;
+                        rxExpected = 0;
+                        rxSequence = 0;
+                        pendingCount = 0;
+                        changeLoopState(kLtlsSendFrame);
+                }
+                break;
+
+        case kLtlsSendFrame:
+                if (stMin <= durationSinceLastStateChange && sendNextFrame()) {
+                        changeLoopState(kLtlsFrameSent);
+                }
+                break;
+
+        case kLtlsFrameSent:
+                if (!txDone) {
+                        break;
+                }
+                if (txOffset < queue[queueHead].length) {
+                        changeLoopState(kLtlsSendFrame);
+                } else if (queue[queueHead].expectResponse) {
+                        pollDelay = p2Min;
+                        responseStart = millis();
+                        changeLoopState(kLtlsPollResponse);
+                } else {
+                        finish(kLtrOk);
+                }
+                break;
+
+        case kLtlsPollResponse:
+                if (pollDelay > durationSinceLastStateChange) {
+                        break;
+                }
+                rxDone = false;
+                if (linArbiter->read(0x3D, rxFrame, sizeof rxFrame, 1, priority, onResponseFrame, this)) {
+                        changeLoopState(kLtlsRecvFrame);
+                }
+                break;
+
+        case kLtlsRecvFrame:
+                if (rxDone) {
+                        receiveFrame();
+                }
+                break;
+
+        default:
+                changeLoopState(kLtlsIdle);
+                break;
+        }
+}
+
+bool LinTransport::sendNextFrame(void) {
+        const LinTransportRequest* request = &queue[queueHead];
+        uint16_t n;
+
+        memset(txFrame, 0xFF, sizeof txFrame);
+        txFrame[0] = request->nad;
+        if (0 == txOffset && 6 >= request->length) {
+                txFrame[1] = LIN_PCI_SF | request->length;
+                n = request->length;
+                memcpy(&txFrame[2], request->pdu, n);
+        } else if (0 == txOffset) {
+                txFrame[1] = LIN_PCI_FF | (request->length >> 8);
+                txFrame[2] = request->length & 0xFF;
+                n = 5;
+                memcpy(&txFrame[3], request->pdu, n);
+                txSequence = 1;
+        } else {
+                txFrame[1] = LIN_PCI_CF | (txSequence & 0x0F);
+                n = request->length - txOffset;
+                if (6 < n) {
+                        n = 6;
+                }
+                memcpy(&txFrame[2], &request->pdu[txOffset], n);
+        }
+        txDone = false;
+        if (!linArbiter->write(0x3C, txFrame, sizeof txFrame, 1, priority, onRequestFrame, this)) {
+                return false; // Queue full, try again with the next loop.
+        }
+        if (0 != txOffset) {
+                ++txSequence;
+        }
+        txOffset += n;
+        return true;
+}
+
+void LinTransport::onRequestFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result) {
+        static_cast<LinTransport*>(context)->txDone = true;
+}
+
+void LinTransport::onResponseFrame(void* context, uint8_t addr, uint8_t* message, uint8_t result) {
+        LinTransport* transport = static_cast<LinTransport*>(context);
+        transport->rxResult = result;
+        transport->rxDone = true;
+}
+
+void LinTransport::receiveFrame(void) {
+        const LinTransportRequest* request = &queue[queueHead];
+
+        if (0 == rxResult) { // Slave not ready yet, ask again.
+                if (request->responseTimeout <= millis() - responseStart) {
+                        finish(kLtrNoResponse);
+                } else {
+                        pollDelay = LIN_TP_POLL_INTERVAL;
+                        changeLoopState(kLtlsPollResponse);
+                }
+                return;
+        }
+        if (0xff != rxResult || (request->nad != rxFrame[0] && LIN_NAD_BROADCAST != request->nad)) {
+                finish(kLtrProtocolError);
+                return;
+        }
+
+        uint8_t pci = rxFrame[1] & 0xF0;
+        uint16_t n;
+        if (LIN_PCI_SF == pci && 0 == rxExpected) {
+                n = rxFrame[1] & 0x0F;
+                if (0 == n || 6 < n) {
+                        finish(kLtrProtocolError);
+                        return;
+                }
+                memcpy(rxBuffer, &rxFrame[2], n);
+                rxLength = rxExpected = n;
+        } else if (LIN_PCI_FF == pci && 0 == rxExpected) {
+                rxExpected = ((rxFrame[1] & 0x0F) << 8) | rxFrame[2];
+                if (6 >= rxExpected || LIN_TP_MAX_LENGTH < rxExpected) {
+                        finish(kLtrProtocolError);
+                        return;
+                }
+                memcpy(rxBuffer, &rxFrame[3], 5);
+                rxLength = 5;
+                rxSequence = 1;
+        } else if (LIN_PCI_CF == pci && 0 != rxExpected && (rxSequence & 0x0F) == (rxFrame[1] & 0x0F)) {
+                ++rxSequence;
+                n = rxExpected - rxLength;
+                if (6 < n) {
+                        n = 6;
+                }
+                memcpy(&rxBuffer[rxLength], &rxFrame[2], n);
+                rxLength += n;
+        } else {
+                finish(kLtrProtocolError);
+                return;
+        }
+
+        if (rxLength < rxExpected) { // Consecutive frames follow right away.
+                pollDelay = 0;
+                changeLoopState(kLtlsPollResponse);
+        } else if (LIN_SID_NEGATIVE_RESPONSE == rxBuffer[0] && 3 <= rxLength && LIN_NRC_RESPONSE_PENDING == rxBuffer[2]
+                   && LIN_TP_PENDING_MAX > pendingCount) { // The slave needs more time, the real response follows.
+                ++pendingCount;
+                rxLength = 0;
+                rxExpected = 0;
+                rxSequence = 0;
+                responseStart = millis();
+                pollDelay = LIN_TP_POLL_INTERVAL;
+                changeLoopState(kLtlsPollResponse);
+        } else if (LIN_SID_NEGATIVE_RESPONSE == rxBuffer[0]) {
+                finish(kLtrNegativeResponse);
+        } else if ((uint8_t) (request->pdu[0] + 0x40) != rxBuffer[0]) {
+                finish(kLtrProtocolError);
+        } else {
+                finish(kLtrOk);
+        }
+}
+
+void LinTransport::finish(LinTransportResult result) {
+        LinTransportRequest* request = &queue[queueHead];
+        queueHead = (queueHead + 1) % LIN_TP_QUEUE_SIZE;
+        --queueCount;
+        changeLoopState(kLtlsIdle);
+        if (request->callback) {
+                request->callback(request->context, request->nad, rxBuffer, rxLength, result);
+        }
+}
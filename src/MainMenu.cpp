@@ -17,12 +17,7 @@
 
 #include "MainMenu.h"
 #include "Persistence.h"
-#include "roadcruiser_xl.c"
-#include "wifiIndicator.c"
-#include "tcombi.c"
-#include "airHeater.c"
-#include "waterHeater.c"
-#include "temperature.c"
+#include "MenuImages.h"
 
 // const uint16_t batteryX = 10; // upper left X
 // static uint16_t batteryY = 25; // upper left Y
@@ -44,11 +39,11 @@ const uint16_t wifiIndiactorY = 3;
 void MainMenu::printScreenImplementation(void) {
         commonPrintScreen();
 
-        drawCompressedImage(5, 50, reinterpret_cast<const RleImage*>(&roadcruiser_xl));
-        drawCompressedImage(190, 65, reinterpret_cast<const RleImage*>(&airHeater));
-        drawCompressedImage(190, 95, reinterpret_cast<const RleImage*>(&waterHeater));
-        drawCompressedImage(172, 125, reinterpret_cast<const RleImage*>(&tcombi));
-        drawCompressedImage(115, 65, reinterpret_cast<const RleImage*>(&temperature));
+        drawImage(5, 50, &roadcruiser_xl);
+        drawImage(190, 65, &airHeater);
+        drawImage(190, 95, &waterHeater);
+        drawImage(172, 125, &tcombi);
+        drawImage(115, 65, &temperature);
 
         menuBattStat->drawBatteryIndicator(batteryX, batteryY, batteryW, batteryH, batteryPoleH, batteryPoleW);
 
@@ -71,12 +66,15 @@ void MainMenu::updateScreenImplementation(void) {
                 lastWifiOnOffConfig = Persistence::getInstance().readSlotBoolean(kPSlotWiFiOnOff);
                 lastWifiState = WiFiController::getInstance().getState();
                 if (lastWifiOnOffConfig && lastWifiState == kWclsWifiUpAndRunning) {
-                        drawCompressedImage(wifiIndiactorX, wifiIndiactorY, reinterpret_cast<const RleImage*>(&wifiIndicator));
+                        drawImage(wifiIndiactorX, wifiIndiactorY, &wifiIndicator);
                 } else {
-                        adaIli9431->fillRect(wifiIndiactorX, wifiIndiactorY, wifiIndicator.width, wifiIndicator.height, Defaults.getBgColor());   
+                        DisplayStream::getInstance().fillRect(adaIli9431, wifiIndiactorX, wifiIndiactorY, wifiIndicator.width, wifiIndicator.height,
+                                                              Defaults.getBgColor());
                 }
         }
         menuBattStat->updateBatteryIndicator(batteryX, batteryY, batteryW, batteryH);
+        menuBattStat->updateRuntimeIndicator(batteryX + batteryW / 2 - Defaults.getFontCharW() * 5 / 2,
+                                             batteryY + batteryH + Defaults.getFontY() * 2 + Defaults.getFontH());
 }
 
 void MainMenu::onEnterButtonImplementation(void) {
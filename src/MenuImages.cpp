@@ -0,0 +1,685 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+// Generated by scripts/menu_images.py from images/, do not edit.
+
+#include "MenuImages.h"
+
+static const uint16_t roadcruiser_xl_palette[] = {
+        0x0000, 0x3186, 0x528a, 0x6b6d, 0x9492, 0xad75, 0xd69a, 0xf7be,
+};
+static const uint16_t roadcruiser_xl_rows[] = {
+        0, 15, 33, 48, 80, 107, 130, 149, 170, 188, 206, 226,
+        246, 264, 282, 302, 322, 343, 361, 377, 397, 417, 437, 457,
+        477, 497, 515, 535, 556, 577, 595, 616, 636, 656, 676, 698,
+        733, 776, 822, 872, 919, 967, 1003, 1042, 1086, 1132, 1179, 1227,
+        1275, 1322, 1370, 1417, 1465, 1512, 1558, 1604, 1651, 1699, 1748, 1798,
+        1850, 1902, 1957, 2016, 2072, 2132, 2193, 2257, 2319, 2381, 2442, 2507,
+        2580, 2656, 2728, 2809, 2893, 2961, 3030, 3085, 3140, 3194, 3246, 3295,
+        3347, 3393, 3447, 3492, 3534, 3576, 3629, 3686, 3741, 3789, 3837, 3895,
+        3960, 4027, 4088, 4164, 4254, 4330, 4405, 4478, 4549, 4620, 4686, 4747,
+        4815, 4888, 4958, 5022, 5097, 5176, 5253, 5320, 5388, 5459, 5534, 5597,
+        5657, 5714, 5773, 5814, 5852, 5882, 5901, 5920, 5935, 5954, 5974, 5993,
+        6014, 6037, 6063,
+};
+static const uint8_t roadcruiser_xl_data[] = {
+        0xef, 0x01, 0x00, 0x02, 0x01, 0x01, 0x02, 0xf1, 0x02, 0x04, 0x01, 0x00, 0x01, 0x8e, 0x00, 0xea,
+        0x01, 0x00, 0x04, 0x01, 0x04, 0x05, 0x06, 0x06, 0xf6, 0x02, 0x07, 0x02, 0x06, 0x05, 0x01, 0x8b,
+        0x00, 0xe6, 0x01, 0x00, 0x03, 0x01, 0x04, 0x06, 0x06, 0xfe, 0x02, 0x07, 0x00, 0x03, 0x8a, 0x00,
+        0xe4, 0x01, 0x00, 0x01, 0x02, 0x05, 0x89, 0x07, 0x01, 0x05, 0x04, 0x82, 0x03, 0x00, 0x04, 0x8e,
+        0x03, 0x00, 0x04, 0xd2, 0x01, 0x03, 0xbd, 0x05, 0x00, 0x06, 0x91, 0x07, 0x00, 0x03, 0x89, 0x00,
+        0xe2, 0x01, 0x00, 0x01, 0x02, 0x06, 0x87, 0x07, 0x02, 0x06, 0x05, 0x02, 0xed, 0x02, 0x00, 0x00,
+        0x01, 0x82, 0x03, 0x82, 0x05, 0x85, 0x07, 0x00, 0x06, 0x89, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x05,
+        0x87, 0x07, 0x01, 0x06, 0x04, 0xf8, 0x02, 0x00, 0x02, 0x02, 0x03, 0x05, 0x82, 0x07, 0x00, 0x04,
+        0x88, 0x00, 0xdf, 0x01, 0x00, 0x01, 0x01, 0x06, 0x87, 0x07, 0x00, 0x04, 0xfd, 0x02, 0x00, 0x00,
+        0x05, 0x82, 0x07, 0x88, 0x00, 0xde, 0x01, 0x00, 0x00, 0x03, 0x87, 0x07, 0x01, 0x06, 0x02, 0xfe,
+        0x02, 0x00, 0x00, 0x02, 0x82, 0x07, 0x00, 0x03, 0x87, 0x00, 0xdd, 0x01, 0x00, 0x00, 0x03, 0x87,
+        0x07, 0x00, 0x04, 0xc1, 0x03, 0x00, 0x82, 0x07, 0x00, 0x05, 0x87, 0x00, 0xdc, 0x01, 0x00, 0x00,
+        0x05, 0x87, 0x07, 0x00, 0x04, 0xc2, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x87, 0x00, 0xdb, 0x01,
+        0x00, 0x00, 0x05, 0x87, 0x07, 0x00, 0x04, 0xc3, 0x03, 0x00, 0x00, 0x04, 0x82, 0x07, 0x00, 0x03,
+        0x86, 0x00, 0xda, 0x01, 0x00, 0x00, 0x05, 0x87, 0x07, 0x00, 0x04, 0xc4, 0x03, 0x00, 0x00, 0x02,
+        0x82, 0x07, 0x00, 0x04, 0x86, 0x00, 0xd9, 0x01, 0x00, 0x00, 0x05, 0x87, 0x07, 0x00, 0x04, 0xc6,
+        0x03, 0x00, 0x82, 0x07, 0x00, 0x06, 0x86, 0x00, 0xd8, 0x01, 0x00, 0x00, 0x06, 0x87, 0x07, 0x00,
+        0x04, 0xc7, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x86, 0x00, 0xd7, 0x01, 0x00, 0x00, 0x06, 0x87,
+        0x07, 0x00, 0x04, 0xc8, 0x03, 0x00, 0x00, 0x05, 0x82, 0x07, 0x00, 0x02, 0x85, 0x00, 0xd6, 0x01,
+        0x00, 0x00, 0x05, 0x87, 0x07, 0x00, 0x04, 0xc9, 0x03, 0x00, 0x00, 0x04, 0x82, 0x07, 0x00, 0x03,
+        0x85, 0x00, 0xd4, 0x01, 0x00, 0x01, 0x01, 0x05, 0x87, 0x07, 0x00, 0x04, 0xca, 0x03, 0x00, 0x00,
+        0x04, 0x82, 0x07, 0x00, 0x05, 0x85, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x05, 0x87, 0x07, 0x00, 0x04,
+        0xcc, 0x03, 0x00, 0x82, 0x07, 0x00, 0x05, 0x85, 0x00, 0xd3, 0x01, 0x00, 0x00, 0x05, 0x87, 0x07,
+        0x00, 0x04, 0xcd, 0x03, 0x00, 0x83, 0x07, 0x85, 0x00, 0xd2, 0x01, 0x00, 0x00, 0x04, 0x87, 0x07,
+        0x00, 0x04, 0xce, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x01, 0x84, 0x00, 0xd1, 0x01, 0x00,
+        0x00, 0x04, 0x87, 0x07, 0x00, 0x04, 0xcf, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x03, 0x84,
+        0x00, 0xd0, 0x01, 0x00, 0x00, 0x04, 0x87, 0x07, 0x00, 0x05, 0xd0, 0x03, 0x00, 0x00, 0x05, 0x82,
+        0x07, 0x00, 0x03, 0x84, 0x00, 0xcf, 0x01, 0x00, 0x00, 0x04, 0x87, 0x07, 0x00, 0x05, 0xd1, 0x03,
+        0x00, 0x00, 0x04, 0x82, 0x07, 0x00, 0x05, 0x84, 0x00, 0xce, 0x01, 0x00, 0x00, 0x02, 0x87, 0x07,
+        0x00, 0x06, 0xd2, 0x03, 0x00, 0x00, 0x04, 0x82, 0x07, 0x00, 0x05, 0x84, 0x00, 0xcd, 0x01, 0x00,
+        0x00, 0x02, 0x87, 0x07, 0x00, 0x06, 0xd3, 0x03, 0x00, 0x00, 0x01, 0x82, 0x07, 0x00, 0x06, 0x84,
+        0x00, 0xcc, 0x01, 0x00, 0x00, 0x02, 0x87, 0x07, 0x00, 0x06, 0xd4, 0x03, 0x00, 0x00, 0x01, 0x83,
+        0x07, 0x84, 0x00, 0xcb, 0x01, 0x00, 0x00, 0x02, 0x87, 0x07, 0x00, 0x06, 0xd5, 0x03, 0x00, 0x00,
+        0x01, 0x83, 0x07, 0x00, 0x01, 0x83, 0x00, 0xcb, 0x01, 0x00, 0x00, 0x06, 0x86, 0x07, 0x01, 0x06,
+        0x01, 0xd6, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x03, 0x83, 0x00, 0xca, 0x01, 0x00, 0x00,
+        0x06, 0x86, 0x07, 0x01, 0x06, 0x01, 0xd7, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x03, 0x83,
+        0x00, 0xc9, 0x01, 0x00, 0x00, 0x06, 0x87, 0x07, 0xd9, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00,
+        0x05, 0x83, 0x00, 0xc7, 0x01, 0x00, 0x01, 0x01, 0x05, 0x87, 0x07, 0x00, 0x02, 0xd9, 0x03, 0x00,
+        0x00, 0x05, 0x82, 0x07, 0x00, 0x05, 0x83, 0x00, 0xc7, 0x01, 0x00, 0x00, 0x04, 0x87, 0x07, 0x00,
+        0x03, 0xda, 0x03, 0x00, 0x00, 0x05, 0x82, 0x07, 0x00, 0x05, 0x83, 0x00, 0xc6, 0x01, 0x00, 0x00,
+        0x04, 0x87, 0x07, 0x00, 0x03, 0xdb, 0x03, 0x00, 0x00, 0x05, 0x82, 0x07, 0x00, 0x06, 0x83, 0x00,
+        0xc5, 0x01, 0x00, 0x00, 0x04, 0x87, 0x07, 0x00, 0x03, 0xdc, 0x03, 0x00, 0x00, 0x05, 0x82, 0x07,
+        0x00, 0x06, 0x83, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x03, 0x87, 0x07, 0x00, 0x04, 0x93, 0x00, 0x85,
+        0x01, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83, 0x07, 0x83, 0x00, 0xc3, 0x01, 0x00, 0x01, 0x03, 0x06,
+        0x86, 0x07, 0x00, 0x04, 0x86, 0x00, 0x02, 0x01, 0x01, 0x04, 0x85, 0x05, 0x84, 0x06, 0x85, 0x07,
+        0x00, 0x05, 0xc2, 0x03, 0x00, 0x00, 0x01, 0x83, 0x07, 0x00, 0x02, 0x82, 0x00, 0xc2, 0x01, 0x00,
+        0x03, 0x05, 0x07, 0x06, 0x06, 0x84, 0x07, 0x05, 0x05, 0x00, 0x01, 0x02, 0x02, 0x03, 0x82, 0x06,
+        0x82, 0x07, 0x85, 0x06, 0x00, 0x05, 0x84, 0x04, 0x83, 0x00, 0x01, 0x05, 0x05, 0xc2, 0x03, 0x00,
+        0x00, 0x01, 0x83, 0x07, 0x00, 0x02, 0x82, 0x00, 0xc1, 0x01, 0x00, 0x05, 0x05, 0x07, 0x07, 0x04,
+        0x01, 0x05, 0x82, 0x07, 0x02, 0x05, 0x00, 0x05, 0x84, 0x07, 0x06, 0x05, 0x04, 0x06, 0x06, 0x05,
+        0x05, 0x06, 0x89, 0x07, 0x05, 0x06, 0x03, 0x00, 0x00, 0x05, 0x05, 0xc2, 0x03, 0x00, 0x00, 0x01,
+        0x83, 0x07, 0x00, 0x02, 0x82, 0x00, 0xc0, 0x01, 0x00, 0x03, 0x05, 0x07, 0x06, 0x06, 0x84, 0x07,
+        0x01, 0x05, 0x05, 0x82, 0x07, 0x01, 0x05, 0x06, 0x84, 0x07, 0x00, 0x06, 0x82, 0x05, 0x00, 0x03,
+        0x84, 0x02, 0x09, 0x05, 0x04, 0x05, 0x05, 0x06, 0x07, 0x03, 0x00, 0x05, 0x05, 0xc2, 0x03, 0x00,
+        0x00, 0x01, 0x83, 0x07, 0x00, 0x04, 0x82, 0x00, 0xbe, 0x00, 0x06, 0x02, 0x06, 0x07, 0x04, 0x00,
+        0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x84, 0x07, 0x04, 0x06, 0x05, 0x04, 0x04, 0x03, 0x83, 0x05,
+        0x87, 0x07, 0x00, 0x06, 0x82, 0x07, 0x82, 0x06, 0x02, 0x00, 0x05, 0x05, 0xc2, 0x03, 0x00, 0x00,
+        0x01, 0x83, 0x07, 0x00, 0x05, 0x82, 0x00, 0xbd, 0x00, 0x06, 0x02, 0x07, 0x07, 0x04, 0x00, 0x01,
+        0x06, 0x87, 0x07, 0x08, 0x06, 0x04, 0x02, 0x00, 0x06, 0x07, 0x07, 0x06, 0x06, 0x82, 0x05, 0x01,
+        0x03, 0x02, 0x87, 0x00, 0x06, 0x03, 0x07, 0x05, 0x07, 0x00, 0x05, 0x05, 0xc2, 0x03, 0x00, 0x00,
+        0x01, 0x83, 0x07, 0x00, 0x05, 0x82, 0x00, 0xbc, 0x00, 0x06, 0x02, 0x07, 0x07, 0x01, 0x00, 0x01,
+        0x06, 0x8b, 0x07, 0x02, 0x03, 0x07, 0x01, 0x90, 0x00, 0x05, 0x07, 0x05, 0x07, 0x00, 0x05, 0x05,
+        0xc3, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x05, 0x82, 0x00, 0xbb, 0x00, 0x06, 0x04, 0x07,
+        0x06, 0x02, 0x00, 0x02, 0x06, 0x88, 0x07, 0x05, 0x05, 0x02, 0x02, 0x07, 0x04, 0x06, 0x91, 0x00,
+        0x05, 0x07, 0x05, 0x07, 0x00, 0x05, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x05,
+        0x82, 0x00, 0xba, 0x00, 0x05, 0x04, 0x07, 0x06, 0x01, 0x00, 0x03, 0x83, 0x07, 0x01, 0x06, 0x06,
+        0x83, 0x07, 0x00, 0x04, 0x82, 0x00, 0x02, 0x07, 0x05, 0x06, 0x91, 0x00, 0x05, 0x07, 0x05, 0x06,
+        0x00, 0x05, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x82, 0x00, 0xb9, 0x00,
+        0x05, 0x04, 0x07, 0x06, 0x00, 0x00, 0x03, 0x83, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x07, 0x07,
+        0x03, 0x82, 0x00, 0x03, 0x04, 0x07, 0x06, 0x05, 0x91, 0x00, 0x05, 0x07, 0x04, 0x06, 0x00, 0x05,
+        0x05, 0xc3, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x82, 0x00, 0xb8, 0x00, 0x05, 0x06,
+        0x07, 0x05, 0x00, 0x00, 0x03, 0x83, 0x07, 0x06, 0x06, 0x06, 0x07, 0x05, 0x07, 0x07, 0x01, 0x83,
+        0x00, 0x03, 0x05, 0x06, 0x06, 0x04, 0x90, 0x00, 0x06, 0x03, 0x07, 0x04, 0x06, 0x00, 0x05, 0x05,
+        0xc3, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x82, 0x00, 0xb6, 0x00, 0x06, 0x02, 0x07,
+        0x07, 0x04, 0x00, 0x00, 0x04, 0x83, 0x07, 0x06, 0x06, 0x06, 0x07, 0x05, 0x07, 0x07, 0x02, 0x84,
+        0x00, 0x03, 0x06, 0x05, 0x07, 0x04, 0x90, 0x00, 0x06, 0x04, 0x06, 0x05, 0x06, 0x00, 0x05, 0x05,
+        0xc3, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x82, 0x00, 0xb5, 0x00, 0x06, 0x02, 0x07,
+        0x06, 0x02, 0x00, 0x00, 0x05, 0x83, 0x07, 0x06, 0x05, 0x07, 0x07, 0x04, 0x07, 0x06, 0x02, 0x85,
+        0x00, 0x03, 0x07, 0x04, 0x07, 0x04, 0x90, 0x00, 0x06, 0x04, 0x06, 0x06, 0x05, 0x00, 0x05, 0x05,
+        0xc3, 0x03, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x82, 0x00, 0xb4, 0x00, 0x02, 0x04, 0x07,
+        0x07, 0x82, 0x00, 0x00, 0x05, 0x83, 0x07, 0x05, 0x06, 0x07, 0x06, 0x06, 0x07, 0x06, 0x86, 0x00,
+        0x03, 0x03, 0x07, 0x04, 0x07, 0x91, 0x00, 0x06, 0x04, 0x06, 0x06, 0x04, 0x00, 0x05, 0x05, 0xc3,
+        0x03, 0x00, 0x00, 0x05, 0x82, 0x07, 0x00, 0x06, 0x82, 0x00, 0xb3, 0x00, 0x06, 0x04, 0x07, 0x06,
+        0x02, 0x00, 0x00, 0x05, 0x83, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x07, 0x04, 0x02, 0x86, 0x00,
+        0x03, 0x04, 0x06, 0x05, 0x07, 0x91, 0x00, 0x06, 0x05, 0x06, 0x06, 0x04, 0x00, 0x05, 0x05, 0xc3,
+        0x03, 0x00, 0x00, 0x05, 0x83, 0x07, 0x02, 0x02, 0x00, 0x00, 0xb2, 0x00, 0x06, 0x04, 0x07, 0x06,
+        0x01, 0x00, 0x01, 0x06, 0x83, 0x07, 0x05, 0x06, 0x07, 0x06, 0x06, 0x07, 0x04, 0x88, 0x00, 0x03,
+        0x04, 0x06, 0x06, 0x05, 0x91, 0x00, 0x06, 0x06, 0x05, 0x07, 0x03, 0x00, 0x05, 0x05, 0xc3, 0x03,
+        0x00, 0x00, 0x05, 0x83, 0x07, 0x02, 0x02, 0x00, 0x00, 0xb1, 0x00, 0x06, 0x04, 0x07, 0x06, 0x01,
+        0x00, 0x01, 0x06, 0x83, 0x07, 0x06, 0x06, 0x07, 0x05, 0x06, 0x07, 0x02, 0x02, 0x88, 0x00, 0x03,
+        0x06, 0x06, 0x07, 0x04, 0x91, 0x00, 0x06, 0x06, 0x06, 0x07, 0x00, 0x00, 0x05, 0x05, 0xc3, 0x03,
+        0x00, 0x00, 0x05, 0x83, 0x07, 0x02, 0x02, 0x00, 0x00, 0xb0, 0x00, 0x06, 0x04, 0x07, 0x06, 0x01,
+        0x00, 0x01, 0x06, 0x83, 0x07, 0x05, 0x06, 0x07, 0x06, 0x07, 0x07, 0x03, 0x8a, 0x00, 0x03, 0x07,
+        0x04, 0x07, 0x01, 0x91, 0x00, 0x06, 0x07, 0x06, 0x06, 0x00, 0x00, 0x05, 0x05, 0xc3, 0x03, 0x00,
+        0x00, 0x05, 0x83, 0x07, 0x02, 0x02, 0x00, 0x00, 0xaf, 0x00, 0x06, 0x05, 0x07, 0x06, 0x01, 0x00,
+        0x03, 0x06, 0x83, 0x07, 0x05, 0x05, 0x07, 0x05, 0x06, 0x07, 0x02, 0x8b, 0x00, 0x02, 0x07, 0x04,
+        0x07, 0x92, 0x00, 0x06, 0x07, 0x05, 0x06, 0x00, 0x00, 0x05, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x05,
+        0x83, 0x07, 0x02, 0x03, 0x00, 0x00, 0xae, 0x00, 0x05, 0x05, 0x07, 0x05, 0x01, 0x00, 0x03, 0x84,
+        0x07, 0x05, 0x05, 0x07, 0x05, 0x06, 0x07, 0x03, 0x8b, 0x00, 0x03, 0x01, 0x07, 0x05, 0x06, 0x92,
+        0x00, 0x06, 0x07, 0x06, 0x05, 0x00, 0x00, 0x05, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83, 0x07,
+        0x02, 0x05, 0x00, 0x00, 0xad, 0x00, 0x05, 0x06, 0x07, 0x05, 0x00, 0x00, 0x03, 0x84, 0x07, 0x05,
+        0x05, 0x07, 0x06, 0x03, 0x07, 0x04, 0x8c, 0x00, 0x03, 0x03, 0x07, 0x06, 0x05, 0x91, 0x00, 0x07,
+        0x04, 0x06, 0x07, 0x04, 0x00, 0x00, 0x05, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83, 0x07, 0x02,
+        0x05, 0x00, 0x00, 0xab, 0x00, 0x06, 0x01, 0x06, 0x07, 0x04, 0x00, 0x00, 0x04, 0x84, 0x07, 0x05,
+        0x06, 0x07, 0x07, 0x01, 0x04, 0x07, 0x8d, 0x00, 0x03, 0x03, 0x06, 0x07, 0x04, 0x91, 0x00, 0x07,
+        0x04, 0x06, 0x07, 0x02, 0x00, 0x00, 0x05, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83, 0x07, 0x02,
+        0x05, 0x00, 0x00, 0xaa, 0x00, 0x06, 0x03, 0x06, 0x07, 0x03, 0x00, 0x00, 0x04, 0x84, 0x07, 0x06,
+        0x03, 0x00, 0x04, 0x07, 0x06, 0x04, 0x06, 0x8d, 0x00, 0x03, 0x05, 0x06, 0x07, 0x04, 0x91, 0x00,
+        0x02, 0x05, 0x06, 0x07, 0x82, 0x00, 0x01, 0x05, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83, 0x07,
+        0x02, 0x05, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x02, 0x07, 0x06, 0x03, 0x00, 0x00, 0x04, 0x84, 0x07,
+        0x00, 0x02, 0x82, 0x00, 0x03, 0x04, 0x07, 0x04, 0x06, 0x8d, 0x00, 0x03, 0x07, 0x06, 0x07, 0x02,
+        0x91, 0x00, 0x02, 0x07, 0x05, 0x07, 0x82, 0x00, 0x01, 0x06, 0x05, 0xc3, 0x03, 0x00, 0x00, 0x05,
+        0x83, 0x07, 0x02, 0x05, 0x00, 0x00, 0xa8, 0x00, 0x06, 0x02, 0x06, 0x07, 0x01, 0x00, 0x00, 0x04,
+        0x83, 0x07, 0x03, 0x06, 0x07, 0x04, 0x01, 0x82, 0x00, 0x02, 0x07, 0x06, 0x06, 0x8d, 0x00, 0x03,
+        0x07, 0x04, 0x07, 0x01, 0x91, 0x00, 0x02, 0x07, 0x04, 0x07, 0x82, 0x00, 0x01, 0x07, 0x04, 0xc3,
+        0x03, 0x00, 0x00, 0x05, 0x83, 0x07, 0x02, 0x06, 0x00, 0x00, 0xa7, 0x00, 0x06, 0x04, 0x07, 0x06,
+        0x02, 0x00, 0x00, 0x06, 0x83, 0x07, 0x04, 0x05, 0x05, 0x07, 0x07, 0x06, 0x82, 0x00, 0x82, 0x06,
+        0x8c, 0x00, 0x03, 0x03, 0x07, 0x06, 0x06, 0x91, 0x00, 0x03, 0x04, 0x07, 0x06, 0x06, 0x82, 0x00,
+        0x01, 0x07, 0x03, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83, 0x07, 0x02, 0x06, 0x00, 0x00, 0xa6, 0x00,
+        0x06, 0x05, 0x07, 0x06, 0x01, 0x00, 0x00, 0x06, 0x83, 0x07, 0x05, 0x05, 0x04, 0x07, 0x06, 0x05,
+        0x07, 0x82, 0x05, 0x02, 0x07, 0x06, 0x06, 0x8c, 0x00, 0x03, 0x05, 0x06, 0x06, 0x05, 0x91, 0x00,
+        0x03, 0x06, 0x05, 0x06, 0x05, 0x82, 0x00, 0x01, 0x07, 0x03, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83,
+        0x07, 0x02, 0x06, 0x00, 0x00, 0xa3, 0x00, 0x08, 0x03, 0x05, 0x06, 0x07, 0x05, 0x00, 0x00, 0x02,
+        0x06, 0x83, 0x07, 0x02, 0x05, 0x04, 0x07, 0x82, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x04,
+        0x06, 0x8c, 0x00, 0x03, 0x06, 0x06, 0x07, 0x03, 0x90, 0x00, 0x04, 0x03, 0x07, 0x04, 0x07, 0x03,
+        0x82, 0x00, 0x01, 0x07, 0x03, 0xc3, 0x03, 0x00, 0x00, 0x05, 0x83, 0x07, 0x02, 0x06, 0x00, 0x00,
+        0xa2, 0x00, 0x00, 0x03, 0x82, 0x07, 0x03, 0x04, 0x00, 0x00, 0x02, 0x84, 0x07, 0x0d, 0x05, 0x02,
+        0x07, 0x07, 0x06, 0x05, 0x06, 0x07, 0x03, 0x00, 0x00, 0x07, 0x05, 0x06, 0x8c, 0x00, 0x03, 0x07,
+        0x04, 0x07, 0x01, 0x90, 0x00, 0x83, 0x06, 0x82, 0x00, 0x02, 0x02, 0x07, 0x02, 0xc3, 0x03, 0x00,
+        0x00, 0x05, 0x83, 0x07, 0x02, 0x06, 0x00, 0x00, 0xa1, 0x00, 0x07, 0x04, 0x07, 0x06, 0x04, 0x07,
+        0x00, 0x00, 0x02, 0x84, 0x07, 0x01, 0x05, 0x02, 0x82, 0x07, 0x09, 0x06, 0x05, 0x06, 0x07, 0x02,
+        0x00, 0x00, 0x07, 0x05, 0x06, 0x8b, 0x00, 0x03, 0x02, 0x07, 0x04, 0x06, 0x90, 0x00, 0x04, 0x01,
+        0x07, 0x04, 0x07, 0x05, 0x82, 0x00, 0x01, 0x02, 0x07, 0xc4, 0x03, 0x00, 0x00, 0x02, 0x83, 0x07,
+        0x02, 0x06, 0x00, 0x00, 0x9f, 0x00, 0x08, 0x01, 0x05, 0x07, 0x07, 0x01, 0x06, 0x06, 0x00, 0x02,
+        0x84, 0x07, 0x0f, 0x05, 0x00, 0x06, 0x07, 0x06, 0x07, 0x05, 0x05, 0x06, 0x07, 0x02, 0x00, 0x00,
+        0x07, 0x05, 0x06, 0x8b, 0x00, 0x03, 0x03, 0x07, 0x06, 0x06, 0x90, 0x00, 0x04, 0x06, 0x07, 0x05,
+        0x07, 0x01, 0x82, 0x00, 0x01, 0x02, 0x07, 0xc4, 0x03, 0x00, 0x00, 0x02, 0x84, 0x07, 0x01, 0x04,
+        0x00, 0x9e, 0x00, 0x08, 0x01, 0x06, 0x07, 0x06, 0x07, 0x05, 0x07, 0x06, 0x06, 0x84, 0x07, 0x10,
+        0x05, 0x00, 0x05, 0x07, 0x05, 0x07, 0x07, 0x06, 0x05, 0x06, 0x07, 0x02, 0x00, 0x00, 0x07, 0x05,
+        0x06, 0x8b, 0x00, 0x03, 0x04, 0x07, 0x06, 0x05, 0x8f, 0x00, 0x04, 0x05, 0x07, 0x04, 0x06, 0x06,
+        0x83, 0x00, 0x01, 0x02, 0x07, 0xc4, 0x03, 0x00, 0x07, 0x02, 0x07, 0x07, 0x06, 0x01, 0x06, 0x06,
+        0x00, 0x9e, 0x00, 0x04, 0x05, 0x07, 0x03, 0x05, 0x06, 0x87, 0x07, 0x04, 0x05, 0x00, 0x04, 0x07,
+        0x06, 0x82, 0x07, 0x09, 0x05, 0x05, 0x06, 0x07, 0x02, 0x00, 0x00, 0x07, 0x06, 0x06, 0x8b, 0x00,
+        0x03, 0x05, 0x07, 0x07, 0x04, 0x8e, 0x00, 0x05, 0x04, 0x07, 0x05, 0x04, 0x07, 0x04, 0x83, 0x00,
+        0x01, 0x02, 0x07, 0xc4, 0x03, 0x00, 0x07, 0x02, 0x07, 0x06, 0x01, 0x00, 0x04, 0x06, 0x00, 0x9c,
+        0x00, 0x04, 0x01, 0x04, 0x07, 0x07, 0x06, 0x88, 0x07, 0x04, 0x06, 0x03, 0x04, 0x07, 0x06, 0x82,
+        0x07, 0x0a, 0x04, 0x06, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x06, 0x8b, 0x00, 0x02,
+        0x07, 0x05, 0x06, 0x8e, 0x00, 0x05, 0x05, 0x07, 0x05, 0x01, 0x07, 0x06, 0x84, 0x00, 0x01, 0x02,
+        0x07, 0xc4, 0x03, 0x00, 0x07, 0x02, 0x07, 0x01, 0x00, 0x00, 0x04, 0x06, 0x00, 0x98, 0x00, 0x03,
+        0x01, 0x04, 0x05, 0x06, 0x8c, 0x07, 0x0c, 0x05, 0x00, 0x03, 0x07, 0x06, 0x06, 0x07, 0x07, 0x04,
+        0x00, 0x06, 0x07, 0x03, 0x85, 0x07, 0x00, 0x06, 0x8a, 0x00, 0x03, 0x02, 0x07, 0x04, 0x06, 0x8c,
+        0x00, 0x06, 0x03, 0x06, 0x07, 0x05, 0x00, 0x06, 0x07, 0x85, 0x00, 0x01, 0x02, 0x07, 0xc4, 0x03,
+        0x00, 0x01, 0x05, 0x05, 0x82, 0x00, 0x02, 0x04, 0x06, 0x00, 0x96, 0x00, 0x01, 0x03, 0x06, 0x8f,
+        0x07, 0x0e, 0x05, 0x00, 0x00, 0x05, 0x07, 0x05, 0x07, 0x07, 0x05, 0x00, 0x00, 0x05, 0x06, 0x05,
+        0x07, 0x83, 0x04, 0x01, 0x07, 0x06, 0x8a, 0x00, 0x03, 0x02, 0x07, 0x04, 0x06, 0x8a, 0x00, 0x08,
+        0x02, 0x05, 0x07, 0x06, 0x02, 0x00, 0x05, 0x07, 0x04, 0x85, 0x00, 0x01, 0x02, 0x07, 0xc3, 0x03,
+        0x00, 0x02, 0x04, 0x07, 0x05, 0x82, 0x00, 0x02, 0x04, 0x06, 0x00, 0x94, 0x00, 0x01, 0x04, 0x06,
+        0x90, 0x07, 0x00, 0x05, 0x82, 0x00, 0x07, 0x07, 0x05, 0x03, 0x06, 0x06, 0x07, 0x05, 0x05, 0x82,
+        0x07, 0x00, 0x04, 0x83, 0x00, 0x02, 0x06, 0x07, 0x03, 0x89, 0x00, 0x03, 0x03, 0x07, 0x06, 0x06,
+        0x86, 0x00, 0x0b, 0x02, 0x02, 0x04, 0x06, 0x07, 0x07, 0x05, 0x01, 0x02, 0x06, 0x07, 0x03, 0x83,
+        0x02, 0x04, 0x01, 0x00, 0x00, 0x04, 0x07, 0xc3, 0x03, 0x00, 0x02, 0x06, 0x07, 0x05, 0x82, 0x00,
+        0x02, 0x04, 0x06, 0x00, 0x91, 0x00, 0x01, 0x02, 0x05, 0x92, 0x07, 0x00, 0x05, 0x82, 0x00, 0x05,
+        0x03, 0x07, 0x02, 0x03, 0x07, 0x03, 0x82, 0x05, 0x01, 0x06, 0x06, 0x85, 0x00, 0x82, 0x07, 0x00,
+        0x03, 0x88, 0x00, 0x06, 0x05, 0x06, 0x07, 0x03, 0x00, 0x00, 0x03, 0x82, 0x05, 0x00, 0x06, 0x82,
+        0x07, 0x07, 0x06, 0x03, 0x00, 0x02, 0x05, 0x07, 0x05, 0x02, 0x84, 0x07, 0x04, 0x06, 0x01, 0x00,
+        0x05, 0x06, 0xc2, 0x03, 0x00, 0x03, 0x03, 0x07, 0x06, 0x05, 0x82, 0x00, 0x02, 0x04, 0x06, 0x00,
+        0x8e, 0x00, 0x02, 0x01, 0x04, 0x06, 0x93, 0x07, 0x00, 0x05, 0x83, 0x00, 0x03, 0x05, 0x06, 0x00,
+        0x02, 0x86, 0x07, 0x00, 0x05, 0x83, 0x00, 0x03, 0x04, 0x07, 0x03, 0x06, 0x8a, 0x07, 0x00, 0x05,
+        0x85, 0x07, 0x82, 0x05, 0x14, 0x03, 0x00, 0x02, 0x03, 0x05, 0x06, 0x07, 0x06, 0x03, 0x00, 0x06,
+        0x07, 0x06, 0x05, 0x06, 0x06, 0x07, 0x06, 0x00, 0x05, 0x05, 0xc2, 0x03, 0x00, 0x09, 0x04, 0x06,
+        0x05, 0x06, 0x02, 0x00, 0x00, 0x04, 0x06, 0x00, 0x8d, 0x00, 0x01, 0x02, 0x06, 0x8a, 0x07, 0x83,
+        0x06, 0x85, 0x07, 0x00, 0x05, 0x84, 0x00, 0x04, 0x05, 0x07, 0x01, 0x00, 0x01, 0x83, 0x02, 0x0a,
+        0x06, 0x06, 0x07, 0x07, 0x05, 0x03, 0x06, 0x07, 0x05, 0x00, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x84,
+        0x02, 0x04, 0x00, 0x03, 0x03, 0x04, 0x05, 0x82, 0x07, 0x10, 0x06, 0x04, 0x02, 0x00, 0x00, 0x01,
+        0x07, 0x06, 0x07, 0x05, 0x06, 0x07, 0x06, 0x06, 0x00, 0x05, 0x05, 0xc2, 0x03, 0x00, 0x09, 0x04,
+        0x06, 0x05, 0x07, 0x07, 0x03, 0x00, 0x04, 0x06, 0x00, 0x8c, 0x00, 0x00, 0x03, 0x88, 0x07, 0x08,
+        0x06, 0x05, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x05, 0x83, 0x07, 0x00, 0x05, 0x85, 0x00, 0x02,
+        0x02, 0x07, 0x05, 0x85, 0x00, 0x03, 0x05, 0x05, 0x02, 0x05, 0x82, 0x06, 0x00, 0x04, 0x82, 0x00,
+        0x00, 0x03, 0x87, 0x04, 0x00, 0x05, 0x83, 0x06, 0x00, 0x05, 0x84, 0x07, 0x03, 0x06, 0x05, 0x04,
+        0x02, 0x85, 0x00, 0x04, 0x02, 0x07, 0x07, 0x06, 0x05, 0x82, 0x06, 0x03, 0x07, 0x00, 0x06, 0x04,
+        0xc2, 0x03, 0x00, 0x01, 0x04, 0x06, 0x83, 0x05, 0x03, 0x00, 0x04, 0x06, 0x00, 0x8c, 0x00, 0x00,
+        0x06, 0x85, 0x07, 0x0b, 0x05, 0x03, 0x01, 0x04, 0x05, 0x03, 0x02, 0x07, 0x07, 0x04, 0x00, 0x05,
+        0x82, 0x07, 0x00, 0x05, 0x87, 0x00, 0x01, 0x05, 0x07, 0x8b, 0x06, 0x85, 0x07, 0x88, 0x06, 0x85,
+        0x05, 0x02, 0x02, 0x01, 0x01, 0x8a, 0x00, 0x04, 0x02, 0x07, 0x07, 0x06, 0x05, 0x82, 0x06, 0x03,
+        0x07, 0x01, 0x07, 0x03, 0xc2, 0x03, 0x00, 0x01, 0x04, 0x06, 0x83, 0x05, 0x03, 0x00, 0x04, 0x06,
+        0x00, 0x8a, 0x00, 0x01, 0x01, 0x06, 0x83, 0x07, 0x04, 0x06, 0x03, 0x00, 0x04, 0x05, 0x82, 0x07,
+        0x05, 0x01, 0x06, 0x07, 0x07, 0x03, 0x02, 0x82, 0x07, 0x00, 0x04, 0x89, 0x00, 0x01, 0x02, 0x05,
+        0x84, 0x04, 0x01, 0x06, 0x06, 0x82, 0x04, 0x00, 0x03, 0x85, 0x01, 0x9c, 0x00, 0x04, 0x02, 0x07,
+        0x07, 0x06, 0x05, 0x82, 0x06, 0x02, 0x07, 0x01, 0x07, 0xc3, 0x03, 0x00, 0x01, 0x04, 0x06, 0x83,
+        0x05, 0x03, 0x00, 0x04, 0x06, 0x00, 0x8a, 0x00, 0x00, 0x04, 0x83, 0x07, 0x02, 0x04, 0x02, 0x05,
+        0x84, 0x07, 0x09, 0x04, 0x03, 0x07, 0x07, 0x05, 0x00, 0x06, 0x07, 0x07, 0x02, 0x91, 0x00, 0x01,
+        0x05, 0x05, 0xa6, 0x00, 0x04, 0x02, 0x07, 0x07, 0x06, 0x05, 0x82, 0x06, 0x02, 0x07, 0x01, 0x07,
+        0xc3, 0x03, 0x00, 0x01, 0x04, 0x06, 0x83, 0x05, 0x03, 0x00, 0x04, 0x06, 0x00, 0x89, 0x00, 0x00,
+        0x03, 0x82, 0x07, 0x02, 0x06, 0x01, 0x04, 0x85, 0x07, 0x09, 0x05, 0x01, 0x06, 0x07, 0x06, 0x01,
+        0x06, 0x07, 0x07, 0x02, 0x92, 0x00, 0x01, 0x05, 0x05, 0xa6, 0x00, 0x0a, 0x02, 0x07, 0x07, 0x06,
+        0x06, 0x07, 0x06, 0x06, 0x07, 0x01, 0x07, 0xc3, 0x03, 0x00, 0x01, 0x04, 0x06, 0x83, 0x05, 0x03,
+        0x00, 0x04, 0x06, 0x00, 0x89, 0x00, 0x05, 0x06, 0x07, 0x07, 0x05, 0x00, 0x04, 0x85, 0x07, 0x09,
+        0x06, 0x00, 0x06, 0x07, 0x06, 0x00, 0x05, 0x07, 0x07, 0x05, 0x93, 0x00, 0x01, 0x05, 0x05, 0xa6,
+        0x00, 0x0a, 0x02, 0x07, 0x05, 0x07, 0x05, 0x06, 0x07, 0x05, 0x07, 0x01, 0x07, 0xc3, 0x03, 0x00,
+        0x01, 0x04, 0x06, 0x83, 0x05, 0x03, 0x00, 0x04, 0x06, 0x00, 0x88, 0x00, 0x05, 0x04, 0x07, 0x07,
+        0x04, 0x01, 0x05, 0x86, 0x07, 0x08, 0x03, 0x04, 0x07, 0x07, 0x00, 0x04, 0x07, 0x07, 0x05, 0x94,
+        0x00, 0x01, 0x05, 0x05, 0xa7, 0x00, 0x09, 0x07, 0x04, 0x07, 0x03, 0x05, 0x06, 0x05, 0x06, 0x03,
+        0x07, 0xc3, 0x03, 0x00, 0x01, 0x04, 0x06, 0x83, 0x05, 0x03, 0x00, 0x04, 0x06, 0x00, 0x87, 0x00,
+        0x04, 0x02, 0x07, 0x07, 0x03, 0x02, 0x87, 0x07, 0x08, 0x04, 0x00, 0x04, 0x05, 0x00, 0x04, 0x07,
+        0x07, 0x04, 0x95, 0x00, 0x01, 0x05, 0x05, 0xa7, 0x00, 0x00, 0x05, 0x85, 0x07, 0x02, 0x04, 0x05,
+        0x07, 0xc3, 0x03, 0x00, 0x01, 0x04, 0x06, 0x82, 0x05, 0x04, 0x06, 0x00, 0x04, 0x06, 0x00, 0x87,
+        0x00, 0x04, 0x06, 0x07, 0x05, 0x02, 0x06, 0x83, 0x07, 0x0b, 0x05, 0x05, 0x04, 0x01, 0x02, 0x04,
+        0x02, 0x05, 0x06, 0x07, 0x06, 0x02, 0x96, 0x00, 0x01, 0x05, 0x05, 0xa7, 0x00, 0x00, 0x01, 0x85,
+        0x03, 0x02, 0x00, 0x05, 0x06, 0xc3, 0x03, 0x00, 0x09, 0x04, 0x06, 0x05, 0x05, 0x03, 0x07, 0x02,
+        0x04, 0x06, 0x00, 0x86, 0x00, 0x0d, 0x02, 0x07, 0x07, 0x01, 0x05, 0x06, 0x05, 0x04, 0x01, 0x02,
+        0x03, 0x05, 0x05, 0x06, 0x83, 0x07, 0x01, 0x05, 0x03, 0x98, 0x00, 0x01, 0x05, 0x05, 0xaf, 0x00,
+        0x01, 0x06, 0x05, 0xc3, 0x03, 0x00, 0x09, 0x04, 0x06, 0x05, 0x05, 0x02, 0x07, 0x07, 0x06, 0x06,
+        0x00, 0x86, 0x00, 0x08, 0x04, 0x07, 0x06, 0x00, 0x02, 0x03, 0x05, 0x05, 0x06, 0x84, 0x07, 0x03,
+        0x06, 0x04, 0x02, 0x01, 0x8e, 0x00, 0x00, 0x02, 0x87, 0x03, 0x07, 0x05, 0x05, 0x04, 0x05, 0x06,
+        0x04, 0x03, 0x02, 0xab, 0x00, 0x02, 0x01, 0x07, 0x04, 0xc3, 0x03, 0x00, 0x09, 0x04, 0x06, 0x05,
+        0x05, 0x00, 0x02, 0x05, 0x06, 0x06, 0x00, 0x86, 0x00, 0x00, 0x04, 0x8c, 0x07, 0x00, 0x06, 0x8a,
+        0x00, 0x02, 0x02, 0x05, 0x06, 0x8e, 0x07, 0x01, 0x06, 0x05, 0x83, 0x07, 0x02, 0x06, 0x06, 0x04,
+        0xa8, 0x00, 0x02, 0x01, 0x07, 0x02, 0xc3, 0x03, 0x00, 0x03, 0x04, 0x06, 0x05, 0x05, 0x82, 0x00,
+        0x02, 0x04, 0x06, 0x00, 0x84, 0x00, 0x01, 0x04, 0x06, 0x8d, 0x07, 0x00, 0x06, 0x88, 0x00, 0x00,
+        0x05, 0x92, 0x07, 0x01, 0x06, 0x05, 0x87, 0x07, 0x01, 0x06, 0x04, 0xa5, 0x00, 0x01, 0x04, 0x07,
+        0xc4, 0x03, 0x00, 0x09, 0x04, 0x06, 0x05, 0x06, 0x03, 0x00, 0x00, 0x05, 0x06, 0x00, 0x83, 0x00,
+        0x00, 0x06, 0x90, 0x07, 0x00, 0x03, 0x85, 0x00, 0x00, 0x04, 0x94, 0x07, 0x01, 0x06, 0x05, 0x89,
+        0x07, 0x02, 0x06, 0x04, 0x01, 0xa2, 0x00, 0x01, 0x05, 0x06, 0xc4, 0x03, 0x00, 0x09, 0x04, 0x06,
+        0x05, 0x07, 0x07, 0x06, 0x06, 0x07, 0x06, 0x00, 0x83, 0x00, 0x00, 0x06, 0x90, 0x07, 0x00, 0x06,
+        0x83, 0x00, 0x01, 0x02, 0x06, 0x95, 0x07, 0x01, 0x06, 0x05, 0x8b, 0x07, 0x01, 0x06, 0x01, 0xa1,
+        0x00, 0x01, 0x06, 0x06, 0xc4, 0x02, 0x00, 0x02, 0x03, 0x04, 0x05, 0x89, 0x06, 0x01, 0x05, 0x04,
+        0xb0, 0x00, 0x03, 0x04, 0x06, 0x05, 0x06, 0x82, 0x04, 0x02, 0x07, 0x03, 0x00, 0x83, 0x00, 0x00,
+        0x04, 0x91, 0x07, 0x03, 0x03, 0x00, 0x00, 0x03, 0x97, 0x07, 0x00, 0x06, 0x82, 0x00, 0x02, 0x03,
+        0x05, 0x06, 0x87, 0x07, 0x01, 0x06, 0x01, 0x9f, 0x00, 0x02, 0x01, 0x07, 0x04, 0xc0, 0x02, 0x00,
+        0x01, 0x03, 0x05, 0x92, 0x07, 0x02, 0x06, 0x05, 0x03, 0xab, 0x00, 0x03, 0x04, 0x06, 0x05, 0x06,
+        0x82, 0x00, 0x02, 0x07, 0x01, 0x00, 0x82, 0x00, 0x00, 0x06, 0x92, 0x07, 0x02, 0x06, 0x00, 0x04,
+        0x99, 0x07, 0x83, 0x06, 0x04, 0x05, 0x03, 0x02, 0x05, 0x06, 0x85, 0x07, 0x01, 0x06, 0x01, 0x9e,
+        0x00, 0x02, 0x01, 0x07, 0x02, 0xfd, 0x01, 0x00, 0x01, 0x01, 0x04, 0x98, 0x07, 0x01, 0x06, 0x03,
+        0xa9, 0x00, 0x03, 0x04, 0x06, 0x03, 0x07, 0x82, 0x00, 0x02, 0x07, 0x01, 0x00, 0x02, 0x00, 0x00,
+        0x01, 0x94, 0x07, 0x00, 0x02, 0xa0, 0x07, 0x03, 0x06, 0x04, 0x01, 0x05, 0x85, 0x07, 0x00, 0x06,
+        0x9e, 0x00, 0x01, 0x03, 0x07, 0xfd, 0x01, 0x00, 0x01, 0x03, 0x06, 0x9b, 0x07, 0x01, 0x05, 0x01,
+        0xa7, 0x00, 0x03, 0x04, 0x06, 0x02, 0x07, 0x82, 0x00, 0x02, 0x07, 0x02, 0x00, 0x02, 0x00, 0x00,
+        0x02, 0x93, 0x07, 0x01, 0x03, 0x04, 0xa2, 0x07, 0x03, 0x06, 0x01, 0x02, 0x06, 0x84, 0x07, 0x00,
+        0x05, 0x9d, 0x00, 0x01, 0x05, 0x06, 0xfc, 0x01, 0x00, 0x00, 0x05, 0x9e, 0x07, 0x01, 0x06, 0x03,
+        0xa6, 0x00, 0x03, 0x04, 0x06, 0x03, 0x07, 0x82, 0x02, 0x02, 0x06, 0x07, 0x00, 0x02, 0x00, 0x00,
+        0x02, 0x87, 0x07, 0x02, 0x05, 0x04, 0x00, 0x82, 0x02, 0x00, 0x04, 0x83, 0x07, 0x01, 0x05, 0x02,
+        0x93, 0x07, 0x01, 0x06, 0x06, 0x84, 0x05, 0x00, 0x06, 0x89, 0x07, 0x02, 0x05, 0x00, 0x06, 0x84,
+        0x07, 0x00, 0x01, 0x9c, 0x00, 0x01, 0x06, 0x04, 0xfb, 0x01, 0x00, 0x00, 0x06, 0xa1, 0x07, 0x00,
+        0x04, 0xa6, 0x00, 0x87, 0x07, 0x00, 0x04, 0x02, 0x00, 0x00, 0x05, 0x87, 0x07, 0x06, 0x00, 0x00,
+        0x04, 0x03, 0x03, 0x00, 0x00, 0x83, 0x07, 0x01, 0x01, 0x06, 0x8c, 0x07, 0x04, 0x06, 0x05, 0x05,
+        0x02, 0x02, 0x8a, 0x00, 0x02, 0x02, 0x04, 0x06, 0x86, 0x07, 0x02, 0x05, 0x00, 0x05, 0x83, 0x07,
+        0x00, 0x06, 0x9c, 0x00, 0x01, 0x07, 0x04, 0xfa, 0x01, 0x00, 0x00, 0x06, 0xa3, 0x07, 0x00, 0x03,
+        0xa5, 0x00, 0x00, 0x06, 0x86, 0x07, 0x00, 0x06, 0x02, 0x00, 0x00, 0x05, 0x83, 0x07, 0x0a, 0x03,
+        0x02, 0x00, 0x03, 0x03, 0x05, 0x05, 0x06, 0x07, 0x02, 0x00, 0x82, 0x07, 0x01, 0x05, 0x02, 0x8b,
+        0x07, 0x01, 0x04, 0x01, 0x92, 0x00, 0x03, 0x02, 0x02, 0x04, 0x06, 0x83, 0x07, 0x02, 0x06, 0x00,
+        0x04, 0x83, 0x07, 0x00, 0x03, 0x9b, 0x00, 0x01, 0x07, 0x03, 0xf9, 0x01, 0x00, 0x00, 0x05, 0xa5,
+        0x07, 0x00, 0x02, 0xa4, 0x00, 0x00, 0x06, 0x86, 0x07, 0x00, 0x06, 0x02, 0x00, 0x00, 0x03, 0x87,
+        0x07, 0x0b, 0x06, 0x06, 0x05, 0x05, 0x04, 0x01, 0x01, 0x07, 0x07, 0x06, 0x00, 0x06, 0x89, 0x07,
+        0x01, 0x06, 0x01, 0x98, 0x00, 0x00, 0x05, 0x83, 0x07, 0x02, 0x06, 0x00, 0x05, 0x82, 0x07, 0x00,
+        0x06, 0x9a, 0x00, 0x01, 0x02, 0x07, 0xf9, 0x01, 0x00, 0x00, 0x03, 0xa6, 0x07, 0x01, 0x06, 0x01,
+        0xa3, 0x00, 0x00, 0x06, 0x86, 0x07, 0x00, 0x06, 0x02, 0x00, 0x00, 0x03, 0x84, 0x07, 0x0d, 0x06,
+        0x05, 0x01, 0x00, 0x00, 0x02, 0x06, 0x06, 0x05, 0x05, 0x07, 0x07, 0x03, 0x05, 0x89, 0x07, 0x01,
+        0x04, 0x01, 0x8b, 0x00, 0x00, 0x01, 0x82, 0x03, 0x8a, 0x00, 0x00, 0x01, 0x83, 0x07, 0x01, 0x05,
+        0x02, 0x83, 0x07, 0x00, 0x03, 0x99, 0x00, 0x01, 0x04, 0x07, 0xf8, 0x01, 0x00, 0x00, 0x01, 0x8e,
+        0x07, 0x82, 0x06, 0x86, 0x05, 0x01, 0x06, 0x06, 0x8d, 0x07, 0x00, 0x04, 0xa3, 0x00, 0x00, 0x06,
+        0x86, 0x07, 0x00, 0x06, 0x02, 0x00, 0x00, 0x05, 0x84, 0x07, 0x0c, 0x06, 0x06, 0x05, 0x04, 0x04,
+        0x01, 0x05, 0x05, 0x01, 0x07, 0x07, 0x06, 0x00, 0x89, 0x07, 0x00, 0x06, 0x87, 0x00, 0x03, 0x02,
+        0x05, 0x06, 0x06, 0x86, 0x07, 0x02, 0x06, 0x05, 0x03, 0x87, 0x00, 0x00, 0x03, 0x83, 0x07, 0x01,
+        0x04, 0x03, 0x82, 0x07, 0x00, 0x05, 0x99, 0x00, 0x01, 0x05, 0x06, 0xf8, 0x01, 0x00, 0x00, 0x04,
+        0x8b, 0x07, 0x05, 0x06, 0x05, 0x03, 0x02, 0x05, 0x06, 0x86, 0x07, 0x05, 0x06, 0x05, 0x02, 0x01,
+        0x03, 0x05, 0x8a, 0x07, 0x00, 0x01, 0xa2, 0x00, 0x00, 0x06, 0x86, 0x07, 0x00, 0x06, 0x02, 0x00,
+        0x00, 0x06, 0x89, 0x07, 0x07, 0x02, 0x07, 0x03, 0x01, 0x07, 0x07, 0x04, 0x04, 0x88, 0x07, 0x00,
+        0x05, 0x87, 0x00, 0x00, 0x04, 0x8d, 0x07, 0x01, 0x05, 0x03, 0x86, 0x00, 0x00, 0x04, 0x83, 0x07,
+        0x04, 0x00, 0x06, 0x07, 0x07, 0x06, 0x99, 0x00, 0x01, 0x06, 0x05, 0xf7, 0x01, 0x00, 0x00, 0x01,
+        0x8b, 0x07, 0x03, 0x04, 0x00, 0x03, 0x06, 0x8c, 0x07, 0x03, 0x06, 0x03, 0x00, 0x04, 0x89, 0x07,
+        0x00, 0x06, 0xa2, 0x00, 0x00, 0x06, 0x86, 0x07, 0x00, 0x06, 0x01, 0x00, 0x01, 0x89, 0x07, 0x08,
+        0x04, 0x01, 0x04, 0x01, 0x05, 0x07, 0x07, 0x01, 0x06, 0x88, 0x07, 0x00, 0x02, 0x85, 0x00, 0x00,
+        0x03, 0x91, 0x07, 0x00, 0x05, 0x86, 0x00, 0x00, 0x06, 0x82, 0x07, 0x01, 0x04, 0x03, 0x82, 0x07,
+        0x00, 0x03, 0x98, 0x00, 0x01, 0x07, 0x02, 0xf7, 0x01, 0x00, 0x00, 0x04, 0x89, 0x07, 0x03, 0x06,
+        0x02, 0x01, 0x06, 0x90, 0x07, 0x02, 0x06, 0x02, 0x03, 0x89, 0x07, 0x00, 0x01, 0xa1, 0x00, 0x00,
+        0x06, 0x86, 0x07, 0x00, 0x06, 0x01, 0x00, 0x05, 0x86, 0x07, 0x0a, 0x06, 0x04, 0x00, 0x01, 0x06,
+        0x06, 0x01, 0x06, 0x07, 0x06, 0x00, 0x88, 0x07, 0x00, 0x06, 0x85, 0x00, 0x00, 0x05, 0x94, 0x07,
+        0x00, 0x03, 0x84, 0x00, 0x00, 0x04, 0x83, 0x07, 0x04, 0x00, 0x06, 0x07, 0x07, 0x05, 0x97, 0x00,
+        0x01, 0x03, 0x07, 0xf8, 0x01, 0x00, 0x89, 0x07, 0x02, 0x06, 0x00, 0x04, 0x94, 0x07, 0x02, 0x04,
+        0x03, 0x06, 0x87, 0x07, 0x00, 0x05, 0xa1, 0x04, 0x00, 0x06, 0x86, 0x07, 0x00, 0x06, 0x00, 0x00,
+        0x83, 0x07, 0x0e, 0x06, 0x04, 0x02, 0x00, 0x01, 0x04, 0x06, 0x07, 0x06, 0x03, 0x04, 0x07, 0x07,
+        0x05, 0x05, 0x88, 0x07, 0x00, 0x02, 0x83, 0x00, 0x01, 0x01, 0x06, 0x96, 0x07, 0x00, 0x03, 0x83,
+        0x00, 0x01, 0x01, 0x06, 0x82, 0x07, 0x04, 0x04, 0x05, 0x07, 0x07, 0x06, 0x97, 0x00, 0x01, 0x04,
+        0x06, 0xf7, 0x01, 0x00, 0x00, 0x03, 0x88, 0x07, 0x02, 0x04, 0x00, 0x05, 0x96, 0x07, 0x01, 0x05,
+        0x01, 0xb2, 0x07, 0x00, 0x06, 0x0e, 0x00, 0x06, 0x05, 0x04, 0x01, 0x00, 0x04, 0x06, 0x07, 0x07,
+        0x06, 0x05, 0x02, 0x00, 0x04, 0x82, 0x07, 0x01, 0x01, 0x06, 0x87, 0x07, 0x00, 0x06, 0x84, 0x00,
+        0x00, 0x06, 0x98, 0x07, 0x00, 0x03, 0x83, 0x00, 0x00, 0x04, 0x82, 0x07, 0x01, 0x06, 0x03, 0x82,
+        0x07, 0x00, 0x02, 0x96, 0x00, 0x01, 0x06, 0x06, 0xf7, 0x01, 0x00, 0x00, 0x05, 0x87, 0x07, 0x02,
+        0x06, 0x00, 0x05, 0x98, 0x07, 0x01, 0x05, 0x05, 0xb1, 0x07, 0x00, 0x06, 0x0d, 0x01, 0x07, 0x05,
+        0x05, 0x06, 0x07, 0x07, 0x05, 0x03, 0x03, 0x00, 0x01, 0x03, 0x06, 0x83, 0x07, 0x00, 0x01, 0x88,
+        0x07, 0x00, 0x04, 0x83, 0x00, 0x00, 0x06, 0x99, 0x07, 0x01, 0x06, 0x01, 0x82, 0x00, 0x00, 0x02,
+        0x83, 0x07, 0x00, 0x00, 0x82, 0x07, 0x00, 0x03, 0x96, 0x00, 0x01, 0x07, 0x04, 0xf7, 0x01, 0x00,
+        0x88, 0x07, 0x01, 0x04, 0x05, 0x9a, 0x07, 0x01, 0x05, 0x06, 0xb0, 0x07, 0x00, 0x05, 0x0a, 0x03,
+        0x07, 0x07, 0x06, 0x04, 0x03, 0x02, 0x02, 0x03, 0x05, 0x06, 0x85, 0x07, 0x01, 0x06, 0x01, 0x88,
+        0x07, 0x00, 0x02, 0x82, 0x00, 0x00, 0x05, 0x9b, 0x07, 0x00, 0x06, 0x83, 0x00, 0x83, 0x07, 0x04,
+        0x03, 0x06, 0x07, 0x07, 0x05, 0x95, 0x00, 0x01, 0x02, 0x07, 0xf7, 0x01, 0x00, 0x00, 0x03, 0x88,
+        0x07, 0x00, 0x03, 0x9c, 0x07, 0x00, 0x03, 0xb0, 0x07, 0x00, 0x04, 0x01, 0x06, 0x07, 0x82, 0x03,
+        0x01, 0x05, 0x06, 0x89, 0x07, 0x01, 0x05, 0x04, 0x87, 0x07, 0x00, 0x06, 0x82, 0x00, 0x00, 0x03,
+        0x9d, 0x07, 0x00, 0x03, 0x82, 0x00, 0x00, 0x05, 0x82, 0x07, 0x04, 0x05, 0x05, 0x07, 0x07, 0x06,
+        0x95, 0x00, 0x01, 0x04, 0x07, 0xf7, 0x01, 0x00, 0x00, 0x05, 0x87, 0x07, 0x01, 0x05, 0x06, 0x8b,
+        0x07, 0x03, 0x06, 0x07, 0x06, 0x06, 0x8c, 0x07, 0x01, 0x06, 0x05, 0xaf, 0x07, 0x00, 0x04, 0x00,
+        0x06, 0x8f, 0x07, 0x01, 0x02, 0x05, 0x87, 0x07, 0x00, 0x06, 0x82, 0x00, 0x00, 0x06, 0x8b, 0x07,
+        0x05, 0x06, 0x05, 0x05, 0x04, 0x05, 0x05, 0x8b, 0x07, 0x04, 0x06, 0x01, 0x00, 0x00, 0x03, 0x82,
+        0x07, 0x01, 0x06, 0x05, 0x82, 0x07, 0x00, 0x01, 0x94, 0x00, 0x01, 0x06, 0x06, 0xf7, 0x01, 0x00,
+        0x00, 0x06, 0x87, 0x07, 0x00, 0x05, 0x8a, 0x07, 0x01, 0x06, 0x03, 0x83, 0x00, 0x01, 0x01, 0x04,
+        0x8b, 0x07, 0x00, 0x05, 0xaf, 0x07, 0x00, 0x01, 0x00, 0x06, 0x8f, 0x07, 0x01, 0x01, 0x06, 0x87,
+        0x07, 0x03, 0x05, 0x00, 0x00, 0x03, 0x8a, 0x07, 0x01, 0x06, 0x04, 0x85, 0x00, 0x01, 0x01, 0x05,
+        0x8a, 0x07, 0x03, 0x05, 0x00, 0x00, 0x03, 0x82, 0x07, 0x01, 0x06, 0x03, 0x82, 0x07, 0x00, 0x03,
+        0x94, 0x00, 0x01, 0x06, 0x05, 0xf7, 0x01, 0x00, 0x87, 0x07, 0x01, 0x05, 0x06, 0x89, 0x07, 0x00,
+        0x03, 0x87, 0x00, 0x01, 0x01, 0x05, 0x8a, 0x07, 0x00, 0x06, 0xae, 0x07, 0x00, 0x01, 0x00, 0x06,
+        0x8e, 0x07, 0x01, 0x06, 0x01, 0x88, 0x07, 0x02, 0x04, 0x00, 0x00, 0x8a, 0x07, 0x00, 0x06, 0x89,
+        0x00, 0x00, 0x03, 0x8a, 0x07, 0x82, 0x00, 0x83, 0x07, 0x00, 0x01, 0x82, 0x07, 0x00, 0x04, 0x93,
+        0x00, 0x02, 0x02, 0x07, 0x03, 0xf6, 0x01, 0x00, 0x00, 0x02, 0x87, 0x07, 0x00, 0x04, 0x89, 0x07,
+        0x00, 0x03, 0x8a, 0x00, 0x00, 0x05, 0x89, 0x07, 0x00, 0x04, 0xae, 0x07, 0x00, 0x00, 0x00, 0x06,
+        0x87, 0x07, 0x08, 0x06, 0x05, 0x01, 0x01, 0x05, 0x07, 0x07, 0x06, 0x04, 0x88, 0x07, 0x02, 0x02,
+        0x00, 0x00, 0x89, 0x07, 0x00, 0x06, 0x8b, 0x00, 0x00, 0x03, 0x89, 0x07, 0x03, 0x02, 0x00, 0x00,
+        0x06, 0x82, 0x07, 0x00, 0x01, 0x82, 0x07, 0x00, 0x05, 0x93, 0x00, 0x02, 0x05, 0x07, 0x01, 0xf6,
+        0x01, 0x00, 0x00, 0x04, 0x87, 0x07, 0x00, 0x06, 0x88, 0x07, 0x00, 0x04, 0x8c, 0x00, 0x00, 0x06,
+        0x88, 0x07, 0x00, 0x06, 0xad, 0x07, 0x01, 0x06, 0x00, 0x00, 0x06, 0x83, 0x07, 0x0c, 0x05, 0x01,
+        0x01, 0x00, 0x02, 0x04, 0x05, 0x00, 0x00, 0x06, 0x07, 0x06, 0x04, 0x88, 0x07, 0x02, 0x02, 0x00,
+        0x05, 0x89, 0x07, 0x00, 0x02, 0x8c, 0x00, 0x00, 0x06, 0x88, 0x07, 0x03, 0x05, 0x00, 0x00, 0x06,
+        0x82, 0x07, 0x00, 0x01, 0x82, 0x07, 0x00, 0x05, 0x93, 0x00, 0x01, 0x06, 0x05, 0xf7, 0x01, 0x00,
+        0x00, 0x05, 0x86, 0x07, 0x01, 0x06, 0x06, 0x88, 0x07, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x03, 0x89,
+        0x07, 0x00, 0x06, 0xac, 0x07, 0x01, 0x05, 0x00, 0x00, 0x04, 0x83, 0x07, 0x01, 0x06, 0x06, 0x84,
+        0x07, 0x05, 0x02, 0x04, 0x04, 0x07, 0x06, 0x04, 0x88, 0x07, 0x02, 0x02, 0x00, 0x06, 0x88, 0x07,
+        0x00, 0x05, 0x8d, 0x00, 0x00, 0x02, 0x88, 0x07, 0x03, 0x05, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00,
+        0x00, 0x82, 0x07, 0x00, 0x05, 0x92, 0x00, 0x02, 0x03, 0x07, 0x03, 0xf7, 0x01, 0x00, 0x00, 0x06,
+        0x86, 0x07, 0x00, 0x06, 0x88, 0x07, 0x00, 0x04, 0x8e, 0x00, 0x00, 0x06, 0x88, 0x07, 0x00, 0x06,
+        0xac, 0x07, 0x01, 0x06, 0x03, 0x00, 0x04, 0x8a, 0x07, 0x05, 0x01, 0x07, 0x02, 0x07, 0x05, 0x04,
+        0x88, 0x07, 0x02, 0x01, 0x00, 0x06, 0x88, 0x07, 0x00, 0x02, 0x8e, 0x00, 0x00, 0x06, 0x88, 0x07,
+        0x02, 0x00, 0x00, 0x04, 0x82, 0x07, 0x01, 0x03, 0x06, 0x82, 0x07, 0x91, 0x00, 0x02, 0x02, 0x07,
+        0x06, 0xf8, 0x01, 0x00, 0x87, 0x07, 0x00, 0x05, 0x88, 0x07, 0x00, 0x02, 0x8e, 0x00, 0x00, 0x05,
+        0x88, 0x07, 0x00, 0x05, 0xad, 0x07, 0x00, 0x05, 0x00, 0x02, 0x8a, 0x07, 0x05, 0x01, 0x07, 0x01,
+        0x07, 0x05, 0x06, 0x87, 0x07, 0x02, 0x06, 0x00, 0x00, 0x89, 0x07, 0x00, 0x01, 0x8e, 0x00, 0x00,
+        0x05, 0x88, 0x07, 0x02, 0x01, 0x00, 0x04, 0x82, 0x07, 0x01, 0x04, 0x06, 0x82, 0x07, 0x90, 0x02,
+        0x03, 0x05, 0x07, 0x07, 0x03, 0xf8, 0x01, 0x00, 0x87, 0x07, 0x00, 0x04, 0x88, 0x07, 0x00, 0x02,
+        0x8e, 0x00, 0x00, 0x05, 0x88, 0x07, 0x00, 0x04, 0xad, 0x07, 0x00, 0x06, 0x01, 0x00, 0x04, 0x86,
+        0x07, 0x08, 0x06, 0x05, 0x03, 0x01, 0x07, 0x02, 0x07, 0x04, 0x06, 0x87, 0x07, 0x02, 0x06, 0x00,
+        0x00, 0x89, 0x07, 0x00, 0x01, 0x8e, 0x00, 0x00, 0x05, 0x88, 0x07, 0x02, 0x03, 0x00, 0x03, 0x82,
+        0x07, 0x01, 0x04, 0x05, 0x94, 0x07, 0x01, 0x06, 0x02, 0xf8, 0x01, 0x00, 0x00, 0x04, 0x86, 0x07,
+        0x01, 0x06, 0x03, 0x88, 0x07, 0x00, 0x02, 0x8e, 0x00, 0x00, 0x04, 0x88, 0x07, 0x00, 0x04, 0xad,
+        0x07, 0x00, 0x06, 0x02, 0x00, 0x00, 0x06, 0x83, 0x07, 0x0a, 0x06, 0x02, 0x02, 0x04, 0x05, 0x06,
+        0x04, 0x01, 0x07, 0x02, 0x06, 0x87, 0x07, 0x02, 0x06, 0x00, 0x00, 0x89, 0x07, 0x00, 0x01, 0x8e,
+        0x00, 0x00, 0x05, 0x88, 0x07, 0x02, 0x02, 0x00, 0x00, 0x82, 0x07, 0x01, 0x05, 0x03, 0x95, 0x02,
+        0x00, 0x04, 0x84, 0x05, 0xf3, 0x01, 0x06, 0x87, 0x07, 0x01, 0x06, 0x03, 0x88, 0x07, 0x00, 0x02,
+        0x8e, 0x00, 0x00, 0x05, 0x88, 0x07, 0x00, 0x04, 0xaa, 0x07, 0x82, 0x05, 0x00, 0x02, 0x11, 0x00,
+        0x03, 0x06, 0x07, 0x07, 0x05, 0x02, 0x00, 0x00, 0x02, 0x01, 0x02, 0x03, 0x03, 0x06, 0x07, 0x02,
+        0x06, 0x87, 0x07, 0x02, 0x06, 0x00, 0x00, 0x89, 0x07, 0x8f, 0x00, 0x00, 0x05, 0x88, 0x07, 0x02,
+        0x01, 0x00, 0x00, 0xdc, 0x02, 0x07, 0x01, 0x05, 0x03, 0x88, 0x07, 0x00, 0x04, 0x8e, 0x00, 0x00,
+        0x06, 0x88, 0x07, 0x01, 0x04, 0x06, 0xa5, 0x07, 0x01, 0x03, 0x01, 0x85, 0x00, 0x04, 0x00, 0x04,
+        0x06, 0x07, 0x07, 0x82, 0x06, 0x00, 0x05, 0x86, 0x07, 0x01, 0x02, 0x06, 0x87, 0x07, 0x02, 0x06,
+        0x00, 0x00, 0x89, 0x07, 0x00, 0x05, 0x8d, 0x00, 0x00, 0x01, 0x89, 0x07, 0x82, 0x00, 0xdc, 0x02,
+        0x07, 0x01, 0x05, 0x03, 0x88, 0x07, 0x00, 0x06, 0x8d, 0x00, 0x00, 0x02, 0x89, 0x07, 0x01, 0x04,
+        0x06, 0xa1, 0x07, 0x82, 0x06, 0x00, 0x04, 0x87, 0x00, 0x82, 0x00, 0x02, 0x02, 0x04, 0x05, 0x85,
+        0x06, 0x8d, 0x07, 0x03, 0x06, 0x00, 0x00, 0x05, 0x89, 0x07, 0x8d, 0x00, 0x00, 0x04, 0x89, 0x07,
+        0x02, 0x00, 0x00, 0x04, 0x8d, 0x07, 0xcd, 0x02, 0x06, 0x02, 0x04, 0x01, 0x00, 0x89, 0x07, 0x00,
+        0x04, 0x8c, 0x00, 0x00, 0x06, 0x89, 0x07, 0x01, 0x02, 0x06, 0x82, 0x07, 0x9d, 0x06, 0x00, 0x04,
+        0x8b, 0x00, 0x8b, 0x00, 0x88, 0x01, 0x00, 0x03, 0x83, 0x05, 0x03, 0x03, 0x00, 0x00, 0x01, 0x89,
+        0x07, 0x00, 0x05, 0x8b, 0x00, 0x00, 0x01, 0x89, 0x07, 0x05, 0x05, 0x00, 0x00, 0x04, 0x07, 0x07,
+        0x83, 0x06, 0x82, 0x05, 0x00, 0x04, 0x83, 0x01, 0xd0, 0x02, 0x00, 0x8a, 0x07, 0x00, 0x02, 0x8a,
+        0x00, 0x00, 0x04, 0x8a, 0x07, 0x00, 0x00, 0x82, 0x01, 0x00, 0x02, 0xaa, 0x00, 0x9d, 0x00, 0x00,
+        0x06, 0x89, 0x07, 0x00, 0x04, 0x89, 0x00, 0x01, 0x01, 0x06, 0x89, 0x07, 0x05, 0x02, 0x00, 0x00,
+        0x02, 0x04, 0x01, 0xdc, 0x02, 0x00, 0x00, 0x05, 0x8a, 0x07, 0x00, 0x02, 0x88, 0x00, 0x00, 0x04,
+        0x8a, 0x07, 0x00, 0x05, 0xaf, 0x00, 0x9d, 0x00, 0x00, 0x04, 0x8a, 0x07, 0x00, 0x05, 0x87, 0x00,
+        0x01, 0x03, 0x06, 0x89, 0x07, 0x00, 0x05, 0xe2, 0x02, 0x00, 0x00, 0x02, 0x8b, 0x07, 0x01, 0x05,
+        0x02, 0x84, 0x00, 0x01, 0x03, 0x06, 0x8b, 0x07, 0x00, 0x02, 0xaf, 0x00, 0x9e, 0x00, 0x8c, 0x07,
+        0x00, 0x04, 0x83, 0x01, 0x01, 0x03, 0x06, 0x8b, 0x07, 0x00, 0x03, 0xe3, 0x02, 0x00, 0x00, 0x06,
+        0x8c, 0x07, 0x84, 0x06, 0x8c, 0x07, 0x00, 0x06, 0xb0, 0x00, 0x9e, 0x00, 0x00, 0x05, 0x9d, 0x07,
+        0x00, 0x06, 0xe4, 0x02, 0x00, 0x00, 0x02, 0x9e, 0x07, 0x00, 0x02, 0xb0, 0x00, 0x9f, 0x00, 0x00,
+        0x06, 0x9c, 0x07, 0x00, 0x01, 0xe5, 0x02, 0x00, 0x00, 0x05, 0x9c, 0x07, 0x00, 0x05, 0xb1, 0x00,
+        0x9f, 0x00, 0x00, 0x03, 0x9b, 0x07, 0x00, 0x04, 0xe7, 0x02, 0x00, 0x9c, 0x07, 0xb2, 0x00, 0xa0,
+        0x00, 0x00, 0x04, 0x99, 0x07, 0x00, 0x05, 0xe8, 0x02, 0x00, 0x00, 0x02, 0x9a, 0x07, 0x00, 0x02,
+        0xb2, 0x00, 0xa0, 0x00, 0x01, 0x01, 0x04, 0x97, 0x07, 0x00, 0x05, 0xea, 0x02, 0x00, 0x00, 0x02,
+        0x98, 0x07, 0x00, 0x02, 0xb3, 0x00, 0xa2, 0x00, 0x00, 0x04, 0x95, 0x07, 0x00, 0x05, 0xec, 0x02,
+        0x00, 0x00, 0x02, 0x96, 0x07, 0x00, 0x02, 0xb4, 0x00, 0xa3, 0x00, 0x00, 0x04, 0x93, 0x07, 0x00,
+        0x04, 0xee, 0x02, 0x00, 0x01, 0x01, 0x05, 0x92, 0x07, 0x01, 0x05, 0x01, 0xb5, 0x00, 0xa4, 0x00,
+        0x01, 0x01, 0x05, 0x8f, 0x07, 0x01, 0x06, 0x02, 0xf1, 0x02, 0x00, 0x01, 0x02, 0x06, 0x8e, 0x07,
+        0x01, 0x06, 0x03, 0xb7, 0x00, 0xa6, 0x00, 0x01, 0x01, 0x05, 0x8a, 0x07, 0x02, 0x06, 0x06, 0x02,
+        0xf5, 0x02, 0x00, 0x02, 0x02, 0x05, 0x06, 0x88, 0x07, 0x02, 0x06, 0x05, 0x03, 0xb9, 0x00, 0xa9,
+        0x00, 0x01, 0x01, 0x04, 0x85, 0x06, 0x01, 0x04, 0x02, 0xfb, 0x02, 0x00, 0x00, 0x01, 0x86, 0x04,
+        0x00, 0x01, 0xbc, 0x00,
+};
+const MenuImage roadcruiser_xl = {310, 135, kMenuImagePalette, false, 0x0000, roadcruiser_xl_palette, roadcruiser_xl_rows, roadcruiser_xl_data};
+
+static const uint16_t airHeater_palette[] = {
+        0x0000, 0x0020, 0x1082, 0x10a2, 0x18c3, 0x18e3, 0x2945, 0x3186, 0x31a6, 0x39c7, 0x39e7, 0x4208,
+        0x4228, 0x4a49, 0x4a69, 0x528a, 0x5acb, 0x5aeb, 0x630c, 0x632c, 0x6b4d, 0x6b6d, 0x738e, 0x73ae,
+        0x7bcf, 0x7bef, 0x8410, 0x8c51, 0x8c71, 0x9492, 0x94b2, 0x9cd3, 0x9cf3, 0xa514, 0xa534, 0xad55,
+        0xad75, 0xb596, 0xb5b6, 0xbdd7, 0xbdf7, 0xc618, 0xc638, 0xce59, 0xce79, 0xd69a, 0xd6ba, 0xdedb,
+        0xdefb, 0xe71c, 0xe73c, 0xef5d, 0xef7d, 0xf79e, 0xf7be, 0xffdf, 0xffff,
+};
+static const uint16_t airHeater_rows[] = {
+        0, 2, 21, 44, 69, 93, 117, 139, 161, 183, 205, 227,
+        251, 277, 302, 327, 350, 372, 393, 413, 433, 455, 478, 502,
+        528, 554, 575, 577,
+};
+static const uint8_t airHeater_data[] = {
+        0x9d, 0x00, 0x82, 0x00, 0x02, 0x0e, 0x20, 0x0f, 0x86, 0x00, 0x02, 0x03, 0x20, 0x17, 0x87, 0x00,
+        0x01, 0x1c, 0x1b, 0x83, 0x00, 0x82, 0x00, 0x03, 0x32, 0x38, 0x34, 0x0a, 0x85, 0x00, 0x03, 0x28,
+        0x38, 0x37, 0x16, 0x85, 0x00, 0x03, 0x1d, 0x38, 0x38, 0x21, 0x82, 0x00, 0x82, 0x00, 0x03, 0x2c,
+        0x38, 0x38, 0x2b, 0x85, 0x00, 0x04, 0x21, 0x38, 0x38, 0x32, 0x06, 0x84, 0x00, 0x06, 0x15, 0x38,
+        0x38, 0x37, 0x11, 0x00, 0x00, 0x82, 0x00, 0x04, 0x0a, 0x35, 0x38, 0x38, 0x1a, 0x85, 0x00, 0x03,
+        0x2e, 0x38, 0x38, 0x26, 0x85, 0x00, 0x05, 0x26, 0x38, 0x38, 0x2f, 0x00, 0x00, 0x83, 0x00, 0x03,
+        0x1c, 0x38, 0x38, 0x30, 0x85, 0x00, 0x04, 0x0e, 0x37, 0x38, 0x37, 0x07, 0x84, 0x00, 0x05, 0x03,
+        0x32, 0x38, 0x38, 0x17, 0x00, 0x84, 0x00, 0x03, 0x32, 0x38, 0x38, 0x0c, 0x85, 0x00, 0x03, 0x29,
+        0x38, 0x38, 0x1e, 0x85, 0x00, 0x04, 0x1f, 0x38, 0x38, 0x29, 0x00, 0x84, 0x00, 0x03, 0x29, 0x38,
+        0x38, 0x17, 0x85, 0x00, 0x03, 0x1d, 0x38, 0x38, 0x25, 0x85, 0x00, 0x04, 0x0e, 0x38, 0x38, 0x30,
+        0x00, 0x84, 0x00, 0x03, 0x29, 0x38, 0x38, 0x17, 0x85, 0x00, 0x03, 0x1e, 0x38, 0x38, 0x24, 0x85,
+        0x00, 0x04, 0x0e, 0x38, 0x38, 0x30, 0x00, 0x84, 0x00, 0x03, 0x31, 0x38, 0x38, 0x08, 0x85, 0x00,
+        0x03, 0x29, 0x38, 0x38, 0x1c, 0x85, 0x00, 0x04, 0x1f, 0x38, 0x38, 0x28, 0x00, 0x83, 0x00, 0x03,
+        0x17, 0x38, 0x38, 0x30, 0x85, 0x00, 0x03, 0x09, 0x36, 0x38, 0x36, 0x86, 0x00, 0x04, 0x2f, 0x38,
+        0x38, 0x18, 0x00, 0x82, 0x00, 0x04, 0x02, 0x31, 0x38, 0x38, 0x1c, 0x85, 0x00, 0x03, 0x27, 0x38,
+        0x38, 0x28, 0x85, 0x00, 0x05, 0x1b, 0x38, 0x38, 0x32, 0x00, 0x00, 0x82, 0x00, 0x04, 0x23, 0x38,
+        0x38, 0x30, 0x01, 0x84, 0x00, 0x04, 0x16, 0x37, 0x38, 0x37, 0x0a, 0x84, 0x00, 0x06, 0x0a, 0x34,
+        0x38, 0x38, 0x19, 0x00, 0x00, 0x06, 0x00, 0x00, 0x15, 0x38, 0x38, 0x37, 0x15, 0x84, 0x00, 0x04,
+        0x09, 0x34, 0x38, 0x38, 0x20, 0x85, 0x00, 0x03, 0x2d, 0x38, 0x38, 0x2b, 0x82, 0x00, 0x05, 0x00,
+        0x00, 0x32, 0x38, 0x38, 0x22, 0x85, 0x00, 0x04, 0x29, 0x38, 0x38, 0x2d, 0x01, 0x84, 0x00, 0x04,
+        0x1e, 0x38, 0x38, 0x34, 0x09, 0x82, 0x00, 0x04, 0x00, 0x20, 0x38, 0x38, 0x2f, 0x85, 0x00, 0x04,
+        0x12, 0x38, 0x38, 0x35, 0x0b, 0x85, 0x00, 0x03, 0x33, 0x38, 0x38, 0x19, 0x83, 0x00, 0x04, 0x00,
+        0x30, 0x38, 0x38, 0x15, 0x85, 0x00, 0x03, 0x26, 0x38, 0x38, 0x24, 0x85, 0x00, 0x03, 0x19, 0x38,
+        0x38, 0x2d, 0x84, 0x00, 0x03, 0x00, 0x37, 0x38, 0x33, 0x86, 0x00, 0x03, 0x2f, 0x38, 0x38, 0x0d,
+        0x85, 0x00, 0x03, 0x27, 0x38, 0x38, 0x1d, 0x84, 0x00, 0x03, 0x00, 0x38, 0x38, 0x2d, 0x86, 0x00,
+        0x02, 0x34, 0x38, 0x38, 0x86, 0x00, 0x03, 0x2b, 0x38, 0x38, 0x10, 0x84, 0x00, 0x03, 0x00, 0x38,
+        0x38, 0x2e, 0x86, 0x00, 0x02, 0x33, 0x38, 0x38, 0x86, 0x00, 0x03, 0x2b, 0x38, 0x38, 0x14, 0x84,
+        0x00, 0x04, 0x00, 0x36, 0x38, 0x35, 0x05, 0x85, 0x00, 0x03, 0x2e, 0x38, 0x38, 0x16, 0x85, 0x00,
+        0x03, 0x22, 0x38, 0x38, 0x23, 0x84, 0x00, 0x04, 0x00, 0x2c, 0x38, 0x38, 0x1f, 0x85, 0x00, 0x03,
+        0x20, 0x38, 0x38, 0x29, 0x85, 0x00, 0x04, 0x13, 0x38, 0x38, 0x33, 0x02, 0x83, 0x00, 0x05, 0x00,
+        0x19, 0x38, 0x38, 0x35, 0x0c, 0x84, 0x00, 0x04, 0x07, 0x36, 0x38, 0x38, 0x18, 0x85, 0x00, 0x03,
+        0x2f, 0x38, 0x38, 0x24, 0x83, 0x00, 0x06, 0x00, 0x00, 0x2b, 0x38, 0x38, 0x31, 0x09, 0x84, 0x00,
+        0x04, 0x20, 0x38, 0x38, 0x36, 0x16, 0x84, 0x00, 0x04, 0x15, 0x37, 0x38, 0x38, 0x1f, 0x82, 0x00,
+        0x06, 0x00, 0x00, 0x06, 0x32, 0x38, 0x38, 0x28, 0x84, 0x00, 0x04, 0x01, 0x2a, 0x38, 0x38, 0x31,
+        0x85, 0x00, 0x00, 0x21, 0x82, 0x38, 0x02, 0x04, 0x00, 0x00, 0x82, 0x00, 0x03, 0x0b, 0x2f, 0x35,
+        0x1b, 0x86, 0x00, 0x02, 0x29, 0x36, 0x24, 0x86, 0x00, 0x02, 0x21, 0x35, 0x2c, 0x82, 0x00, 0x9d,
+        0x00, 0x9d, 0x00,
+};
+const MenuImage airHeater = {30, 28, kMenuImagePalette, false, 0x0000, airHeater_palette, airHeater_rows, airHeater_data};
+
+static const uint16_t waterHeater_palette[] = {
+        0x0000, 0x0020, 0x0841, 0x0861, 0x1082, 0x10a2, 0x18c3, 0x18e3, 0x2104, 0x2124, 0x2945, 0x2965,
+        0x3186, 0x31a6, 0x39e7, 0x4208, 0x4228, 0x4a49, 0x4a69, 0x528a, 0x52aa, 0x5acb, 0x5aeb, 0x630c,
+        0x632c, 0x6b4d, 0x6b6d, 0x738e, 0x73ae, 0x7bcf, 0x7bef, 0x8410, 0x8430, 0x8c51, 0x8c71, 0x9492,
+        0x94b2, 0x9cd3, 0x9cf3, 0xa514, 0xad55, 0xad75, 0xb596, 0xb5b6, 0xbdd7, 0xbdf7, 0xc618, 0xc638,
+        0xce59, 0xce79, 0xd69a, 0xd6ba, 0xdedb, 0xdefb, 0xe71c, 0xe73c, 0xef5d, 0xef7d, 0xf79e, 0xf7be,
+};
+static const uint16_t waterHeater_rows[] = {
+        0, 20, 42, 72, 100, 122, 139, 151, 161, 192, 223, 254,
+        285, 316, 347, 378, 409, 440, 471, 502, 533, 564, 574, 586,
+        600, 611,
+};
+static const uint8_t waterHeater_data[] = {
+        0x86, 0x01, 0x0e, 0x02, 0x06, 0x08, 0x19, 0x1d, 0x28, 0x31, 0x32, 0x32, 0x30, 0x22, 0x1e, 0x13,
+        0x08, 0x04, 0x87, 0x01, 0x83, 0x01, 0x06, 0x00, 0x06, 0x0d, 0x22, 0x33, 0x34, 0x39, 0x87, 0x3b,
+        0x06, 0x39, 0x34, 0x31, 0x21, 0x0d, 0x06, 0x00, 0x83, 0x01, 0x0c, 0x01, 0x01, 0x00, 0x09, 0x21,
+        0x2c, 0x34, 0x3b, 0x3b, 0x39, 0x37, 0x2e, 0x2c, 0x83, 0x2b, 0x0c, 0x2d, 0x2e, 0x37, 0x39, 0x3b,
+        0x3b, 0x34, 0x2c, 0x18, 0x09, 0x00, 0x01, 0x01, 0x0b, 0x01, 0x0c, 0x22, 0x33, 0x3a, 0x3a, 0x38,
+        0x2c, 0x28, 0x18, 0x0f, 0x03, 0x85, 0x00, 0x0b, 0x03, 0x0f, 0x18, 0x28, 0x2c, 0x38, 0x3b, 0x38,
+        0x32, 0x21, 0x0b, 0x00, 0x06, 0x0e, 0x33, 0x3a, 0x3a, 0x36, 0x27, 0x11, 0x82, 0x00, 0x89, 0x01,
+        0x82, 0x00, 0x06, 0x16, 0x2a, 0x36, 0x3a, 0x3a, 0x2f, 0x0f, 0x05, 0x29, 0x3b, 0x38, 0x27, 0x0c,
+        0x00, 0x90, 0x01, 0x06, 0x00, 0x00, 0x0c, 0x27, 0x38, 0x3a, 0x2c, 0x03, 0x31, 0x3a, 0x27, 0x00,
+        0x95, 0x01, 0x03, 0x00, 0x27, 0x3a, 0x31, 0x02, 0x31, 0x39, 0x18, 0x97, 0x01, 0x02, 0x18, 0x39,
+        0x31, 0x1d, 0x31, 0x39, 0x18, 0x01, 0x08, 0x0b, 0x01, 0x01, 0x0c, 0x1c, 0x10, 0x00, 0x01, 0x01,
+        0x14, 0x19, 0x08, 0x01, 0x00, 0x10, 0x1c, 0x0c, 0x01, 0x01, 0x05, 0x0d, 0x00, 0x18, 0x39, 0x31,
+        0x1d, 0x31, 0x39, 0x18, 0x00, 0x19, 0x32, 0x22, 0x18, 0x30, 0x3b, 0x36, 0x26, 0x17, 0x26, 0x37,
+        0x3b, 0x2a, 0x18, 0x1f, 0x34, 0x3b, 0x2e, 0x18, 0x1d, 0x32, 0x22, 0x00, 0x18, 0x39, 0x31, 0x1d,
+        0x31, 0x39, 0x18, 0x01, 0x0c, 0x32, 0x3b, 0x3b, 0x35, 0x2a, 0x31, 0x3a, 0x3b, 0x3b, 0x2f, 0x2d,
+        0x37, 0x3b, 0x3b, 0x31, 0x26, 0x34, 0x3b, 0x3b, 0x33, 0x15, 0x00, 0x18, 0x39, 0x31, 0x1d, 0x31,
+        0x39, 0x1a, 0x00, 0x00, 0x15, 0x2a, 0x2a, 0x17, 0x00, 0x09, 0x1f, 0x2c, 0x22, 0x05, 0x00, 0x21,
+        0x2b, 0x28, 0x0a, 0x00, 0x12, 0x2c, 0x2b, 0x18, 0x00, 0x01, 0x18, 0x39, 0x31, 0x04, 0x31, 0x39,
+        0x17, 0x01, 0x03, 0x82, 0x00, 0x02, 0x06, 0x12, 0x0b, 0x82, 0x00, 0x07, 0x09, 0x11, 0x02, 0x00,
+        0x00, 0x08, 0x12, 0x06, 0x82, 0x00, 0x04, 0x07, 0x01, 0x18, 0x39, 0x31, 0x1d, 0x31, 0x39, 0x18,
+        0x00, 0x16, 0x22, 0x14, 0x10, 0x23, 0x35, 0x2d, 0x11, 0x10, 0x12, 0x35, 0x33, 0x1f, 0x10, 0x11,
+        0x2d, 0x39, 0x24, 0x0b, 0x0d, 0x1f, 0x1f, 0x00, 0x18, 0x39, 0x31, 0x05, 0x31, 0x39, 0x18, 0x01,
+        0x10, 0x35, 0x82, 0x38, 0x0b, 0x2e, 0x37, 0x39, 0x38, 0x39, 0x35, 0x34, 0x38, 0x38, 0x39, 0x37,
+        0x2e, 0x82, 0x37, 0x05, 0x34, 0x18, 0x00, 0x18, 0x39, 0x31, 0x1d, 0x31, 0x39, 0x19, 0x00, 0x00,
+        0x19, 0x32, 0x34, 0x1c, 0x06, 0x11, 0x28, 0x35, 0x25, 0x0d, 0x0a, 0x22, 0x35, 0x28, 0x13, 0x06,
+        0x1c, 0x33, 0x32, 0x1a, 0x00, 0x01, 0x18, 0x39, 0x31, 0x17, 0x31, 0x39, 0x18, 0x01, 0x01, 0x00,
+        0x06, 0x08, 0x01, 0x09, 0x00, 0x04, 0x08, 0x02, 0x00, 0x00, 0x03, 0x08, 0x04, 0x00, 0x08, 0x01,
+        0x07, 0x06, 0x82, 0x01, 0x02, 0x18, 0x39, 0x31, 0x1d, 0x31, 0x39, 0x18, 0x00, 0x13, 0x1b, 0x0d,
+        0x05, 0x18, 0x31, 0x26, 0x10, 0x02, 0x13, 0x29, 0x31, 0x12, 0x03, 0x0d, 0x26, 0x32, 0x1d, 0x04,
+        0x08, 0x1c, 0x1a, 0x00, 0x18, 0x39, 0x31, 0x1d, 0x31, 0x39, 0x18, 0x00, 0x15, 0x39, 0x34, 0x33,
+        0x38, 0x39, 0x3a, 0x35, 0x32, 0x37, 0x3a, 0x39, 0x37, 0x33, 0x35, 0x3a, 0x39, 0x37, 0x33, 0x34,
+        0x39, 0x1d, 0x00, 0x18, 0x39, 0x31, 0x1d, 0x31, 0x39, 0x18, 0x01, 0x00, 0x28, 0x34, 0x38, 0x25,
+        0x14, 0x19, 0x34, 0x39, 0x2f, 0x18, 0x14, 0x29, 0x39, 0x32, 0x1f, 0x0d, 0x24, 0x38, 0x38, 0x28,
+        0x00, 0x01, 0x18, 0x39, 0x31, 0x1d, 0x31, 0x39, 0x1b, 0x00, 0x01, 0x00, 0x0d, 0x11, 0x04, 0x01,
+        0x00, 0x08, 0x12, 0x06, 0x01, 0x01, 0x08, 0x12, 0x0a, 0x00, 0x01, 0x01, 0x11, 0x11, 0x02, 0x01,
+        0x01, 0x18, 0x39, 0x31, 0x02, 0x31, 0x39, 0x17, 0x97, 0x01, 0x02, 0x17, 0x39, 0x31, 0x03, 0x31,
+        0x3a, 0x20, 0x00, 0x95, 0x01, 0x03, 0x00, 0x20, 0x3a, 0x31, 0x04, 0x31, 0x3a, 0x32, 0x1d, 0x14,
+        0x93, 0x13, 0x04, 0x14, 0x20, 0x33, 0x3a, 0x31, 0x02, 0x22, 0x3b, 0x3a, 0x96, 0x39, 0x03, 0x3a,
+        0x3a, 0x38, 0x21, 0x01, 0x0c, 0x28, 0x99, 0x33, 0x01, 0x22, 0x0c,
+};
+const MenuImage waterHeater = {30, 26, kMenuImagePalette, false, 0x0000, waterHeater_palette, waterHeater_rows, waterHeater_data};
+
+static const uint16_t tcombi_palette[] = {
+        0x0000, 0x2945, 0x4a69, 0x6b6d, 0x94b2, 0xb5b6, 0xd69a, 0xffdf,
+};
+static const uint16_t tcombi_rows[] = {
+        0, 23, 46, 73, 100, 121, 144, 166, 190, 216, 246, 280,
+        314, 347, 380, 409, 437, 473, 511, 544, 576, 610, 642, 679,
+        714, 754, 792, 831, 860, 887, 914, 937, 952, 971, 988, 999,
+        1009, 1017, 1028,
+};
+static const uint8_t tcombi_data[] = {
+        0x87, 0x00, 0x02, 0x01, 0x03, 0x03, 0x83, 0x07, 0x04, 0x06, 0x02, 0x03, 0x02, 0x05, 0x82, 0x07,
+        0x03, 0x06, 0x02, 0x03, 0x02, 0x94, 0x00, 0x86, 0x00, 0x04, 0x03, 0x06, 0x07, 0x07, 0x06, 0x83,
+        0x05, 0x83, 0x07, 0x01, 0x05, 0x05, 0x84, 0x07, 0x02, 0x05, 0x05, 0x04, 0x91, 0x00, 0x85, 0x00,
+        0x00, 0x03, 0x82, 0x07, 0x01, 0x02, 0x01, 0x83, 0x00, 0x02, 0x02, 0x03, 0x04, 0x82, 0x07, 0x02,
+        0x05, 0x02, 0x03, 0x86, 0x07, 0x00, 0x06, 0x8e, 0x00, 0x84, 0x00, 0x03, 0x02, 0x07, 0x07, 0x02,
+        0x8b, 0x00, 0x00, 0x06, 0x82, 0x07, 0x02, 0x01, 0x01, 0x06, 0x82, 0x07, 0x00, 0x06, 0x82, 0x07,
+        0x00, 0x04, 0x8b, 0x00, 0x83, 0x00, 0x03, 0x03, 0x07, 0x07, 0x03, 0x8e, 0x00, 0x02, 0x04, 0x05,
+        0x06, 0x87, 0x07, 0x02, 0x06, 0x07, 0x05, 0x8a, 0x00, 0x82, 0x00, 0x03, 0x02, 0x07, 0x07, 0x02,
+        0x92, 0x00, 0x02, 0x02, 0x03, 0x06, 0x82, 0x07, 0x04, 0x03, 0x03, 0x04, 0x06, 0x07, 0x8a, 0x00,
+        0x82, 0x00, 0x02, 0x04, 0x07, 0x06, 0x93, 0x00, 0x01, 0x02, 0x04, 0x85, 0x07, 0x05, 0x06, 0x01,
+        0x07, 0x02, 0x03, 0x02, 0x87, 0x00, 0x82, 0x00, 0x02, 0x07, 0x07, 0x02, 0x92, 0x00, 0x03, 0x03,
+        0x07, 0x05, 0x03, 0x82, 0x00, 0x01, 0x04, 0x06, 0x85, 0x07, 0x00, 0x04, 0x86, 0x00, 0x04, 0x00,
+        0x00, 0x06, 0x07, 0x05, 0x92, 0x00, 0x02, 0x06, 0x06, 0x03, 0x83, 0x00, 0x00, 0x04, 0x82, 0x02,
+        0x00, 0x00, 0x84, 0x07, 0x00, 0x02, 0x85, 0x00, 0x04, 0x02, 0x06, 0x07, 0x06, 0x05, 0x91, 0x00,
+        0x04, 0x06, 0x06, 0x00, 0x00, 0x04, 0x85, 0x07, 0x0a, 0x05, 0x07, 0x07, 0x05, 0x00, 0x03, 0x07,
+        0x07, 0x06, 0x02, 0x03, 0x82, 0x00, 0x03, 0x07, 0x05, 0x05, 0x07, 0x90, 0x00, 0x11, 0x01, 0x06,
+        0x06, 0x00, 0x00, 0x05, 0x07, 0x06, 0x05, 0x07, 0x06, 0x07, 0x05, 0x07, 0x02, 0x00, 0x03, 0x05,
+        0x83, 0x07, 0x04, 0x06, 0x07, 0x05, 0x05, 0x00, 0x03, 0x07, 0x00, 0x00, 0x07, 0x90, 0x00, 0x0e,
+        0x02, 0x06, 0x00, 0x00, 0x05, 0x07, 0x00, 0x05, 0x07, 0x07, 0x05, 0x02, 0x03, 0x06, 0x00, 0x83,
+        0x07, 0x01, 0x05, 0x07, 0x82, 0x02, 0x02, 0x06, 0x07, 0x07, 0x03, 0x07, 0x00, 0x00, 0x07, 0x8f,
+        0x00, 0x0e, 0x01, 0x07, 0x04, 0x00, 0x04, 0x07, 0x00, 0x07, 0x06, 0x07, 0x07, 0x05, 0x00, 0x00,
+        0x05, 0x84, 0x07, 0x01, 0x05, 0x05, 0x83, 0x00, 0x01, 0x04, 0x07, 0x03, 0x06, 0x05, 0x00, 0x07,
+        0x8f, 0x00, 0x0d, 0x06, 0x05, 0x00, 0x04, 0x07, 0x06, 0x05, 0x07, 0x05, 0x07, 0x00, 0x03, 0x00,
+        0x03, 0x85, 0x07, 0x07, 0x05, 0x05, 0x00, 0x05, 0x03, 0x04, 0x04, 0x07, 0x03, 0x02, 0x07, 0x01,
+        0x07, 0x8e, 0x00, 0x05, 0x05, 0x06, 0x00, 0x00, 0x07, 0x06, 0x82, 0x07, 0x01, 0x04, 0x06, 0x82,
+        0x00, 0x00, 0x03, 0x8a, 0x07, 0x02, 0x03, 0x00, 0x07, 0x03, 0x00, 0x05, 0x06, 0x07, 0x8e, 0x00,
+        0x05, 0x06, 0x02, 0x00, 0x05, 0x07, 0x01, 0x83, 0x07, 0x04, 0x02, 0x00, 0x00, 0x01, 0x03, 0x8a,
+        0x07, 0x02, 0x05, 0x00, 0x07, 0x05, 0x00, 0x03, 0x07, 0x07, 0x06, 0x01, 0x8b, 0x00, 0x0f, 0x02,
+        0x06, 0x01, 0x02, 0x07, 0x02, 0x02, 0x06, 0x07, 0x05, 0x05, 0x02, 0x00, 0x00, 0x06, 0x02, 0x86,
+        0x07, 0x06, 0x05, 0x07, 0x06, 0x06, 0x03, 0x04, 0x07, 0x05, 0x00, 0x00, 0x05, 0x07, 0x07, 0x02,
+        0x8b, 0x00, 0x08, 0x06, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00, 0x02, 0x03, 0x84, 0x00, 0x02, 0x07,
+        0x00, 0x05, 0x82, 0x07, 0x09, 0x06, 0x07, 0x00, 0x06, 0x07, 0x04, 0x01, 0x01, 0x05, 0x04, 0x82,
+        0x00, 0x02, 0x07, 0x05, 0x04, 0x8b, 0x00, 0x04, 0x07, 0x00, 0x00, 0x07, 0x04, 0x88, 0x00, 0x0f,
+        0x07, 0x01, 0x05, 0x07, 0x07, 0x05, 0x07, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x01, 0x05, 0x03,
+        0x82, 0x00, 0x02, 0x07, 0x00, 0x05, 0x8a, 0x00, 0x04, 0x01, 0x07, 0x00, 0x05, 0x07, 0x89, 0x00,
+        0x02, 0x04, 0x07, 0x06, 0x83, 0x07, 0x08, 0x00, 0x05, 0x07, 0x05, 0x04, 0x03, 0x02, 0x05, 0x03,
+        0x82, 0x00, 0x05, 0x07, 0x05, 0x00, 0x02, 0x06, 0x01, 0x87, 0x00, 0x04, 0x07, 0x04, 0x00, 0x07,
+        0x03, 0x87, 0x00, 0x02, 0x02, 0x00, 0x05, 0x85, 0x07, 0x01, 0x00, 0x05, 0x83, 0x07, 0x02, 0x02,
+        0x06, 0x03, 0x82, 0x00, 0x06, 0x07, 0x05, 0x00, 0x00, 0x05, 0x06, 0x03, 0x86, 0x00, 0x03, 0x07,
+        0x00, 0x00, 0x07, 0x88, 0x00, 0x01, 0x05, 0x05, 0x84, 0x07, 0x02, 0x04, 0x07, 0x01, 0x86, 0x07,
+        0x00, 0x02, 0x82, 0x00, 0x07, 0x05, 0x05, 0x00, 0x00, 0x03, 0x05, 0x07, 0x04, 0x85, 0x00, 0x03,
+        0x07, 0x00, 0x00, 0x05, 0x86, 0x00, 0x03, 0x01, 0x00, 0x07, 0x05, 0x83, 0x07, 0x03, 0x06, 0x04,
+        0x07, 0x02, 0x85, 0x07, 0x01, 0x05, 0x00, 0x82, 0x00, 0x08, 0x07, 0x07, 0x02, 0x00, 0x03, 0x00,
+        0x07, 0x07, 0x02, 0x84, 0x00, 0x00, 0x07, 0x8a, 0x00, 0x02, 0x04, 0x07, 0x05, 0x82, 0x07, 0x00,
+        0x06, 0x82, 0x07, 0x00, 0x00, 0x85, 0x07, 0x01, 0x04, 0x00, 0x82, 0x00, 0x0a, 0x07, 0x07, 0x02,
+        0x02, 0x04, 0x07, 0x06, 0x03, 0x07, 0x06, 0x01, 0x82, 0x00, 0x00, 0x07, 0x84, 0x00, 0x08, 0x02,
+        0x03, 0x06, 0x06, 0x00, 0x04, 0x07, 0x02, 0x05, 0x85, 0x07, 0x00, 0x04, 0x85, 0x07, 0x02, 0x04,
+        0x00, 0x00, 0x82, 0x00, 0x0a, 0x02, 0x07, 0x06, 0x07, 0x07, 0x04, 0x00, 0x00, 0x03, 0x06, 0x07,
+        0x82, 0x00, 0x0e, 0x07, 0x00, 0x03, 0x01, 0x00, 0x03, 0x07, 0x05, 0x04, 0x03, 0x00, 0x02, 0x07,
+        0x04, 0x05, 0x8a, 0x07, 0x00, 0x06, 0x83, 0x00, 0x83, 0x00, 0x03, 0x02, 0x03, 0x03, 0x02, 0x84,
+        0x00, 0x14, 0x06, 0x07, 0x00, 0x00, 0x07, 0x00, 0x05, 0x02, 0x02, 0x07, 0x07, 0x06, 0x00, 0x00,
+        0x07, 0x00, 0x07, 0x03, 0x05, 0x07, 0x06, 0x82, 0x07, 0x00, 0x06, 0x84, 0x07, 0x84, 0x00, 0x8d,
+        0x00, 0x06, 0x05, 0x07, 0x04, 0x07, 0x01, 0x05, 0x06, 0x83, 0x07, 0x06, 0x00, 0x01, 0x07, 0x00,
+        0x07, 0x05, 0x05, 0x83, 0x07, 0x01, 0x00, 0x05, 0x83, 0x07, 0x85, 0x00, 0x8e, 0x00, 0x04, 0x03,
+        0x07, 0x07, 0x06, 0x05, 0x84, 0x07, 0x03, 0x06, 0x07, 0x05, 0x00, 0x84, 0x07, 0x06, 0x04, 0x00,
+        0x04, 0x06, 0x07, 0x07, 0x05, 0x86, 0x00, 0x90, 0x00, 0x04, 0x07, 0x07, 0x06, 0x07, 0x06, 0x83,
+        0x07, 0x08, 0x04, 0x00, 0x00, 0x07, 0x03, 0x05, 0x07, 0x02, 0x06, 0x82, 0x07, 0x01, 0x06, 0x02,
+        0x87, 0x00, 0x91, 0x00, 0x01, 0x07, 0x05, 0x84, 0x07, 0x00, 0x04, 0x82, 0x00, 0x08, 0x06, 0x07,
+        0x04, 0x06, 0x07, 0x05, 0x07, 0x07, 0x05, 0x89, 0x00, 0x92, 0x00, 0x82, 0x07, 0x87, 0x00, 0x00,
+        0x06, 0x82, 0x07, 0x01, 0x06, 0x04, 0x8b, 0x00, 0x93, 0x00, 0x02, 0x07, 0x06, 0x05, 0x83, 0x00,
+        0x03, 0x06, 0x05, 0x00, 0x03, 0x82, 0x07, 0x00, 0x05, 0x8c, 0x00, 0x93, 0x00, 0x00, 0x05, 0x82,
+        0x07, 0x07, 0x02, 0x03, 0x02, 0x07, 0x05, 0x07, 0x07, 0x04, 0x8f, 0x00, 0x94, 0x00, 0x00, 0x06,
+        0x85, 0x07, 0x01, 0x05, 0x04, 0x91, 0x00, 0x95, 0x00, 0x00, 0x06, 0x84, 0x07, 0x00, 0x05, 0x92,
+        0x00, 0x96, 0x00, 0x84, 0x07, 0x00, 0x05, 0x92, 0x00, 0x96, 0x00, 0x01, 0x04, 0x06, 0x82, 0x07,
+        0x00, 0x04, 0x92, 0x00, 0x98, 0x00, 0x03, 0x05, 0x07, 0x02, 0x01, 0x92, 0x00,
+};
+const MenuImage tcombi = {48, 39, kMenuImagePalette, false, 0x0000, tcombi_palette, tcombi_rows, tcombi_data};
+
+static const uint16_t temperature_palette[] = {
+        0x0000, 0x18c3, 0x2945, 0x4a69, 0x6b6d, 0x8450, 0xad54, 0xffff,
+};
+static const uint16_t temperature_rows[] = {
+        0, 10, 22, 36, 49, 61, 77, 90, 106, 122, 138, 156,
+        174, 189, 207, 225, 243, 261, 279, 294, 312, 326, 340, 354,
+        368, 382, 397, 413, 427, 441, 454, 467, 481, 497, 512, 526,
+};
+static const uint8_t temperature_data[] = {
+        0x83, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x05, 0x87, 0x00, 0x82, 0x00, 0x06, 0x06, 0x07, 0x07,
+        0x06, 0x07, 0x07, 0x06, 0x86, 0x00, 0x04, 0x00, 0x00, 0x06, 0x07, 0x06, 0x82, 0x00, 0x02, 0x06,
+        0x07, 0x05, 0x85, 0x00, 0x03, 0x00, 0x00, 0x07, 0x07, 0x83, 0x00, 0x02, 0x01, 0x07, 0x06, 0x85,
+        0x00, 0x03, 0x00, 0x00, 0x07, 0x06, 0x84, 0x00, 0x01, 0x07, 0x06, 0x85, 0x00, 0x03, 0x00, 0x00,
+        0x07, 0x06, 0x84, 0x00, 0x03, 0x07, 0x06, 0x00, 0x04, 0x82, 0x05, 0x00, 0x04, 0x03, 0x00, 0x00,
+        0x07, 0x06, 0x84, 0x00, 0x02, 0x07, 0x06, 0x00, 0x84, 0x07, 0x03, 0x00, 0x00, 0x07, 0x06, 0x84,
+        0x00, 0x03, 0x07, 0x06, 0x00, 0x03, 0x82, 0x05, 0x00, 0x03, 0x03, 0x00, 0x00, 0x07, 0x06, 0x84,
+        0x00, 0x07, 0x07, 0x06, 0x00, 0x03, 0x04, 0x04, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x06, 0x84,
+        0x00, 0x02, 0x07, 0x06, 0x00, 0x82, 0x07, 0x01, 0x04, 0x00, 0x10, 0x00, 0x00, 0x07, 0x06, 0x00,
+        0x00, 0x02, 0x00, 0x00, 0x07, 0x06, 0x00, 0x03, 0x04, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x07,
+        0x06, 0x00, 0x06, 0x07, 0x06, 0x00, 0x07, 0x06, 0x00, 0x03, 0x82, 0x05, 0x00, 0x03, 0x0b, 0x00,
+        0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06, 0x00, 0x84, 0x07, 0x0c, 0x00, 0x00,
+        0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06, 0x00, 0x03, 0x82, 0x05, 0x00, 0x04, 0x10,
+        0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06, 0x00, 0x02, 0x05, 0x04, 0x00,
+        0x00, 0x0b, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06, 0x00, 0x82, 0x07,
+        0x01, 0x04, 0x00, 0x10, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06, 0x00,
+        0x04, 0x06, 0x06, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07,
+        0x06, 0x00, 0x01, 0x82, 0x03, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06,
+        0x00, 0x07, 0x06, 0x00, 0x84, 0x07, 0x0c, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00,
+        0x07, 0x06, 0x00, 0x05, 0x82, 0x06, 0x00, 0x05, 0x0a, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07,
+        0x06, 0x00, 0x07, 0x06, 0x85, 0x00, 0x0a, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00,
+        0x07, 0x06, 0x85, 0x00, 0x0a, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06,
+        0x85, 0x00, 0x0a, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06, 0x85, 0x00,
+        0x0a, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x06, 0x85, 0x00, 0x0b, 0x00,
+        0x05, 0x07, 0x06, 0x00, 0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x05, 0x84, 0x00, 0x04, 0x03, 0x07,
+        0x07, 0x02, 0x03, 0x82, 0x07, 0x04, 0x03, 0x03, 0x07, 0x07, 0x01, 0x83, 0x00, 0x03, 0x06, 0x07,
+        0x04, 0x04, 0x84, 0x07, 0x03, 0x03, 0x05, 0x07, 0x05, 0x83, 0x00, 0x03, 0x07, 0x07, 0x00, 0x06,
+        0x84, 0x07, 0x03, 0x06, 0x00, 0x07, 0x06, 0x83, 0x00, 0x02, 0x07, 0x06, 0x00, 0x85, 0x07, 0x03,
+        0x06, 0x00, 0x07, 0x07, 0x83, 0x00, 0x02, 0x07, 0x07, 0x00, 0x85, 0x07, 0x03, 0x06, 0x00, 0x07,
+        0x06, 0x83, 0x00, 0x03, 0x06, 0x07, 0x03, 0x04, 0x84, 0x07, 0x03, 0x04, 0x04, 0x07, 0x06, 0x83,
+        0x00, 0x0c, 0x04, 0x07, 0x06, 0x00, 0x04, 0x07, 0x07, 0x06, 0x04, 0x02, 0x07, 0x07, 0x02, 0x83,
+        0x00, 0x04, 0x00, 0x06, 0x07, 0x06, 0x03, 0x82, 0x00, 0x03, 0x03, 0x07, 0x07, 0x05, 0x84, 0x00,
+        0x02, 0x00, 0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x82, 0x07, 0x00, 0x06, 0x85, 0x00, 0x82, 0x00,
+        0x01, 0x04, 0x06, 0x82, 0x07, 0x01, 0x06, 0x03, 0x86, 0x00,
+};
+const MenuImage temperature = {17, 36, kMenuImagePalette, false, 0x0000, temperature_palette, temperature_rows, temperature_data};
+
+static const uint16_t wifiIndicator_palette[] = {
+        0x0000, 0x1082, 0x18c3, 0x18e3, 0x2124, 0x31a6, 0x39c7, 0x39e7, 0x4208, 0x4228, 0x4a49, 0x4a69,
+        0x52aa, 0x630c, 0x632c, 0x6b4d, 0x738e, 0x7bef, 0x8410, 0x8430, 0x8c51, 0x9492, 0x94b2, 0x9cd3,
+        0xa514, 0xad55, 0xb596, 0xb5b6, 0xbdd7, 0xbdf7, 0xc618, 0xc638, 0xce59, 0xce79, 0xd69a, 0xd6ba,
+        0xdedb, 0xdefb, 0xe71c, 0xe73c, 0xef5d, 0xef7d, 0xf79e, 0xf7be, 0xffdf, 0xffff,
+};
+static const uint16_t wifiIndicator_rows[] = {
+        0, 15, 29, 43, 62, 82, 98, 119, 141, 154, 165, 184,
+        198, 208, 217, 228, 237,
+};
+static const uint8_t wifiIndicator_data[] = {
+        0x86, 0x00, 0x09, 0x0e, 0x19, 0x20, 0x23, 0x27, 0x27, 0x24, 0x20, 0x19, 0x0f, 0x86, 0x00, 0x83,
+        0x00, 0x02, 0x08, 0x1a, 0x28, 0x89, 0x2d, 0x02, 0x29, 0x1b, 0x0a, 0x83, 0x00, 0x04, 0x00, 0x00,
+        0x03, 0x1a, 0x2c, 0x8d, 0x2d, 0x04, 0x2c, 0x1b, 0x04, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x27, 0x85,
+        0x2d, 0x00, 0x27, 0x82, 0x21, 0x01, 0x22, 0x28, 0x85, 0x2d, 0x02, 0x28, 0x0f, 0x00, 0x01, 0x13,
+        0x2b, 0x83, 0x2d, 0x02, 0x25, 0x17, 0x05, 0x85, 0x00, 0x02, 0x08, 0x18, 0x26, 0x83, 0x2d, 0x01,
+        0x2c, 0x14, 0x00, 0x1e, 0x82, 0x2d, 0x01, 0x28, 0x11, 0x8b, 0x00, 0x01, 0x14, 0x29, 0x82, 0x2d,
+        0x00, 0x19, 0x04, 0x00, 0x1f, 0x2d, 0x1e, 0x02, 0x84, 0x00, 0x03, 0x04, 0x10, 0x0f, 0x03, 0x84,
+        0x00, 0x04, 0x06, 0x21, 0x2d, 0x19, 0x00, 0x02, 0x00, 0x00, 0x12, 0x83, 0x00, 0x02, 0x0d, 0x1e,
+        0x29, 0x83, 0x2d, 0x02, 0x28, 0x1c, 0x0c, 0x83, 0x00, 0x02, 0x13, 0x00, 0x00, 0x84, 0x00, 0x01,
+        0x05, 0x1e, 0x88, 0x2d, 0x02, 0x2c, 0x1c, 0x01, 0x84, 0x00, 0x83, 0x00, 0x01, 0x07, 0x27, 0x8b,
+        0x2d, 0x00, 0x25, 0x84, 0x00, 0x84, 0x00, 0x00, 0x1d, 0x82, 0x2d, 0x05, 0x24, 0x19, 0x12, 0x13,
+        0x1a, 0x26, 0x82, 0x2d, 0x00, 0x19, 0x84, 0x00, 0x85, 0x00, 0x02, 0x1d, 0x29, 0x11, 0x85, 0x00,
+        0x02, 0x14, 0x2a, 0x19, 0x85, 0x00, 0x86, 0x00, 0x00, 0x07, 0x87, 0x00, 0x00, 0x06, 0x86, 0x00,
+        0x89, 0x00, 0x03, 0x09, 0x16, 0x15, 0x06, 0x89, 0x00, 0x88, 0x00, 0x05, 0x0d, 0x2c, 0x2d, 0x2d,
+        0x2b, 0x0b, 0x88, 0x00, 0x89, 0x00, 0x03, 0x1b, 0x2d, 0x2d, 0x19, 0x89, 0x00, 0x8a, 0x00, 0x01,
+        0x1a, 0x19, 0x8a, 0x00,
+};
+const MenuImage wifiIndicator = {24, 17, kMenuImagePalette, false, 0x0000, wifiIndicator_palette, wifiIndicator_rows, wifiIndicator_data};
@@ -0,0 +1,510 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+
+#include "MenuWidget.h"
+
+
+static uint16_t scratch[MENU_WIDGET_SCRATCH_PIXELS];
+
+/**
+   Renders into the scratch buffer: display coordinates, clipped to the band the scratch currently holds.
+*/
+class ScratchCanvas : public Adafruit_GFX {
+
+  public:
+    MenuRect band;
+
+    ScratchCanvas(void) : Adafruit_GFX(DISPLAY_W, DISPLAY_H) {
+      band = {0, 0, 0, 0};
+      setTextWrap(false);
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+      x -= band.x;
+      y -= band.y;
+      if (0 <= x && x < band.w && 0 <= y && y < band.h) {
+        scratch[y * band.w + x] = color;
+      }
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      int16_t x0 = max(x, band.x) - band.x;
+      int16_t y0 = max(y, band.y) - band.y;
+      int16_t x1 = min(int16_t(x + w), int16_t(band.x + band.w)) - band.x;
+      int16_t y1 = min(int16_t(y + h), int16_t(band.y + band.h)) - band.y;
+      for (int16_t row = y0; row < y1; ++row) {
+        uint16_t* pixel = &scratch[row * band.w];
+        for (int16_t column = x0; column < x1; ++column) {
+          pixel[column] = color;
+        }
+      }
+    }
+
+    /**
+       Copies a cell of the glyph atlas, set bits in "fgColor".
+    */
+    void drawGlyph(int16_t x, int16_t y, const uint16_t* rows, int16_t w, int16_t h, uint16_t fgColor, uint16_t bgColor) {
+      int16_t x0 = max(x, band.x) - band.x;
+      int16_t y0 = max(y, band.y) - band.y;
+      int16_t x1 = min(int16_t(x + w), int16_t(band.x + band.w)) - band.x;
+      int16_t y1 = min(int16_t(y + h), int16_t(band.y + band.h)) - band.y;
+      for (int16_t row = y0; row < y1; ++row) {
+        uint16_t* pixel = &scratch[row * band.w];
+        uint16_t bits = rows[row + band.y - y];
+        for (int16_t column = x0; column < x1; ++column) {
+          pixel[column] = bits & (1 << (column + band.x - x)) ? fgColor : bgColor;
+        }
+      }
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      fillRect(x, y, w, 1, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      fillRect(x, y, 1, h, color);
+    }
+};
+
+static ScratchCanvas scratchCanvas;
+
+
+const uint8_t GLYPH_COUNT = 96; // ' ' to '~' and the degree sign.
+static uint16_t glyphs[GLYPH_COUNT][MENU_GLYPH_MAX_H]; // Bit n of a row is column n.
+static bool glyphReady[GLYPH_COUNT];
+
+/**
+   Rasterizes a glyph of the default font into a cell of the atlas.
+*/
+class GlyphCanvas : public Adafruit_GFX {
+
+  public:
+    uint16_t* rows;
+    uint8_t w;
+
+    GlyphCanvas(void) : Adafruit_GFX(MENU_GLYPH_MAX_W, MENU_GLYPH_MAX_H) {
+      rows = nullptr;
+      w = 0;
+      setTextWrap(false);
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+      if (0 <= x && x < w && 0 <= y && y < Defaults.getFontH()) {
+        rows[y] |= 1 << x;
+      }
+    }
+};
+
+static GlyphCanvas glyphCanvas;
+
+/**
+   The cell width, i.e. the advance of the monospaced default font, or 0 if its cells don't fit the atlas.
+*/
+static uint8_t getGlyphW(void) {
+        const GFXfont* font = Defaults.getFont();
+        uint8_t w = font->glyph['0' - font->first].xAdvance;
+        return w <= MENU_GLYPH_MAX_W && Defaults.getFontH() <= MENU_GLYPH_MAX_H ? w : 0;
+}
+
+/**
+   Glyphs are rasterized on first use and then only copied. Colors are applied while copying, so one cell serves all
+   color pairs.
+*/
+static const uint16_t* getGlyph(char c) {
+        uint8_t i = 0; // Characters not in the font are blank.
+        if (MENU_LABEL_DEGREE == c) {
+                i = GLYPH_COUNT - 1;
+        } else if (' ' <= c && '~' >= c) {
+                i = c - ' ';
+        }
+        if (!glyphReady[i]) {
+                memset(glyphs[i], 0, sizeof glyphs[i]);
+                glyphCanvas.rows = glyphs[i];
+                glyphCanvas.w = getGlyphW();
+                if (GLYPH_COUNT - 1 == i) {
+                        int16_t y = Defaults.getFontY() - Defaults.getFontH() / 2;
+                        glyphCanvas.drawCircle(glyphCanvas.w / 2, y, 2, 1);
+                        glyphCanvas.drawCircle(glyphCanvas.w / 2, y, 3, 1); // bold
+                } else {
+                        glyphCanvas.setFont(Defaults.getFont());
+                        glyphCanvas.setCursor(0, Defaults.getFontY() + 1);
+                        glyphCanvas.write(c);
+                }
+                glyphReady[i] = true;
+        }
+        return glyphs[i];
+}
+
+/**
+   Character of cell "i", blank behind the end of "s". Call with ascending "i".
+*/
+static inline char getCell(const char* s, uint8_t i, bool& end) {
+        if (!end && '\0' == s[i]) {
+                end = true;
+        }
+        return end ? ' ' : s[i];
+}
+
+
+static void printText(Adafruit_GFX* canvas, const char* s, int16_t x, int16_t y, uint16_t color) {
+        canvas->setFont(Defaults.getFont());
+        canvas->setTextColor(color);
+        canvas->setCursor(x, y + 1);
+        for (; *s; ++s) {
+                if (MENU_LABEL_DEGREE == *s) {
+                        int16_t cursorX = canvas->getCursorX();
+                        canvas->drawCircle(cursorX + Defaults.getFontCharW(), y - Defaults.getFontH() / 2, 2, color);
+                        canvas->drawCircle(cursorX + Defaults.getFontCharW(), y - Defaults.getFontH() / 2, 3, color); // bold
+                        canvas->setCursor(cursorX + Defaults.getFontCharW(), y + 1);
+                } else {
+                        canvas->write(*s);
+                }
+        }
+}
+
+static inline int32_t area(const MenuRect& rect) {
+        return int32_t(rect.w) * rect.h;
+}
+
+static MenuRect unite(const MenuRect& a, const MenuRect& b) {
+        int16_t x = min(a.x, b.x);
+        int16_t y = min(a.y, b.y);
+        return {x, y, int16_t(max(a.x + a.w, b.x + b.w) - x), int16_t(max(a.y + a.h, b.y + b.h) - y)};
+}
+
+static MenuRect intersect(const MenuRect& a, const MenuRect& b) {
+        int16_t x = max(a.x, b.x);
+        int16_t y = max(a.y, b.y);
+        int16_t w = min(a.x + a.w, b.x + b.w) - x;
+        int16_t h = min(a.y + a.h, b.y + b.h) - y;
+        return {x, y, int16_t(max(w, int16_t(0))), int16_t(max(h, int16_t(0)))};
+}
+
+/**
+   Only merge if the union is fully covered by both, e.g. fields stacked in a column, so no pixels outside the dirty
+   widgets (static text) are overwritten.
+*/
+static bool mergeable(const MenuRect& a, const MenuRect& b) {
+        return area(unite(a, b)) == area(a) + area(b) - area(intersect(a, b));
+}
+
+
+MenuWidget::MenuWidget(void) {
+        bounds = {0, 0, 0, 0};
+        dirty = true;
+}
+
+bool MenuWidget::setBounds(int16_t x, int16_t y, int16_t w, int16_t h) {
+        if (bounds.x != x || bounds.y != y || bounds.w != w || bounds.h != h) {
+                bounds = {x, y, w, h};
+                dirty = true;
+                return true;
+        }
+        return false;
+}
+
+
+MenuLabel::MenuLabel(void) {
+        text[0] = '\0';
+        shown[0] = '\0';
+        shownValid = false;
+        length = 0;
+        fgColor = Defaults.getFgColor();
+        bgColor = Defaults.getBgColor();
+}
+
+void MenuLabel::setPosition(uint16_t x, uint16_t y, uint8_t length) {
+        length = min(length, uint8_t(MENU_LABEL_LENGTH - 1));
+        uint8_t w = getGlyphW();
+        if (0 == w) {
+                w = Defaults.getFontCharW();
+        }
+        if (setBounds(x, y - Defaults.getFontY(), length * w + 1, Defaults.getFontH()) || this->length != length) {
+                this->length = length;
+                shownValid = false;
+                dirty = true;
+        }
+}
+
+void MenuLabel::setText(const char* s) {
+        if (0 != strncmp(text, s, sizeof text - 1)) {
+                strncpy(text, s, sizeof text - 1);
+                text[sizeof text - 1] = '\0';
+                dirty = true;
+        }
+}
+
+void MenuLabel::setColors(uint16_t fgColor, uint16_t bgColor) {
+        if (this->fgColor != fgColor || this->bgColor != bgColor) {
+                this->fgColor = fgColor;
+                this->bgColor = bgColor;
+                shownValid = false;
+                dirty = true;
+        }
+}
+
+MenuRect MenuLabel::getDirtyBounds(void) const {
+        uint8_t w = getGlyphW();
+        if (!shownValid || 0 == w) {
+                return bounds;
+        }
+        int16_t first = -1;
+        int16_t last = -1;
+        bool textEnd = false;
+        bool shownEnd = false;
+        for (uint8_t i = 0; i < length; ++i) {
+                if (getCell(text, i, textEnd) != getCell(shown, i, shownEnd)) {
+                        if (0 > first) {
+                                first = i;
+                        }
+                        last = i;
+                }
+        }
+        if (0 > first) {
+                return {bounds.x, bounds.y, 0, 0};
+        }
+        return {int16_t(bounds.x + first * w), bounds.y, int16_t((last - first + 1) * w), bounds.h};
+}
+
+void MenuLabel::invalidate(void) {
+        shownValid = false;
+        dirty = true;
+}
+
+void MenuLabel::clean(void) {
+        strcpy(shown, text);
+        shownValid = true;
+        dirty = false;
+}
+
+void MenuLabel::draw(Adafruit_GFX* canvas) {
+        uint8_t w = getGlyphW();
+        if (&scratchCanvas != canvas || 0 == w) {
+                canvas->fillRect(bounds.x, bounds.y, bounds.w, bounds.h, bgColor);
+                printText(canvas, text, bounds.x, bounds.y + Defaults.getFontY(), fgColor);
+                return;
+        }
+        int16_t x = bounds.x;
+        bool end = false;
+        for (uint8_t i = 0; i < length; ++i, x += w) {
+                scratchCanvas.drawGlyph(x, bounds.y, getGlyph(getCell(text, i, end)), w, bounds.h, fgColor, bgColor);
+        }
+        scratchCanvas.fillRect(x, bounds.y, bounds.x + bounds.w - x, bounds.h, bgColor);
+}
+
+
+MenuNumber::MenuNumber(void) {
+        value = 0;
+        hasValue = false;
+        digits = 1;
+        decimals = 0;
+        sign = false;
+        unit = "";
+}
+
+void MenuNumber::setFormat(uint8_t digits, uint8_t decimals, const char* unit, bool sign) {
+        this->digits = digits;
+        this->decimals = decimals;
+        this->unit = unit;
+        this->sign = sign;
+        hasValue = false;
+}
+
+void MenuNumber::setValue(int32_t value) {
+        if (hasValue && this->value == value) {
+                return;
+        }
+        this->value = value;
+        hasValue = true;
+
+        // Composed from the right: unit, decimals, integer digits, sign, padding.
+        char s[MENU_LABEL_LENGTH];
+        char* p = &s[sizeof s - 1];
+        *p = '\0';
+        uint8_t unitLength = min(strlen(unit), size_t(8));
+        p -= unitLength;
+        memcpy(p, unit, unitLength);
+        uint32_t magnitude = 0 > value ? -value : value;
+        for (uint8_t i = 0; i < decimals; ++i) {
+                *--p = '0' + magnitude % 10;
+                magnitude /= 10;
+        }
+        if (0 < decimals) {
+                *--p = '.';
+        }
+        char* integer = p;
+        do {
+                *--p = '0' + magnitude % 10;
+                magnitude /= 10;
+        } while (0 < magnitude);
+        if (sign || 0 > value) {
+                *--p = 0 > value ? '-' : '+';
+        }
+        while (integer - p < digits + sign && s < p) {
+                *--p = ' ';
+        }
+        setText(p);
+}
+
+
+MenuBar::MenuBar(void) {
+        percent = 0;
+        color = Defaults.getFgColor();
+        bgColor = Defaults.getBgColor();
+}
+
+void MenuBar::setPosition(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        setBounds(x, y, w, h);
+}
+
+void MenuBar::setLevel(uint8_t percent, uint16_t color) {
+        percent = min(percent, (uint8_t) 100);
+        if (this->percent != percent || this->color != color) {
+                this->percent = percent;
+                this->color = color;
+                dirty = true;
+        }
+}
+
+void MenuBar::setBgColor(uint16_t bgColor) {
+        if (this->bgColor != bgColor) {
+                this->bgColor = bgColor;
+                dirty = true;
+        }
+}
+
+void MenuBar::draw(Adafruit_GFX* canvas) {
+        int16_t filled = percent * bounds.h / 100;
+        canvas->fillRect(bounds.x, bounds.y, bounds.w, bounds.h - filled, bgColor);
+        canvas->fillRect(bounds.x, bounds.y + bounds.h - filled, bounds.w, filled, color);
+}
+
+
+MenuGauge::MenuGauge(void) {
+        center = 0;
+        needleH = 0;
+        position = 0;
+        needleColor = Defaults.getIndicatorColor();
+        scaleColor = Defaults.getFgColor();
+}
+
+void MenuGauge::setPosition(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t needleH) {
+        this->needleH = needleH;
+        center = y + h / 2 + 1;
+        setBounds(x, y - needleH / 2, w, h + (needleH / 2) * 2);
+}
+
+void MenuGauge::setNeedle(int16_t position, uint16_t color) {
+        if (this->position != position || needleColor != color) {
+                this->position = position;
+                needleColor = color;
+                dirty = true;
+        }
+}
+
+void MenuGauge::setScaleColor(uint16_t scaleColor) {
+        if (this->scaleColor != scaleColor) {
+                this->scaleColor = scaleColor;
+                dirty = true;
+        }
+}
+
+void MenuGauge::draw(Adafruit_GFX* canvas) {
+        canvas->fillRect(bounds.x, bounds.y, bounds.w, bounds.h, scaleColor);
+        canvas->fillRect(bounds.x, center - needleH / 2 - position, bounds.w, needleH, needleColor);
+}
+
+
+MenuWidgets::MenuWidgets(void) {
+        count = 0;
+}
+
+void MenuWidgets::add(MenuWidget* widget) {
+        if (MENU_WIDGET_MAX_COUNT > count) {
+                widgets[count++] = widget;
+        }
+}
+
+void MenuWidgets::invalidate(void) {
+        for (uint8_t i = 0; i < count; ++i) {
+                widgets[i]->invalidate();
+        }
+}
+
+void MenuWidgets::render(Adafruit_ILI9341* display) {
+        MenuRect rects[MENU_WIDGET_MAX_COUNT];
+        uint8_t rectCount = 0;
+        for (uint8_t i = 0; i < count; ++i) {
+                if (!widgets[i]->isDirty()) {
+                        continue;
+                }
+                MenuRect rect = widgets[i]->getDirtyBounds();
+                widgets[i]->clean();
+                if (0 == area(rect)) {
+                        continue;
+                }
+                // Merging may make the rectangle mergeable with one checked before, so start over after each merge.
+                for (uint8_t j = 0; j < rectCount; ) {
+                        if (mergeable(rects[j], rect)) {
+                                rect = unite(rects[j], rect);
+                                rects[j] = rects[--rectCount];
+                                j = 0;
+                        } else {
+                                ++j;
+                        }
+                }
+                rects[rectCount++] = rect;
+        }
+        for (uint8_t i = 0; i < rectCount; ++i) {
+                renderRect(display, rects[i]);
+        }
+}
+
+void MenuWidgets::renderRect(Adafruit_ILI9341* display, const MenuRect& rect) {
+        MenuRect clipped = intersect(rect, {0, 0, DISPLAY_W, DISPLAY_H});
+        if (0 == area(clipped)) {
+                return;
+        }
+        int16_t bandH = MENU_WIDGET_SCRATCH_PIXELS / clipped.w;
+        for (int16_t y = clipped.y; y < clipped.y + clipped.h; y += bandH) {
+                scratchCanvas.band = {clipped.x, y, clipped.w, int16_t(min(bandH, int16_t(clipped.y + clipped.h - y)))};
+                for (uint8_t i = 0; i < count; ++i) {
+                        if (0 < area(intersect(widgets[i]->getBounds(), scratchCanvas.band))) {
+                                widgets[i]->draw(&scratchCanvas);
+                        }
+                }
+                display->drawRGBBitmap(scratchCanvas.band.x, scratchCanvas.band.y, scratch, scratchCanvas.band.w, scratchCanvas.band.h);
+        }
+}
+
+void MenuWidgets::drawText(Adafruit_ILI9341* display, const char* s, uint16_t x, uint16_t y, uint16_t fgColor, uint16_t bgColor) {
+        int16_t x1, y1;
+        uint16_t w, h;
+        display->getTextBounds(s, 0, 0, &x1, &y1, &w, &h);
+        MenuRect rect = intersect({int16_t(x), int16_t(y - Defaults.getFontY()), int16_t(x1 + w + 1), Defaults.getFontH()}, {0, 0, DISPLAY_W, DISPLAY_H});
+        if (0 == area(rect)) {
+                return;
+        }
+        int16_t bandH = MENU_WIDGET_SCRATCH_PIXELS / rect.w;
+        for (int16_t top = rect.y; top < rect.y + rect.h; top += bandH) {
+                scratchCanvas.band = {rect.x, top, rect.w, int16_t(min(bandH, int16_t(rect.y + rect.h - top)))};
+                scratchCanvas.fillRect(rect.x, top, rect.w, scratchCanvas.band.h, bgColor);
+                printText(&scratchCanvas, s, x, y, fgColor);
+                display->drawRGBBitmap(scratchCanvas.band.x, scratchCanvas.band.y, scratch, scratchCanvas.band.w, scratchCanvas.band.h);
+        }
+}
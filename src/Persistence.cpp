@@ -18,7 +18,7 @@
 #include "Persistence.h"
 
 
-static const uint8_t memorySlotsCount = 8;
+static const uint8_t memorySlotsCount = 13;
 MemorySlot slots[] {
         // start addresses are calculated dynamically in formatEeprom().
         // Every last byte of a slot is used for a crc8 checksum to verify the data.
@@ -31,6 +31,11 @@ MemorySlot slots[] {
         {kPSlotBluetoothPair2, 0x0000, 12},
         {kPSlotBluetoothPair3, 0x0000, 12},
         {kPSlotBluetoothPair4, 0x0000, 12},
+        {kPSlotIbs, 0x0000, 4},
+        {kPSlotIbsEnergy, 0x0000, 33},
+        {kPSlotIbs2, 0x0000, 4},
+        {kPSlotIbsEnergy2, 0x0000, 33},
+        {kPSlotIbs2OnOff, 0x0000, 2},
 };
 
 
@@ -113,6 +118,10 @@ uint8_t Persistence::writeSlot(PersistenceSlot slot, const String* string) {
         return ret_val;
 }
 
+bool Persistence::isSlotValid(PersistenceSlot slot) {
+        return calculateEepromChecksum(slot) == EEPROM.read(slots[slot].addr + slots[slot].length - 1);
+}
+
 bool Persistence::readSlotBoolean(PersistenceSlot slot) {
         uint8_t byte = EEPROM.read(slots[slot].addr);
         if (0x01 == byte) {
@@ -20,10 +20,7 @@
 #include "WiFiController.h"
 
 
-static uint8_t lastStartWifiConfig = 0xff;
-static uint8_t lastWifiOnOff = 0xff;
 static boolean wifiSsidChanged = true;
-static uint8_t lastFactoryReset = 0xff;
 static WiFiControllerLoopState lastWifiState = kWclsIdle;
 
 static uint8_t startWifiConfig = 0;
@@ -34,10 +31,8 @@ static uint16_t wifiOnOffX = 0;
 static uint16_t wifiOnOffY = 0;
 static uint16_t wifiStartWifiConfigX = 0;
 static uint16_t wifiStartWifiConfigY = 0;
-static uint16_t wifiSsidX = 0;
-static uint16_t wifiSsidY = 0;
-static uint16_t wifiIpX = 0;
-static uint16_t wifiIpY = 0;
+static uint16_t ibs2OnOffX = 0;
+static uint16_t ibs2OnOffY = 0;
 static uint16_t factoryResetX = 0;
 static uint16_t factoryResetY = 0;
 
@@ -59,10 +54,10 @@ void SetupMenu::printScreenImplementation(void) {
         wifiStartWifiConfigX = adaIli9431->getCursorX(); wifiStartWifiConfigY = adaIli9431->getCursorY();
         adaIli9431->println();
         adaIli9431->println("WiFi SSID: "); // SSID starts in new line since length exceeds display width.
-        wifiSsidX = adaIli9431->getCursorX(); wifiSsidY = adaIli9431->getCursorY();
+        wifiSsid.setPosition(adaIli9431->getCursorX(), adaIli9431->getCursorY(), 28);
         adaIli9431->println();
         adaIli9431->print ("WiFi IP: ");
-        wifiIpX = adaIli9431->getCursorX(); wifiIpY = adaIli9431->getCursorY();
+        wifiIp.setPosition(adaIli9431->getCursorX(), adaIli9431->getCursorY(), 15);
         adaIli9431->println();
         adaIli9431->println("Paired Bluetooth devices:");
         adaIli9431->print("  #1: ");
@@ -71,11 +66,14 @@ void SetupMenu::printScreenImplementation(void) {
         adaIli9431->println(Persistence::getInstance().readSlot(kPSlotBluetoothPair2));
         adaIli9431->print("  #3: ");
         adaIli9431->println(Persistence::getInstance().readSlot(kPSlotBluetoothPair3));
+        adaIli9431->print("Battery 2: ");
+        ibs2OnOffX = adaIli9431->getCursorX(); ibs2OnOffY = adaIli9431->getCursorY();
         adaIli9431->println();
         adaIli9431->print("Factory reset: ");
         factoryResetX = adaIli9431->getCursorX(); factoryResetY = adaIli9431->getCursorY();
 
         wifiOnOff = Persistence::getInstance().readSlotBoolean(kPSlotWiFiOnOff);
+        ibs2OnOff = ibsBank && ibsBank->isEnabled(1);
         startWifiConfig = 0;
         factoryReset = 0;
 
@@ -83,15 +81,8 @@ void SetupMenu::printScreenImplementation(void) {
 }
 
 void SetupMenu::updateScreenImplementation(void) {
-        if (lastWifiOnOff != wifiOnOff) {
-                updateWifiOnOff(wifiOnOffX, wifiOnOffY, wifiOnOff, menuEntered && selectionFocus.at(0), itemSelected);
-                lastWifiOnOff = wifiOnOff;
-        }
-
-        if (lastStartWifiConfig != startWifiConfig) {
-                updateWifiSmartConfig(wifiStartWifiConfigX, wifiStartWifiConfigY, startWifiConfig, menuEntered && selectionFocus.at(1), itemSelected);
-                lastStartWifiConfig = startWifiConfig;
-        }
+        updateWifiOnOff(wifiOnOffX, wifiOnOffY, wifiOnOff, menuEntered && selectionFocus.at(0), itemSelected);
+        updateWifiSmartConfig(wifiStartWifiConfigX, wifiStartWifiConfigY, startWifiConfig, menuEntered && selectionFocus.at(1), itemSelected);
 
         WiFiControllerLoopState wifiState = WiFiController::getInstance().getState();
         if (lastWifiState != wifiState) {
@@ -99,21 +90,17 @@ void SetupMenu::updateScreenImplementation(void) {
                 lastWifiState = wifiState;
         }
         if (wifiSsidChanged) {
-                adaIli9431->setCursor(wifiSsidX, wifiSsidY);
+                // Reading the SSID and IP creates Strings, so only when something changed.
                 if (runningWifiConfig) {
-                        snprintf(string, sizeof string, "%-28s", "Now run mobile App.");
-                        updateDisplayText(string, wifiSsidX, wifiSsidY, Defaults.getFgColor(), Defaults.getBgColor());
+                        wifiSsid.setText("Now run mobile App.");
                 } else if (1 == startWifiConfig) {
-                        snprintf(string, sizeof string, "%-28s", "Press to (re-) configure.");
-                        updateDisplayText(string, wifiSsidX, wifiSsidY, Defaults.getFgColor(), Defaults.getBgColor());
+                        wifiSsid.setText("Press to (re-) configure.");
                 } else if (kWclsWifiUpAndRunning == WiFiController::getInstance().getState()) {
-                        snprintf(string, sizeof string, "%-28s", Persistence ::getInstance().readSlot(kPSlotWiFiSsid).c_str());
-                        updateDisplayText(string, wifiSsidX, wifiSsidY, Defaults.getFgColor(), Defaults.getBgColor());
-                        updateDisplayText(WiFiController::getInstance().getIpAddr().c_str(), wifiIpX, wifiIpY, Defaults.getFgColor(), Defaults.getBgColor());
+                        wifiSsid.setText(Persistence ::getInstance().readSlot(kPSlotWiFiSsid).c_str());
+                        wifiIp.setText(WiFiController::getInstance().getIpAddr().c_str());
                 } else {
-                        snprintf(string, sizeof string, "%-28s", "unconfigured / disconnected");
-                        updateDisplayText(string, wifiSsidX, wifiSsidY, Defaults.getFgColor(), Defaults.getBgColor());
-                        updateDisplayText("n/a", wifiIpX, wifiIpY, Defaults.getFgColor(), Defaults.getBgColor());
+                        wifiSsid.setText("unconfigured / disconnected");
+                        wifiIp.setText("n/a");
                 }
                 wifiSsidChanged = false;
         }
@@ -137,10 +124,10 @@ void SetupMenu::updateScreenImplementation(void) {
                 }
         }
 
-        if (lastFactoryReset != factoryReset) {
-                updateFactoryReset(factoryResetX, factoryResetY, factoryReset, menuEntered && selectionFocus.at(2), itemSelected);
-                lastFactoryReset = factoryReset;
-        }
+        updateIbs2OnOff(ibs2OnOffX, ibs2OnOffY, ibs2OnOff, menuEntered && selectionFocus.at(2), itemSelected);
+        updateFactoryReset(factoryResetX, factoryResetY, factoryReset, menuEntered && selectionFocus.at(3), itemSelected);
+
+        widgets.render(adaIli9431);
 }
 
 void SetupMenu::updateWifiOnOff(uint16_t x, uint16_t y, uint8_t onOff, boolean highlighted, boolean selected) {
@@ -163,7 +150,9 @@ void SetupMenu::updateWifiOnOff(uint16_t x, uint16_t y, uint8_t onOff, boolean h
                         bgColor = Defaults.getBgHlSelectedColor();
                 }
         }
-        updateDisplayText(string, x, y, fgColor, bgColor); // wifiOnOff
+        wifiOnOffLabel.setPosition(x, y, 3);
+        wifiOnOffLabel.setText(string);
+        wifiOnOffLabel.setColors(fgColor, bgColor);
 }
 
 void SetupMenu::updateWifiSmartConfig(uint16_t x, uint16_t y, uint8_t start, boolean highlighted, boolean selected) {
@@ -183,7 +172,34 @@ void SetupMenu::updateWifiSmartConfig(uint16_t x, uint16_t y, uint8_t start, boo
                         bgColor = Defaults.getBgHlSelectedColor();
                 }
         }
-        updateDisplayText(string, x, y, fgColor, bgColor); // startWifiConfig
+        startWifiConfigLabel.setPosition(x, y, 3);
+        startWifiConfigLabel.setText(string);
+        startWifiConfigLabel.setColors(fgColor, bgColor);
+}
+
+void SetupMenu::updateIbs2OnOff(uint16_t x, uint16_t y, uint8_t onOff, boolean highlighted, boolean selected) {
+        switch (onOff) {
+        case 1:
+                snprintf(string, sizeof string, " on");
+                break;
+        case 0:
+        default:
+                snprintf(string, sizeof string, "off");
+                break;
+        }
+        uint16_t fgColor = Defaults.getFgColor();
+        uint16_t bgColor = Defaults.getBgColor();
+        if (highlighted) {
+                fgColor = Defaults.getFgHighlightColor();
+                if (!selected) {
+                        bgColor = Defaults.getBgHighlightColor();
+                } else {
+                        bgColor = Defaults.getBgHlSelectedColor();
+                }
+        }
+        ibs2OnOffLabel.setPosition(x, y, 3);
+        ibs2OnOffLabel.setText(string);
+        ibs2OnOffLabel.setColors(fgColor, bgColor);
 }
 
 void SetupMenu::updateFactoryReset(uint16_t x, uint16_t y, uint8_t reset, boolean highlighted, boolean selected) {
@@ -202,7 +218,9 @@ void SetupMenu::updateFactoryReset(uint16_t x, uint16_t y, uint8_t reset, boolea
                         bgColor = Defaults.getBgHlSelectedColor();
                 }
         }
-        updateDisplayText(string, x, y, fgColor, bgColor); // factory reset
+        factoryResetLabel.setPosition(x, y, 3);
+        factoryResetLabel.setText(string);
+        factoryResetLabel.setColors(fgColor, bgColor);
 }
 
 void SetupMenu::onEnterButtonImplementation(void) {
@@ -234,7 +252,9 @@ void SetupMenu::inputLeft(void) {
                         wifiOnOff = 0; // off
                 } else if (1 == selectionIndex) { // WiFi Smart Config
                         startWifiConfig = 0; // ---
-                } else if (2 == selectionIndex) { // Factory Reset
+                } else if (2 == selectionIndex) { // Battery 2 on/off
+                        ibs2OnOff = 0; // off
+                } else if (3 == selectionIndex) { // Factory Reset
                         factoryReset = 0; // ---
                 }
         } else {
@@ -253,7 +273,9 @@ void SetupMenu::inputRight(void) {
                         wifiOnOff = 1; // on
                 } else if (1 == selectionIndex) { // WiFi Smart Config
                         startWifiConfig = 1; // yes
-                } else if (2 == selectionIndex) { // Factory Reset
+                } else if (2 == selectionIndex) { // Battery 2 on/off
+                        ibs2OnOff = 1; // on
+                } else if (3 == selectionIndex) { // Factory Reset
                         factoryReset = 1; // yes
                 }
         } else {
@@ -270,6 +292,9 @@ void SetupMenu::inputPush(void) {
         if (itemSelected) {
                 itemSelected = false;
                 Persistence::getInstance().writeSlotBoolean(kPSlotWiFiOnOff, wifiOnOff);
+                if (ibsBank) {
+                        ibsBank->setEnabled(1, 1 == ibs2OnOff);
+                }
                 if (0 == wifiOnOff) {
                         WiFiController::getInstance().start(); // Force WiFi going down if it was enabled before.
                 }
@@ -289,17 +314,14 @@ void SetupMenu::inputPush(void) {
 }
 
 void SetupMenu::updateSelectionFocus(void) {
-        // 1.: WiFi on/off, 2.: WiFi SSID, 3.: Factory Reset
+        // 1.: WiFi on/off, 2.: WiFi SSID, 3.: Battery 2 on/off, 4.: Factory Reset
         selectionFocus.clear();
-        selectionFocus.assign(3, false);
+        selectionFocus.assign(4, false);
         selectionFocus.at(selectionIndex) = true;
         forceUpdateDisplay();
 }
 
 void SetupMenu::forceUpdateDisplay(void) {
-        lastStartWifiConfig = 0xff;
-        lastWifiOnOff = 0xff;
         wifiSsidChanged = true;
-        lastFactoryReset = 0xff;
         lastWifiState = kWclsIdle;
 }
@@ -26,6 +26,9 @@ static uint64_t smartConfigStartTime = 0;
 
 void WiFiController::setup(void) {
         Serial.println("WiFiController::setup()");
+        // The clock survives deep sleep, so local time is right before WiFi is up again.
+        setenv("TZ", LOCAL_TIME_ZONE, 1);
+        tzset();
         WiFi.disconnect(/* wifioff */ true, /* eraseap */ true);
         changeLoopState(kWclsIdle);
 }
@@ -122,6 +125,7 @@ bool WiFiController::loop(void) {
                                 Persistence::getInstance().writeSlot(kPSlotWiFiPassword, &psk);
                         }
                         setupOtaUpdate();
+                        configTzTime(LOCAL_TIME_ZONE, NTP_SERVER); // SNTP sets the clock and keeps it in sync.
                         changeLoopState(kWclsWifiUpAndRunning);
                 } else if ((currentTime - lastLoopStateChange) > 16000) {
                         Serial.println("WiFi does not connect in time, start retrying...");
@@ -17,12 +17,9 @@
 
 #include "debug.h"
 
-#define WEB_SERVER_ENABLED true
-
 RemoteDebug Debug;
 
 #ifdef WEB_SERVER_ENABLED
-#include <WebServer.h>
 WebServer HTTPServer(80);
 
 /////////// Handles
@@ -20,6 +20,16 @@
 
 void print_wakeup_reason(void);
 void setupDevices(void);
+#ifdef WEB_SERVER_ENABLED
+bool refuseStateChangeByGet(const char* arg, const char* arg2 = 0);
+void handleLinCapture(void);
+void handleLinStats(void);
+void handleIbsEnergy(void);
+#ifdef LIN_SIMULATION
+void handleLinReplay(void);
+void handleLinReplayUpload(void);
+#endif
+#endif
 
 bool sleeping = false;
 bool remoteDebugSetupDone = false;
@@ -46,7 +56,25 @@ const uint8_t LIN_TXE_PIN = 15;
 const uint32_t LIN_BAUDRATE = 19200;
 const uint8_t LIN_TX_PIN = 17;
 const uint8_t LIN_RX_PIN = 16;
+#ifdef LIN_SIMULATION
+#include "HellaIbsSimulator.h"
+#ifndef LIN_SIMULATION_IBS
+#define LIN_SIMULATION_IBS 0 // Index into ibs[] of the simulated IBS.
+#endif
+LinBusSimulator linBus;
+HellaIbsSimulator simulatedIbs{&ibs[LIN_SIMULATION_IBS], 0x03};
+#ifdef LIN_SIMULATION_IBS2
+HellaIbsSimulator simulatedIbs2{&ibs[LIN_SIMULATION_IBS2], 0x03}; // Needs a variant on another NAD than the first one.
+#endif
+#include "LinCaptureReplay.h"
+LinCaptureReplay linReplay; // Answers ahead of the simulated IBS while a capture is replayed, see /lin/replay.
+LinDriver linDriver{&linBus, LIN_TXE_PIN, LIN_RX_PIN, LIN_TX_PIN, LIN_BAUDRATE};
+#else
 LinDriver linDriver{&Serial2, LIN_TXE_PIN, LIN_RX_PIN, LIN_TX_PIN, LIN_BAUDRATE};
+#endif
+LinCapture linCapture; // Static, recording must never allocate.
+#include "LinBusArbiter.h"
+LinBusArbiter linArbiter{&linDriver}; // All LIN device drivers share the bus through this one.
 
 
 //######################################
@@ -59,6 +87,14 @@ const uint8_t TFT_PIN_RST = 25; // D4 for RELEASE mode, -1 for DEBUG RST: LCD re
 const uint8_t TFT_PIN_BL = 26;  // Backlight On/Off.
 const uint8_t TFT_PIN_PWR = 27;  // Power supply for the TFT (direct driven). Choose zero for external powered TFT unit.
 GfxMenu gfxMenu{TFT_PIN_CS, TFT_PIN_DCX, TFT_PIN_RST, TFT_PIN_BL, TFT_PIN_PWR}; // FIXME: Static use of GfxMenu here, new GfxMenu(...) does not seem to work here, display does not initialize. :-/
+#include "DisplayStream.h"
+
+// Runs between the chunks of a large display transfer: keeps the LIN schedule going and lets WiFi run.
+void serviceDisplayStream(void* context) {
+        linArbiter.loop();
+        gfxMenu.getIbsBank().loop();
+        yield();
+}
 
 //######################################
 #include "MultiSensor.h"
@@ -127,7 +163,17 @@ void setupDevices(void) {
         WiFiController::getInstance().setup();
         WiFiController::getInstance().start();
 
-        gfxMenu.setup(&linDriver);
+#ifdef LIN_SIMULATION
+        linBus.attach(&linReplay);
+        linBus.attach(&simulatedIbs);
+#ifdef LIN_SIMULATION_IBS2
+        linBus.attach(&simulatedIbs2);
+#endif
+#endif
+        linDriver.setCapture(&linCapture);
+        linDriver.setAdaptiveTimeouts(true);
+        DisplayStream::getInstance().setService(serviceDisplayStream, 0);
+        gfxMenu.setup(&linArbiter);
 
         powerSaver.setup(300, 30, powerSaveReturnMenu, powerSaveSleep);
 
@@ -214,6 +260,13 @@ void loop(void)
 
 #ifdef WEB_SERVER_ENABLED
                 HTTPServer.on("/", handleRoot);
+                HTTPServer.on("/lin/capture", handleLinCapture);
+                HTTPServer.on("/lin/stats", handleLinStats);
+                HTTPServer.on("/ibs/energy", handleIbsEnergy);
+#ifdef LIN_SIMULATION
+                HTTPServer.on("/lin/replay", HTTP_GET, handleLinReplay);
+                HTTPServer.on("/lin/replay", HTTP_POST, handleLinReplay, handleLinReplayUpload);
+#endif
                 HTTPServer.onNotFound(handleNotFound);
                 HTTPServer.begin();
 #endif
@@ -232,6 +285,8 @@ void loop(void)
 
         Persistence::getInstance().loop();
 
+        linArbiter.loop();
+
         gfxMenu.loop();
 
         powerSaver.loop();
@@ -242,6 +297,155 @@ void loop(void)
 }
 
 
+//##############################################################################
+#ifdef WEB_SERVER_ENABLED
+/**
+   The web server has no authentication, arguments that change state are only taken from POST requests so a link,
+   a crawler or a browser prefetch cannot trigger them. Answers a GET carrying "arg" or "arg2" with 405.
+   @return true if the request has been refused.
+ */
+bool refuseStateChangeByGet(const char* arg, const char* arg2) {
+        if (HTTP_POST == HTTPServer.method() || !(HTTPServer.hasArg(arg) || (arg2 && HTTPServer.hasArg(arg2)))) {
+                return false;
+        }
+        HTTPServer.sendHeader("Allow", "POST");
+        HTTPServer.send(405, "text/plain", "Changes need a POST request.\n");
+        return true;
+}
+
+/**
+   Hands out everything captured on the LIN bus since the last call as LinCaptureHeader plus LinCaptureRecords
+   (see LinCapture.h). POST "?monitor=1" switches the driver into passive monitor mode, "?monitor=0" back to master mode.
+   e.g.: curl -X POST -o lin.bin "http://rvsmartcontrol/lin/capture?monitor=1"
+ */
+void handleLinCapture(void) {
+        if (refuseStateChangeByGet("monitor")) {
+                return;
+        }
+        if (HTTPServer.hasArg("monitor")) {
+                linDriver.setMonitorMode(0 != HTTPServer.arg("monitor").toInt());
+        }
+        LinCaptureHeader header;
+        uint16_t count = linCapture.beginExport(&header, linDriver.baudrate);
+        HTTPServer.setContentLength(sizeof header + count * sizeof(LinCaptureRecord));
+        HTTPServer.send(200, "application/octet-stream", "");
+        HTTPServer.sendContent_P((const char*)&header, sizeof header);
+
+        LinCaptureRecord chunk[64];
+        while (0 < count) {
+                uint16_t n = linCapture.read(chunk, min(count, (uint16_t)(sizeof chunk / sizeof chunk[0])));
+                if (0 == n) {
+                        break;
+                }
+                HTTPServer.sendContent_P((const char*)chunk, n * sizeof(LinCaptureRecord));
+                count -= n;
+        }
+}
+
+/**
+   Per frame ID health as plain text table, POST "?reset=1" clears the counters after printing them.
+   Latency columns count first response bytes below 250, 500, 1000 ... 16000 uSec and above.
+ */
+void handleLinStats(void) {
+        if (refuseStateChangeByGet("reset")) {
+                return;
+        }
+        String message = "id  req   resp  tmo   inc   cks   echo  habt  rx/expected  latency\n";
+        char line[120];
+        for (uint8_t id = 0; id < 64; ++id) {
+                const LinFrameStats& stats = linDriver.getFrameStats(id);
+                if (0 == stats.requests) {
+                        continue;
+                }
+                snprintf(line, sizeof line, "%02X  %-5u %-5u %-5u %-5u %-5u %-5u %-5u %u/%u ", id, stats.requests, stats.responses, stats.timeouts,
+                         stats.incomplete, stats.checksumErrors, stats.echoBytes, stats.headerAborts, stats.bytesReceived, stats.bytesExpected);
+                message.concat(line);
+                for (uint8_t bucket = 0; bucket < LIN_LATENCY_BUCKETS; ++bucket) {
+                        snprintf(line, sizeof line, " %u", stats.latency[bucket]);
+                        message.concat(line);
+                }
+                message.concat("\n");
+        }
+        if (HTTPServer.hasArg("reset")) {
+                linDriver.resetFrameStats();
+        }
+        HTTPServer.send(200, "text/plain", message);
+}
+
+/**
+   Charged and discharged Ah and Wh per battery and combined as plain text table,
+   POST "?reset=day|trip|total" clears that period of all batteries after printing it.
+ */
+void handleIbsEnergy(void) {
+        if (refuseStateChangeByGet("reset")) {
+                return;
+        }
+        static const char* periodNames[kIbsPeriodCount] = {"day", "trip", "total"};
+        IbsBank& ibsBank = gfxMenu.getIbsBank();
+        String message = "battery  period  in Ah     out Ah    in Wh      out Wh\n";
+        char line[120];
+        for (uint8_t i = 0; i <= ibsBank.getCount(); ++i) {
+                for (uint8_t period = 0; period < kIbsPeriodCount; ++period) {
+                        IbsEnergyTotals totals = i < ibsBank.getCount()
+                                                 ? ibsBank.getIbs(i)->getEnergyCounter().getTotals((IbsEnergyPeriod) period)
+                                                 : ibsBank.getTotals((IbsEnergyPeriod) period);
+                        char name[8];
+                        snprintf(name, sizeof name, i < ibsBank.getCount() ? "%u" : "all", i + 1);
+                        snprintf(line, sizeof line, "%-8s %-7s %-9.2f %-9.2f %-10.1f %-10.1f\n", name, periodNames[period],
+                                 totals.chargedCharge / 3600000000.0, totals.dischargedCharge / 3600000000.0,
+                                 totals.chargedEnergy / 3600000000000.0, totals.dischargedEnergy / 3600000000000.0);
+                        message.concat(line);
+                }
+        }
+        if (HTTPServer.hasArg("reset")) {
+                for (uint8_t period = 0; period < kIbsPeriodCount; ++period) {
+                        if (HTTPServer.arg("reset") == periodNames[period]) {
+                                ibsBank.resetTotals((IbsEnergyPeriod) period);
+                        }
+                }
+        }
+        HTTPServer.send(200, "text/plain", message);
+}
+
+#ifdef LIN_SIMULATION
+/**
+   Replay a capture exported by /lin/capture into the simulated bus, e.g.
+   "curl -F capture=@vehicle.linc 'http://<ip>/lin/replay?speed=10'". The simulated IBS keeps answering the diagnostic
+   requests, so detection works as usual. POST "?stop=1" ends the replay, POST "?speed=n" restarts it n times faster than
+   real time. GET reports the replay state.
+ */
+void handleLinReplay(void) {
+        if (refuseStateChangeByGet("stop", "speed")) {
+                return;
+        }
+        if (HTTPServer.hasArg("stop")) {
+                linReplay.stop();
+        } else if (HTTPServer.hasArg("speed") || HTTP_POST == HTTPServer.method()) {
+                uint8_t speed = HTTPServer.hasArg("speed") ? constrain(HTTPServer.arg("speed").toInt(), 1, 255) : 1;
+                if (!linReplay.start(speed)) {
+                        HTTPServer.send(400, "text/plain", "No valid capture loaded.\n");
+                        return;
+                }
+        }
+        char message[160];
+        snprintf(message, sizeof message, "running %u\nrecords %u\nposition %llu us\nreplayed %u\nsilent %u\n",
+                 linReplay.isRunning(), linReplay.getRecordCount(), linReplay.getPosition(),
+                 linReplay.getReplayedCount(), linReplay.getSilentCount());
+        HTTPServer.send(200, "text/plain", message);
+}
+
+void handleLinReplayUpload(void) {
+        HTTPUpload& upload = HTTPServer.upload();
+        if (UPLOAD_FILE_START == upload.status) {
+                linReplay.stop();
+                linReplay.clear();
+        } else if (UPLOAD_FILE_WRITE == upload.status) {
+                linReplay.load(upload.buf, upload.currentSize);
+        }
+}
+#endif
+#endif
+
 //##############################################################################
 // Power save functions
 
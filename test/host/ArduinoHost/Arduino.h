@@ -0,0 +1,118 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef ARDUINO_HOST_H_
+#define ARDUINO_HOST_H_
+
+/**
+   Just enough of the Arduino core to build the LIN and IBS modules for the "native" environment (see platformio.ini).
+   Time is virtual: every micros() or millis() call advances the clock by one tick, delay() jumps ahead. A polling loop
+   thus runs in simulated time as fast as the host allows, and results do not depend on the host's load.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT 0x01
+#define OUTPUT 0x02
+
+#define SERIAL_8N1 0x800001c
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+using std::min;
+using std::max;
+
+unsigned long micros(void);
+unsigned long millis(void);
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield(void);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+// Virtual clock control for the tests.
+void hostSetTick(unsigned long tick); // uSec per micros()/millis() call, 1 by default.
+void hostAdvance(unsigned long us);
+uint64_t hostTime(void);              // uSec, does not advance the clock.
+
+
+class String : public std::string {
+  public:
+    String(void) {}
+    String(const char* s) : std::string(s ? s : "") {}
+    String(const std::string& s) : std::string(s) {}
+    String(int value) : std::string(std::to_string(value)) {}
+    String(unsigned int value) : std::string(std::to_string(value)) {}
+    String(long value) : std::string(std::to_string(value)) {}
+    String(unsigned long value) : std::string(std::to_string(value)) {}
+
+    inline unsigned int length(void) const {
+      return size();
+    }
+    inline bool concat(const String& s) {
+      append(s);
+      return true;
+    }
+    inline int toInt(void) const {
+      return atoi(c_str());
+    }
+};
+
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t data) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str) {
+      return write((const uint8_t*) str, strlen(str));
+    }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char* str);
+    size_t print(const String& str);
+    size_t print(long value);
+    size_t println(void);
+    size_t println(const char* str);
+    size_t println(const String& str);
+    size_t println(long value);
+};
+
+#include "Stream.h"
+#include "HardwareSerial.h"
+
+#endif // ARDUINO_HOST_H_
@@ -0,0 +1,120 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "RemoteDebug.h"
+#include <stdarg.h>
+
+
+static uint64_t now = 0; // uSec
+static unsigned long tick = 1;
+
+unsigned long micros(void) {
+        now += tick;
+        return (unsigned long) now;
+}
+
+unsigned long millis(void) {
+        now += tick;
+        return (unsigned long) (now / 1000);
+}
+
+void delay(uint32_t ms) {
+        now += 1000ULL * ms;
+}
+
+void delayMicroseconds(uint32_t us) {
+        now += us;
+}
+
+void yield(void) {
+        now += tick;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+}
+
+void hostSetTick(unsigned long tick) {
+        ::tick = max(tick, 1UL);
+}
+
+void hostAdvance(unsigned long us) {
+        now += us;
+}
+
+uint64_t hostTime(void) {
+        return now;
+}
+
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+                n += write(*buffer++);
+        }
+        return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+        char buffer[256];
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(buffer, sizeof buffer, format, args);
+        va_end(args);
+        if (0 > length) {
+                return 0;
+        }
+        return write((const uint8_t*) buffer, min((size_t) length, sizeof buffer - 1));
+}
+
+size_t Print::print(const char* str) {
+        return write(str);
+}
+
+size_t Print::print(const String& str) {
+        return write(str.c_str());
+}
+
+size_t Print::print(long value) {
+        return printf("%ld", value);
+}
+
+size_t Print::println(void) {
+        return write("\r\n");
+}
+
+size_t Print::println(const char* str) {
+        return print(str) + println();
+}
+
+size_t Print::println(const String& str) {
+        return print(str) + println();
+}
+
+size_t Print::println(long value) {
+        return print(value) + println();
+}
+
+
+HardwareSerial Serial(0);
+HardwareSerial Serial2(2);
+EEPROMClass EEPROM;
+RemoteDebug Debug;
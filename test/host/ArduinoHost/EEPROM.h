@@ -0,0 +1,48 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef ARDUINO_HOST_EEPROM_H_
+#define ARDUINO_HOST_EEPROM_H_
+
+#include "Arduino.h"
+
+// Erased flash, kept in RAM for the lifetime of the test.
+class EEPROMClass {
+  private:
+    uint8_t data[4096];
+
+  public:
+    EEPROMClass(void) {
+      memset(data, 0xff, sizeof data);
+    }
+    bool begin(size_t size) {
+      return size <= sizeof data;
+    }
+    uint8_t read(int address) {
+      return data[address];
+    }
+    void write(int address, uint8_t value) {
+      data[address] = value;
+    }
+    bool commit(void) {
+      return true;
+    }
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // ARDUINO_HOST_EEPROM_H_
@@ -0,0 +1,53 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef ARDUINO_HOST_HARDWARE_SERIAL_H_
+#define ARDUINO_HOST_HARDWARE_SERIAL_H_
+
+#include "Arduino.h"
+
+/**
+   Console output goes to stdout, nothing is ever received.
+*/
+class HardwareSerial : public Stream {
+  public:
+    HardwareSerial(int uartNr) {}
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1) {}
+    void end(void) {}
+    void updateBaudRate(unsigned long baud) {}
+    int available(void) {
+      return 0;
+    }
+    int read(void) {
+      return -1;
+    }
+    int peek(void) {
+      return -1;
+    }
+    size_t write(uint8_t data) {
+      return fwrite(&data, 1, 1, stdout);
+    }
+    size_t write(const uint8_t* buffer, size_t size) {
+      return fwrite(buffer, 1, size, stdout);
+    }
+    using Print::write;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial2;
+
+#endif // ARDUINO_HOST_HARDWARE_SERIAL_H_
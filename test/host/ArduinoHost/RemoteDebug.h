@@ -0,0 +1,32 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+#ifndef ARDUINO_HOST_REMOTE_DEBUG_H_
+#define ARDUINO_HOST_REMOTE_DEBUG_H_
+
+#include "Arduino.h"
+
+// Telnet debugging is not available on the host, output is dropped.
+class RemoteDebug : public Print {
+  public:
+    size_t write(uint8_t data) {
+      return 1;
+    }
+    using Print::write;
+};
+
+#endif // ARDUINO_HOST_REMOTE_DEBUG_H_
@@ -0,0 +1,195 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+/**
+   Worst case main loop stall of the LinDriver while a slave does not answer or stops in the middle of its response:
+   the blocking recv() holds the caller for the whole response timeout, recvAsync() plus loop() only for microseconds.
+   Also checks that responses get through only with the UART RX FIFO thresholds begin() programs, and that a late
+   loop() restarts the header instead of stretching it.
+   pio test -e native -f test_native_lin_driver -v
+*/
+
+#include <unity.h>
+#include <stdarg.h>
+#include "LinDriver.h"
+
+
+// Answers frame 0x22 with 8 bytes, or stalls: silent, or cut off before the checksum.
+class TestSlave : public LinSimSlave {
+  public:
+    bool silent = false;
+    bool cutOff = false;
+    unsigned long responseDelay = 200;
+
+    uint8_t publish(uint8_t id, uint8_t* data) {
+      if (0x22 != id || silent) {
+        return 0;
+      }
+      for (uint8_t i = 0; i < 8; ++i) {
+        data[i] = 0x10 + i;
+      }
+      return 8;
+    }
+
+    int16_t getChecksum(uint8_t checksum) {
+      return cutOff ? -1 : checksum;
+    }
+
+    void subscribe(uint8_t id, const uint8_t* data, uint8_t nBytes) {
+    }
+
+    unsigned long getResponseDelay(void) {
+      return responseDelay;
+    }
+};
+
+static LinBusSimulator linBus;
+static TestSlave slave;
+static LinDriver linDriver(&linBus, 15, 16, 17, 19200);
+
+static uint8_t message[8];
+static uint8_t callbackResult;
+static uint8_t callbackCount;
+
+static void report(const char* format, ...) {
+        char text[160];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(text, sizeof text, format, args);
+        va_end(args);
+        TEST_MESSAGE(text);
+}
+
+static void onRecv(void* context, uint8_t addr, uint8_t* message, uint8_t result) {
+        callbackResult = result;
+        ++callbackCount;
+}
+
+// uSec the caller is held by a blocking recv().
+static unsigned long blockingStall(void) {
+        uint64_t start = hostTime();
+        linDriver.recv(0x22, message, sizeof message);
+        return hostTime() - start;
+}
+
+// Longest single recvAsync()/loop() call in uSec until the request completed.
+static unsigned long asyncStall(void) {
+        unsigned long worst = 0;
+        uint64_t start = hostTime();
+        callbackCount = 0;
+        linDriver.recvAsync(0x22, message, sizeof message, 2, onRecv, 0);
+        worst = hostTime() - start;
+        while (linDriver.isBusy()) {
+                start = hostTime();
+                linDriver.loop();
+                worst = max(worst, (unsigned long) (hostTime() - start));
+        }
+        return worst;
+}
+
+
+void setUp(void) {
+        slave.silent = false;
+        slave.cutOff = false;
+        hostAdvance(10000); // Bus idle between the tests.
+}
+
+void tearDown(void) {
+}
+
+void test_response(void) {
+        unsigned long worst = asyncStall();
+        report("answered: worst loop() %lu us, result 0x%02x", worst, callbackResult);
+        TEST_ASSERT_EQUAL_UINT8(1, callbackCount);
+        TEST_ASSERT_EQUAL_UINT8(0xff, callbackResult);
+        TEST_ASSERT_EQUAL_UINT8(0x17, message[7]);
+}
+
+void test_silent_slave(void) {
+        slave.silent = true;
+        unsigned long blocking = blockingStall();
+        unsigned long worst = asyncStall();
+        report("silent slave: recv() blocks %lu us, worst recvAsync()/loop() %lu us", blocking, worst);
+        TEST_ASSERT_EQUAL_UINT8(1, callbackCount);
+        TEST_ASSERT_EQUAL_UINT8(0, callbackResult);
+        TEST_ASSERT_GREATER_THAN(1000, blocking);
+        TEST_ASSERT_LESS_THAN(100, worst);
+}
+
+void test_cut_off_response(void) {
+        slave.cutOff = true;
+        unsigned long blocking = blockingStall();
+        unsigned long worst = asyncStall();
+        report("cut off response: recv() blocks %lu us, worst recvAsync()/loop() %lu us, result %u", blocking, worst, callbackResult);
+        TEST_ASSERT_EQUAL_UINT8(1, callbackCount);
+        TEST_ASSERT_EQUAL_UINT8(sizeof message, callbackResult); // Bytes received, no checksum.
+        TEST_ASSERT_GREATER_THAN(1000, blocking);
+        TEST_ASSERT_LESS_THAN(100, worst);
+}
+
+void test_core_rx_fifo_thresholds(void) {
+        linBus.setRxFifoThresholds(LIN_SIM_RX_FIFO_FULL, LIN_SIM_RX_TIMEOUT_BYTES);
+        asyncStall();
+        report("core RX FIFO thresholds: result 0x%02x", callbackResult);
+        linBus.setRxFifoThresholds(LIN_RX_FIFO_FULL, LIN_RX_TIMEOUT_BYTES);
+        TEST_ASSERT_EQUAL_UINT8(1, callbackCount);
+        TEST_ASSERT_EQUAL_UINT8(0, callbackResult); // Handed over after the first byte deadline.
+        TEST_ASSERT_EQUAL_UINT8(0xff, (asyncStall(), callbackResult));
+}
+
+// loop() only comes back long after the BREAK is over, the header is started again rather than stretched.
+void test_late_loop(void) {
+        uint32_t headers = linBus.getHeaderCount();
+        uint16_t aborts = linDriver.getFrameStats(0x22).headerAborts;
+        callbackCount = 0;
+        linDriver.recvAsync(0x22, message, sizeof message, 2, onRecv, 0);
+        hostAdvance(3000);
+        while (linDriver.isBusy()) {
+                linDriver.loop();
+        }
+        report("late loop() once: %u aborts, result 0x%02x", linDriver.getFrameStats(0x22).headerAborts - aborts, callbackResult);
+        TEST_ASSERT_EQUAL_UINT8(0xff, callbackResult);
+        TEST_ASSERT_EQUAL_UINT16(aborts + 1, linDriver.getFrameStats(0x22).headerAborts);
+        TEST_ASSERT_EQUAL(headers + 1, linBus.getHeaderCount());
+
+        aborts = linDriver.getFrameStats(0x22).headerAborts;
+        callbackCount = 0;
+        linDriver.recvAsync(0x22, message, sizeof message, 2, onRecv, 0);
+        while (linDriver.isBusy()) {
+                hostAdvance(3000);
+                linDriver.loop();
+        }
+        report("late loop() always: %u aborts, result 0x%02x", linDriver.getFrameStats(0x22).headerAborts - aborts, callbackResult);
+        TEST_ASSERT_EQUAL_UINT8(1, callbackCount);
+        TEST_ASSERT_EQUAL_UINT8(0, callbackResult);
+        TEST_ASSERT_EQUAL_UINT16(aborts + 1 + LIN_HEADER_RETRIES, linDriver.getFrameStats(0x22).headerAborts);
+        TEST_ASSERT_EQUAL(0, linBus.getLongHeaderCount()); // No stretched header reached the slave.
+}
+
+
+int main(int argc, char** argv) {
+        linBus.attach(&slave);
+        linDriver.begin();
+
+        UNITY_BEGIN();
+        RUN_TEST(test_response);
+        RUN_TEST(test_silent_slave);
+        RUN_TEST(test_cut_off_response);
+        RUN_TEST(test_core_rx_fifo_thresholds);
+        RUN_TEST(test_late_loop);
+        return UNITY_END();
+}
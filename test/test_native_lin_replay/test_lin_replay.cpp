@@ -0,0 +1,153 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+/**
+   Records HellaIbs polling the simulated IBS, including a dropout, and replays the capture byte for byte into a fresh
+   run. The whole system runs in the shim's virtual time, so the replay takes recorded time on the bus but only a
+   fraction of it on the host.
+   pio test -e native -f test_native_lin_replay -v
+*/
+
+#include <unity.h>
+#include <stdarg.h>
+#include <chrono>
+#include <vector>
+#include "HellaIbsSimulator.h"
+#include "LinBusArbiter.h"
+#include "LinTransport.h"
+#include "LinCaptureReplay.h"
+
+
+static LinBusSimulator linBus;
+static LinCaptureReplay linReplay; // Attached first, it answers ahead of the simulated IBS while it replays.
+static HellaIbsSimulator simulatedIbs(&ibs[0], 0x03);
+static LinDriver linDriver(&linBus, 15, 16, 17, 19200);
+static LinBusArbiter linArbiter(&linDriver);
+static LinTransport transport;
+static HellaIbs hellaIbs;
+static LinCapture linCapture;
+
+static std::vector<uint8_t> capture;
+static uint32_t dropouts; // Available -> not available while running.
+
+static void report(const char* format, ...) {
+        char text[160];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(text, sizeof text, format, args);
+        va_end(args);
+        TEST_MESSAGE(text);
+}
+
+static void drainCapture(void) {
+        LinCaptureRecord records[64];
+        uint16_t n;
+        while (0 < (n = linCapture.read(records, 64))) {
+                capture.insert(capture.end(), (const uint8_t*) records, (const uint8_t*) (records + n));
+        }
+}
+
+static void run(unsigned long ms) {
+        uint64_t end = hostTime() + 1000ULL * ms;
+        bool available = hellaIbs.isAvailable();
+        while (hostTime() < end) {
+                linArbiter.loop();
+                transport.loop();
+                hellaIbs.loop();
+                if (available && !hellaIbs.isAvailable()) {
+                        ++dropouts;
+                }
+                available = hellaIbs.isAvailable();
+                if (LIN_CAPTURE_SIZE / 2 < linCapture.available()) {
+                        drainCapture();
+                }
+        }
+}
+
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_record(void) {
+        linDriver.setCapture(&linCapture);
+        hellaIbs.setHighSpeedCommunication(true);
+        run(3000);
+        simulatedIbs.setOnline(false);
+        run(2500);
+        simulatedIbs.setOnline(true);
+        run(3000);
+
+        LinCaptureHeader header;
+        linCapture.beginExport(&header, 19200);
+        drainCapture();
+        linDriver.setCapture(0);
+        header.count = capture.size() / sizeof(LinCaptureRecord);
+        capture.insert(capture.begin(), (const uint8_t*) &header, (const uint8_t*) (&header + 1));
+        report("recorded %u records, %u dropouts", header.count, dropouts);
+        TEST_ASSERT_EQUAL(1, dropouts);
+        TEST_ASSERT_TRUE(hellaIbs.isAvailable());
+}
+
+void test_replay(void) {
+        // Whatever the simulated IBS would answer now, the recorded frames win.
+        simulatedIbs.current = -9000;
+        for (size_t offset = 0; offset < capture.size(); offset += 100) { // Chunks as uploaded through /lin/replay.
+                linReplay.load(capture.data() + offset, min((size_t) 100, capture.size() - offset));
+        }
+        TEST_ASSERT_TRUE(linReplay.start(1));
+
+        dropouts = 0;
+        int32_t replayedCurrent = 0;
+        uint64_t start = hostTime();
+        std::chrono::steady_clock::time_point hostStart = std::chrono::steady_clock::now();
+        while (linReplay.isRunning() && hostTime() - start < 20000000ULL) {
+                run(100);
+                if (hellaIbs.isAvailable() && -9000 != hellaIbs.getSample().current) {
+                        replayedCurrent = hellaIbs.getSample().current;
+                }
+        }
+        double simulated = (hostTime() - start) / 1e6;
+        double host = std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStart).count();
+        report("replayed %u records in %.1f s bus time, %.2f s host time (%.0fx), %u answered, %u silent, %u dropouts",
+               linReplay.getRecordCount(), simulated, host, simulated / host, linReplay.getReplayedCount(),
+               linReplay.getSilentCount(), dropouts);
+
+        TEST_ASSERT_GREATER_THAN(0, linReplay.getReplayedCount());
+        TEST_ASSERT_GREATER_THAN(0, linReplay.getSilentCount());
+        // The recorded dropout, plus every detection by the simulated IBS answering the diagnostic requests while the
+        // recording is still silent.
+        TEST_ASSERT_GREATER_THAN(0, dropouts);
+        TEST_ASSERT_TRUE(hellaIbs.isAvailable());
+        TEST_ASSERT_EQUAL_INT32(-1500, replayedCurrent);
+}
+
+
+int main(int argc, char** argv) {
+        linBus.attach(&linReplay);
+        linBus.attach(&simulatedIbs);
+        linArbiter.begin();
+        transport.setup(&linArbiter);
+        hellaIbs.setup(&linArbiter, &transport);
+
+        UNITY_BEGIN();
+        RUN_TEST(test_record);
+        RUN_TEST(test_replay);
+        return UNITY_END();
+}
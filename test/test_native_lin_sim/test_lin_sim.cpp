@@ -0,0 +1,278 @@
+/**
+   This file is part of the "RV Smart Control" distribution
+   (https://github.com/ChrisPHL/RvSmartControl).
+   Copyright (c) 2021 Christian Pohl, aka ChrisPHL, www.chpohl.de.
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, version 3.
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+   General Public License for more details.
+   You should have received a copy of the GNU General Public License
+   along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+   Addition: No commercial use without the explicit permission of the author.
+ */
+
+/**
+   Benchmarks HellaIbs against the simulated LIN bus: detection time, poll throughput and timeout behaviour, and
+   detection of an IBS that ignores wildcard identification requests. Also the divider range of the merged schedule and a
+   slave that asks for more time with "response pending".
+   Runs in the virtual time of the host shim, so the numbers are simulated bus time, not host time.
+   pio test -e native -f test_native_lin_sim -v
+*/
+
+#include <unity.h>
+#include <stdarg.h>
+#include "HellaIbsSimulator.h"
+#include "LinBusArbiter.h"
+#include "LinTransport.h"
+
+
+static LinBusSimulator linBus;
+static HellaIbsSimulator simulatedIbs(&ibs[0], 0x03);
+static LinDriver linDriver(&linBus, 15, 16, 17, 19200);
+static LinBusArbiter linArbiter(&linDriver);
+static LinTransport transport;
+static HellaIbs hellaIbs;
+
+static uint8_t rampStep;
+
+static void report(const char* format, ...) {
+        char message[160];
+        va_list args;
+        va_start(args, format);
+        vsnprintf(message, sizeof message, format, args);
+        va_end(args);
+        TEST_MESSAGE(message);
+}
+
+static void run(unsigned long ms) {
+        uint64_t end = hostTime() + 1000ULL * ms;
+        while (hostTime() < end) {
+                linArbiter.loop();
+                transport.loop();
+                hellaIbs.loop();
+        }
+}
+
+// msec until "available" matches, or "limit".
+static unsigned long runUntilAvailable(bool available, unsigned long limit) {
+        uint64_t start = hostTime();
+        while (available != hellaIbs.isAvailable() && hostTime() - start < 1000ULL * limit) {
+                linArbiter.loop();
+                transport.loop();
+                hellaIbs.loop();
+        }
+        return (hostTime() - start) / 1000;
+}
+
+// Every frame 2 draws another 100 mA.
+static void rampCurrent(HellaIbsSimulator* ibs, uint8_t id) {
+        if (IbsS1Frame2::id == id) {
+                ibs->current = -1000 - 100L * (++rampStep % 50);
+        }
+}
+
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_detection_time(void) {
+        uint32_t headers = linBus.getHeaderCount();
+        unsigned long detection = runUntilAvailable(true, 10000);
+        report("detected %s after %lu ms, %u headers, %u responses, %u master frames", hellaIbs.getName().c_str(), detection,
+               linBus.getHeaderCount() - headers, linBus.getResponseCount(), linBus.getMasterFrameCount());
+        TEST_ASSERT_TRUE(hellaIbs.isAvailable());
+        TEST_ASSERT_LESS_THAN(5000, detection);
+        run(1000); // Frame 2 follows the battery type request.
+        TEST_ASSERT_FLOAT_WITHIN(0.001, 12.8, hellaIbs.getBatteryVoltage());
+}
+
+void test_poll_throughput(void) {
+        const unsigned long duration = 10000; // msec
+        hellaIbs.setHighSpeedCommunication(true);
+        simulatedIbs.setScript(rampCurrent);
+        run(500);
+        uint32_t headers = linBus.getHeaderCount();
+        uint32_t responses = linBus.getResponseCount();
+        uint32_t version = hellaIbs.getVersion();
+        run(duration);
+        headers = linBus.getHeaderCount() - headers;
+        responses = linBus.getResponseCount() - responses;
+        report("%u headers, %u responses in %lu ms: %.1f frames/s, %u updates", headers, responses, duration,
+               responses * 1000.0 / duration, hellaIbs.getVersion() - version);
+        simulatedIbs.setScript(0);
+        run(200); // Let the last frame 2 of the ramp through.
+        hellaIbs.setHighSpeedCommunication(false);
+        TEST_ASSERT_EQUAL(headers, responses);
+        TEST_ASSERT_GREATER_THAN(duration / 100 - duration / 1000, responses); // Frame 2 every 100 msec.
+        TEST_ASSERT_EQUAL_INT32(simulatedIbs.current, hellaIbs.getSample().current);
+}
+
+void test_late_response(void) {
+        // Late, but within the frame slot: nothing may time out.
+        const LinFrameStats& stats = linDriver.getFrameStats(IbsS1Frame2::id);
+        uint32_t timeouts = stats.timeouts;
+        simulatedIbs.setResponseDelay(2000);
+        run(5000);
+        report("2 ms response delay: %u timeouts", stats.timeouts - timeouts);
+        TEST_ASSERT_EQUAL(timeouts, stats.timeouts);
+        TEST_ASSERT_TRUE(hellaIbs.isAvailable());
+
+        // Beyond the response timeout the IBS counts as gone.
+        simulatedIbs.setResponseDelay(50000);
+        unsigned long loss = runUntilAvailable(false, 10000);
+        report("50 ms response delay: lost after %lu ms, %u timeouts", loss, stats.timeouts - timeouts);
+        simulatedIbs.setResponseDelay(200);
+        TEST_ASSERT_FALSE(hellaIbs.isAvailable());
+        TEST_ASSERT_GREATER_THAN(timeouts, stats.timeouts);
+}
+
+void test_offline_and_back(void) {
+        run(3000);
+        TEST_ASSERT_TRUE(hellaIbs.isAvailable());
+        simulatedIbs.setOnline(false);
+        unsigned long loss = runUntilAvailable(false, 10000);
+        uint32_t headers = linBus.getHeaderCount();
+        uint32_t responses = linBus.getResponseCount();
+        run(5000);
+        report("offline: lost after %lu ms, %u unanswered headers in 5 s", loss,
+               (linBus.getHeaderCount() - headers) - (linBus.getResponseCount() - responses));
+        TEST_ASSERT_FALSE(hellaIbs.isAvailable());
+        TEST_ASSERT_LESS_THAN(2000, loss);
+
+        simulatedIbs.setOnline(true);
+        unsigned long detection = runUntilAvailable(true, 10000);
+        report("online again: detected after %lu ms", detection);
+        TEST_ASSERT_TRUE(hellaIbs.isAvailable());
+}
+
+// Master frames, i.e. diagnostic requests, until the IBS is detected again after it was gone.
+static uint32_t redetect(void) {
+        simulatedIbs.setOnline(false);
+        runUntilAvailable(false, 10000);
+        run(3000); // Verifying the cached IBS fails as well, so it is identified from scratch.
+        simulatedIbs.setOnline(true);
+        uint32_t frames = linBus.getMasterFrameCount();
+        runUntilAvailable(true, 20000);
+        return linBus.getMasterFrameCount() - frames;
+}
+
+void test_no_wildcard_support(void) {
+        simulatedIbs.setWildcardSupport(false);
+        uint32_t first = redetect();
+        bool found = hellaIbs.isAvailable();
+        uint32_t second = redetect();
+        simulatedIbs.setWildcardSupport(true);
+        report("without wildcards: detected with %u master frames, again with %u", first, second);
+        TEST_ASSERT_TRUE(found);
+        TEST_ASSERT_TRUE(hellaIbs.isAvailable());
+        TEST_ASSERT_LESS_THAN(first, second); // The wildcard request is not tried again.
+}
+
+// A slow client's slot dividers are multiplied with its sub-rate, merges beyond the 8 bit divider are refused.
+void test_schedule_divider_range(void) {
+        static LinBusSimulator bus;
+        static LinDriver driver(&bus, 15, 16, 17, 19200);
+        static LinBusArbiter arbiter(&driver);
+        static uint8_t data[8];
+        static int fastClient, slowClient;
+        LinScheduleSlot fast = {0x22, Lin2Frame | LinReadFrame, 8, 0, data, 0, 0, 1, 0};
+        LinScheduleSlot slow = {0x23, Lin2Frame | LinReadFrame, 8, 0, data, 0, 0, 30, 0};
+        TEST_ASSERT_TRUE(arbiter.setSchedule(&fastClient, &fast, 1, 100));
+        TEST_ASSERT_FALSE(arbiter.setSchedule(&slowClient, &slow, 1, 1000)); // 30 * 10
+        slow.divider = 25;
+        TEST_ASSERT_TRUE(arbiter.setSchedule(&slowClient, &slow, 1, 1000));
+        TEST_ASSERT_FALSE(arbiter.setSchedule(&fastClient, &fast, 1, 50)); // 25 * 20 for the slow client
+        TEST_ASSERT_TRUE(arbiter.setSchedule(&fastClient, &fast, 1, 200));
+}
+
+// Answers a diagnostic request with "response pending" every 600 ms and with the real response after 2.5 s.
+class SlowSlave : public LinSimSlave {
+  public:
+    unsigned long requested = 0;
+    unsigned long lastPending = 0;
+    uint8_t pendingCount = 0;
+
+    uint8_t publish(uint8_t id, uint8_t* data) {
+      if (0x3D != id || 0 == requested) {
+        return 0;
+      }
+      unsigned long now = millis();
+      uint8_t response[8] = {0x05, 0x03, LIN_SID_NEGATIVE_RESPONSE, 0xB2, LIN_NRC_RESPONSE_PENDING, 0xFF, 0xFF, 0xFF};
+      if (2500 <= now - requested) {
+        requested = 0;
+        response[1] = 0x02;
+        response[2] = 0xB2 + 0x40;
+        response[3] = 0x00;
+        response[4] = 0xFF;
+      } else if (600 <= now - lastPending) {
+        lastPending = now;
+        ++pendingCount;
+      } else {
+        return 0;
+      }
+      memcpy(data, response, sizeof response);
+      return sizeof response;
+    }
+
+    void subscribe(uint8_t id, const uint8_t* data, uint8_t nBytes) {
+      if (0x3C == id && 0x05 == data[0]) {
+        requested = lastPending = millis();
+      }
+    }
+};
+
+static LinTransportResult slowResult;
+static uint8_t slowCallbacks;
+
+static void onSlowResponse(void* context, uint8_t nad, const uint8_t* pdu, uint16_t length, LinTransportResult result) {
+        slowResult = result;
+        ++slowCallbacks;
+}
+
+void test_response_pending(void) {
+        static LinBusSimulator bus;
+        static LinDriver driver(&bus, 15, 16, 17, 19200);
+        static LinBusArbiter arbiter(&driver);
+        static LinTransport slowTransport;
+        static SlowSlave slave;
+        const uint8_t pdu[] = {0xB2, 0x00, 0xFF, 0x7F, 0xFF, 0xFF};
+        bus.attach(&slave);
+        arbiter.begin();
+        slowTransport.setup(&arbiter);
+        slowCallbacks = 0;
+        slowTransport.request(0x05, pdu, sizeof pdu, onSlowResponse, 0);
+        unsigned long start = millis();
+        while (0 == slowCallbacks && 5000 > millis() - start) {
+                arbiter.loop();
+                slowTransport.loop();
+        }
+        report("response pending: %u times, result %u after %lu ms", slave.pendingCount, slowResult, millis() - start);
+        TEST_ASSERT_EQUAL_UINT8(1, slowCallbacks);
+        TEST_ASSERT_EQUAL(kLtrOk, slowResult);
+        TEST_ASSERT_GREATER_THAN(1, slave.pendingCount);
+}
+
+
+int main(int argc, char** argv) {
+        linBus.attach(&simulatedIbs);
+        linArbiter.begin();
+        transport.setup(&linArbiter);
+        hellaIbs.setup(&linArbiter, &transport);
+
+        UNITY_BEGIN();
+        RUN_TEST(test_detection_time);
+        RUN_TEST(test_poll_throughput);
+        RUN_TEST(test_late_response);
+        RUN_TEST(test_offline_and_back);
+        RUN_TEST(test_no_wildcard_support);
+        RUN_TEST(test_schedule_divider_range);
+        RUN_TEST(test_response_pending);
+        return UNITY_END();
+}